@@ -10,20 +10,15 @@ namespace Radiant
     {
         // Keep it simple stupid, please.
 
-#define HZB_WG_SIZE 32u
 #define HZB_MIP_COUNT 16u  // up to 65k viewport size
 
 #define MAX_LOD_LEVEL 10u
 
-        struct MeshGeometryData
-        {
-        };
-
 #define MESHLET_WG_SIZE 64u
 
         // Meshes(group of meshlets) -> meshlets(small group of vertices/primitives).
         static constexpr uint32_t s_MaxMeshletVertexCount   = MESHLET_WG_SIZE;  // Thread per vertex
-        static constexpr uint32_t s_MaxMeshletTriangleCount = 126;
+        static constexpr uint32_t s_MaxMeshletTriangleCount = 124;  // meshoptimizer wants it to be multiple of 4.
         static constexpr float s_MeshletCullConeWeight      = 0.5f;
 
         // why the fk vtx/tri count is uint32_t if I wanna store at maximum 256 things, so uint8_t is enough buddy
@@ -50,6 +45,23 @@ namespace Radiant
             int8_t cone_cutoff_s8;
         };
 
+        struct MeshGeometryData
+        {
+            const VertexPosition* VertexPositions;
+            const VertexAttribute* VertexAttributes;
+            const MeshletMainData* Meshlets;
+            const MeshletCullData* MeshletCullData;
+            const uint32_t* MeshletVertexIndices;    // Meshlet local vertex -> geometry vertex.
+            const uint32_t* MeshletTriangleIndices;  // 3 meshlet local vertices packed as u8 per triangle.
+            uint32_t MeshletCount;
+        };
+
+        // World space frustum planes(normals point inside) of the view meshlets are culled against.
+        struct CullingData
+        {
+            Plane FrustumPlanes[6];
+        };
+
         // We have 1 global instance buffer across the renderer,
         // I don't like storing geometryID(wasting 4/8 bytes) this instance refers to, but otherwise its
         // tricky to handle.
@@ -12,8 +12,12 @@ namespace Radiant
 
     namespace Shaders
     {
+        // NOTE: Compute downsample workgroup size is specialization constant picked by kernel autotuner, these are defaults and upper
+        // bounds at the same time(groupshared tile is sized for them). Upsample blur always runs with them.
 #define BLOOM_WG_SIZE_X 16
 #define BLOOM_WG_SIZE_Y 16
+#define BLOOM_DOWNSAMPLE_WG_SIZE_X_CONSTANT_ID 0
+#define BLOOM_DOWNSAMPLE_WG_SIZE_Y_CONSTANT_ID 1
 
 #ifndef __cplusplus
         static const uint2 g_BLOOM_WG_SIZE = uint2(BLOOM_WG_SIZE_X, BLOOM_WG_SIZE_Y);
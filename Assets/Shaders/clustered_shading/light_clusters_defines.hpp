@@ -56,7 +56,10 @@ namespace Radiant
         }
 #endif
 
+        // NOTE: Assignment workgroup size is specialization constant picked by kernel autotuner, this is the default. Shared light batch
+        // stays sized for it, other workgroup sizes just load more or fewer lights per thread.
 #define LIGHT_CLUSTERS_ASSIGNMENT_WG_SIZE 32
+#define LIGHT_CLUSTERS_ASSIGNMENT_WG_SIZE_CONSTANT_ID 0
 #define LIGHT_CLUSTERS_LIGHTS_LOAD_PER_THREAD 6  // best case I profiled is (log2(WG_SIZE) + 1)
 #define LIGHT_CLUSTERS_MAX_SHARED_LIGHTS (LIGHT_CLUSTERS_LIGHTS_LOAD_PER_THREAD * LIGHT_CLUSTERS_ASSIGNMENT_WG_SIZE)
 
@@ -0,0 +1,73 @@
+// gpu_driven_defines.hpp
+
+#ifdef __cplusplus
+#pragma once
+
+namespace Radiant
+{
+
+#endif
+
+    namespace Shaders
+    {
+
+#define GPU_DRIVEN_BUILD_DRAWS_WG_SIZE 64u
+#define GPU_DRIVEN_MAX_LOD_COUNT 8u
+
+// NOTE: Draw buckets are pipeline states draws differ by: alpha mode(opaque, mask, blend) x cull mode(back, none), plus single bucket of
+// shadow casters(opaque only, CSM pipeline controls culling itself).
+#define GPU_DRIVEN_CULL_MODE_COUNT 2u
+#define GPU_DRIVEN_DRAW_BUCKET_COUNT (3u * GPU_DRIVEN_CULL_MODE_COUNT)
+#define GPU_DRIVEN_SHADOW_DRAW_BUCKET GPU_DRIVEN_DRAW_BUCKET_COUNT
+#define GPU_DRIVEN_TOTAL_DRAW_BUCKET_COUNT (GPU_DRIVEN_DRAW_BUCKET_COUNT + 1u)
+
+        struct GPUMeshLOD
+        {
+            uint32_t FirstIndex;
+            uint32_t IndexCount;
+            float Error;
+        };
+
+        struct GPUInstanceData
+        {
+            float3 Translation;
+            float4 Orientation;  // quat: x - real part, yzw - imaginary part.
+            float3 Scale;
+            Sphere Bounds;  // Object space.
+            float3 PositionDequantScale;  // DepthOnlyVertexPosition decoding.
+            float3 PositionDequantOffset;
+            const GLTFMaterial* MaterialData;
+            uint32_t VertexOffset;  // Into vertex megabuffers.
+            uint32_t DrawBucket;    // alpha mode * GPU_DRIVEN_CULL_MODE_COUNT + cull mode.
+            uint32_t LODCount;
+            uint32_t Padding0;  // NOTE: Keeps C++ struct size(aligned to pointer) equal to scalar layout one.
+            GPUMeshLOD LODs[GPU_DRIVEN_MAX_LOD_COUNT];
+        };
+
+        // Same layout as VkDrawIndexedIndirectCommand.
+        struct DrawIndexedIndirectCommand
+        {
+            uint32_t IndexCount;
+            uint32_t InstanceCount;
+            uint32_t FirstIndex;
+            int32_t VertexOffset;
+            uint32_t FirstInstance;
+        };
+
+        struct GPUDrivenCullData
+        {
+            Plane FrustumPlanes[6];  // World space, normals point inside.
+            float3 CameraPosition;
+            float ProjectionScale;  // Converts view space error at unit distance into pixels.
+            float LODErrorThreshold;
+            uint32_t ShadowLODBias;
+            uint32_t InstanceCount;
+            uint32_t MaxDrawsPerBucket;
+            uint32_t bEnableLODs;
+        };
+
+    }  // namespace Shaders
+
+#ifdef __cplusplus
+}
+#endif
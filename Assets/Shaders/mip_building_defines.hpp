@@ -0,0 +1,24 @@
+// mip_building_defines.hpp
+
+#ifdef __cplusplus
+#pragma once
+
+namespace Radiant
+{
+
+#endif
+
+    namespace Shaders
+    {
+#define SPD_WG_SIZE 256u
+#define SPD_TILE_SIZE 64u      // Source texels per side each workgroup reduces.
+#define SPD_MAX_MIP_COUNT 12u  // Mips produced by single dispatch, source mip isn't counted.
+
+#define SPD_REDUCTION_AVERAGE 0u
+#define SPD_REDUCTION_MIN 1u
+#define SPD_REDUCTION_MAX 2u
+    }  // namespace Shaders
+
+#ifdef __cplusplus
+}
+#endif
@@ -26,8 +26,11 @@ namespace Radiant
             float2 MinMaxCascadeDistance;
         };
 
+        // NOTE: Defaults of specialization constants, actual workgroup size is picked by kernel autotuner.
 #define DEPTH_REDUCTION_WG_SIZE_X 16
 #define DEPTH_REDUCTION_WG_SIZE_Y 16
+#define DEPTH_REDUCTION_WG_SIZE_X_CONSTANT_ID 0
+#define DEPTH_REDUCTION_WG_SIZE_Y_CONSTANT_ID 1
 
         struct DepthBounds
         {
@@ -15,8 +15,12 @@ namespace Radiant
         static const int32_t g_SamplesInOneDimension = 2 * SSAO_BOX_BLUR_SIZE + 1;
         static const float g_TotalSampleCountInv     = 1.0f / (g_SamplesInOneDimension * g_SamplesInOneDimension);
 
+        // NOTE: SSAO compute workgroup size is specialization constant picked by kernel autotuner, these are defaults and upper bounds
+        // at the same time(groupshared tile is sized for them).
 #define SSAO_WG_SIZE_X 16
 #define SSAO_WG_SIZE_Y 16
+#define SSAO_WG_SIZE_X_CONSTANT_ID 0
+#define SSAO_WG_SIZE_Y_CONSTANT_ID 1
 #define USE_THREAD_GROUP_TILING_X 0
 
 #ifndef __cplusplus
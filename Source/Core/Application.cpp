@@ -5,6 +5,10 @@
 #include <Render/Renderers/SSGI/SSGIRenderer.hpp>
 #include <Render/Renderers/AW2/AlanWake2Renderer.hpp>
 #include <Render/Renderers/Shadows/ShadowsRenderer.hpp>
+#include <Render/GfxShader.hpp>
+#include <Scene/Mesh.hpp>
+#include <Scene/BVH.hpp>
+#include <Scene/SceneGraph.hpp>
 
 namespace Radiant
 {
@@ -18,8 +22,55 @@ namespace Radiant
         LOG_INFO("{}", __FUNCTION__);
         LOG_CRITICAL("Current working directory: {}", std::filesystem::current_path().string());
 
+        // NOTE: Headless startup benchmark, no window and renderer are created, Run() returns right away. Shader directory can follow
+        // the flag, otherwise it's looked up relative to working directory.
+        static constexpr std::string_view s_DefaultShaderDir = "../Assets/Shaders";
+        if (HasCommandLineArgument("--shader-compile-benchmark"))
+        {
+            const std::string shaderDir{GetCommandLineArgumentValue("--shader-compile-benchmark").value_or(s_DefaultShaderDir)};
+            m_bHeadless = true;
+            GfxShaderUtils::RunCompileBenchmark(shaderDir);
+            return;
+        }
+
+        // NOTE: Headless as well, failing audit is reported through exit code, so build(CI) can be stopped by it.
+        if (HasCommandLineArgument("--shader-layout-audit"))
+        {
+            const std::string shaderDir{GetCommandLineArgumentValue("--shader-layout-audit").value_or(s_DefaultShaderDir)};
+            const auto budgetsPath = (std::filesystem::path(shaderDir) / "layout_budgets.txt").generic_string();
+            m_bHeadless            = true;
+            m_ExitCode             = GfxShaderUtils::RunLayoutAudit(shaderDir, budgetsPath) ? 0 : 1;
+            return;
+        }
+
+        // NOTE: CPU only, synthetic scenes, no window or device is needed.
+        if (HasCommandLineArgument("--bvh-cull-benchmark"))
+        {
+            m_bHeadless = true;
+
+            constexpr std::array<u32, 3> instanceCounts = {10'000, 100'000, 1'000'000};
+            BVHUtils::RunCullBenchmark(instanceCounts, 10);
+            return;
+        }
+
+        if (HasCommandLineArgument("--scene-graph-benchmark"))
+        {
+            m_bHeadless = true;
+            SceneGraphUtils::RunTransformBenchmark(10);
+            return;
+        }
+
         m_MainWindow = MakeUnique<GLFWWindow>(WindowDescription{.Name = m_Description.Name, .Extent = m_Description.WindowExtent});
 
+        // NOTE: Needs device(and window for it), but no renderer, Run() returns right away.
+        if (HasCommandLineArgument("--mesh-load-benchmark"))
+        {
+            m_bHeadless           = true;
+            const auto gfxContext = MakeUnique<GfxContext>();
+            MeshUtils::RunLoadBenchmark(gfxContext, "../Assets/Models/sponza/scene.gltf", 5);
+            return;
+        }
+
         // m_Renderer = MakeUnique<CombinedRenderer>();
         m_Renderer = MakeUnique<ShadowsRenderer>();
         //  m_Renderer = MakeUnique<AW2::AlanWake2Renderer>();
@@ -29,6 +80,8 @@ namespace Radiant
 
     void Application::Run() noexcept
     {
+        if (m_bHeadless) return;
+
         RDNT_ASSERT(m_Renderer, "Renderer isn't setup!");
 
         LOG_INFO("{}", __FUNCTION__);
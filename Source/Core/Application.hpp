@@ -31,6 +31,20 @@ namespace Radiant
         void Run() noexcept;
 
         NODISCARD FORCEINLINE const auto& GetDescription() const noexcept { return m_Description; }
+        NODISCARD FORCEINLINE bool HasCommandLineArgument(const std::string_view argument) const noexcept
+        {
+            return std::ranges::any_of(std::span(m_Description.CmdArgs.Argv, m_Description.CmdArgs.Argc),
+                                       [&](const char* arg) noexcept { return std::string_view(arg) == argument; });
+        }
+        // NOTE: Value is the argument right after the flag("--shader-layout-audit <shader dir>"), another flag doesn't count as one.
+        NODISCARD FORCEINLINE std::optional<std::string_view> GetCommandLineArgumentValue(const std::string_view argument) const noexcept
+        {
+            const std::span args(m_Description.CmdArgs.Argv, m_Description.CmdArgs.Argc);
+            const auto it = std::ranges::find_if(args, [&](const char* arg) noexcept { return std::string_view(arg) == argument; });
+            if (it == args.end() || std::next(it) == args.end() || std::string_view(*std::next(it)).starts_with("--")) return std::nullopt;
+
+            return std::string_view(*std::next(it));
+        }
         NODISCARD FORCEINLINE static Unique<Application> Create(const ApplicationDescription& appDesc) noexcept
         {
             return MakeUnique<Application>(appDesc);
@@ -40,6 +54,7 @@ namespace Radiant
         NODISCARD FORCEINLINE auto& GetThreadPool() noexcept { return m_ThreadPool; }
 
         NODISCARD FORCEINLINE const auto GetDeltaTime() const noexcept { return m_DeltaTime; }
+        NODISCARD FORCEINLINE const auto GetExitCode() const noexcept { return m_ExitCode; }
         NODISCARD FORCEINLINE static auto& Get() noexcept
         {
             RDNT_ASSERT(s_Instance, "Application instance invalid!");
@@ -54,7 +69,9 @@ namespace Radiant
 
         ApplicationDescription m_Description{};
         bool m_bIsRunning{false};
+        bool m_bHeadless{false};
         f32 m_DeltaTime{0.f};
+        i32 m_ExitCode{0};
 
         constexpr Application() noexcept = delete;
         void Init() noexcept;
@@ -10,6 +10,13 @@
 #include <mutex>
 #include <deque>
 
+#if defined(RDNT_LINUX) || defined(RDNT_MACOS)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace Radiant
 {
 
@@ -232,6 +239,57 @@ namespace Radiant
             return (val + alignment - 1) & ~(alignment - 1);
         }
 
+        struct RadixSortItem final
+        {
+            u64 Key{0};
+            u32 Value{0};
+        };
+
+        // NOTE: Stable LSD radix sort, 8 passes over 8 bit digits, histograms of all digits are gathered in a single read.
+        // Passes where every key has the same digit are skipped, so keys with unused bits cost less.
+        static void RadixSort(std::vector<RadixSortItem>& items, std::vector<RadixSortItem>& scratchItems) noexcept
+        {
+            constexpr u32 digitBitCount = 8;
+            constexpr u32 digitCount    = 1 << digitBitCount;
+            constexpr u32 passCount     = sizeof(u64) * 8 / digitBitCount;
+
+            const auto itemCount = static_cast<u32>(items.size());
+            if (itemCount < 2) return;
+
+            std::array<std::array<u32, digitCount>, passCount> histograms{};
+            for (const auto& item : items)
+            {
+                for (u32 passIndex{}; passIndex < passCount; ++passIndex)
+                    ++histograms[passIndex][(item.Key >> (passIndex * digitBitCount)) & (digitCount - 1)];
+            }
+
+            scratchItems.resize(itemCount);
+            auto* src = &items;
+            auto* dst = &scratchItems;
+            for (u32 passIndex{}; passIndex < passCount; ++passIndex)
+            {
+                auto& histogram    = histograms[passIndex];
+                const u32 shift    = passIndex * digitBitCount;
+                const u32 keyDigit = ((*src)[0].Key >> shift) & (digitCount - 1);
+                if (histogram[keyDigit] == itemCount) continue;
+
+                u32 offset{0};
+                for (auto& digitOffset : histogram)
+                {
+                    const u32 digitItemCount = digitOffset;
+                    digitOffset              = offset;
+                    offset += digitItemCount;
+                }
+
+                for (const auto& item : *src)
+                    (*dst)[histogram[(item.Key >> shift) & (digitCount - 1)]++] = item;
+
+                std::swap(src, dst);
+            }
+
+            if (src != &items) items.swap(scratchItems);
+        }
+
         template <typename T> static std::vector<T> LoadData(const std::string_view& dataPath) noexcept
         {
             static_assert(std::is_trivial<T>::value, "T must be a trivial type");
@@ -284,6 +342,69 @@ namespace Radiant
             output.close();
         }
 
+        // NOTE: Read-only memory mapped file, pages are faulted in lazily by the OS on first access.
+        class MappedFile final : private Uncopyable, private Unmovable
+        {
+          public:
+            MappedFile(const std::string_view& filePath) noexcept
+            {
+                RDNT_ASSERT(!filePath.empty(), "Data path is invalid!");
+#if defined(RDNT_WINDOWS)
+                m_File = CreateFileA(filePath.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                     FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+                if (m_File == INVALID_HANDLE_VALUE) return;
+
+                LARGE_INTEGER fileSize = {};
+                if (!GetFileSizeEx(m_File, &fileSize) || fileSize.QuadPart == 0) return;
+
+                m_Mapping = CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (!m_Mapping) return;
+
+                m_Data      = static_cast<const u8*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+                m_SizeBytes = m_Data ? static_cast<u64>(fileSize.QuadPart) : 0;
+#else
+                m_FileDescriptor = open(filePath.data(), O_RDONLY);
+                if (m_FileDescriptor == -1) return;
+
+                struct stat fileStat = {};
+                if (fstat(m_FileDescriptor, &fileStat) != 0 || fileStat.st_size == 0) return;
+
+                void* mappedData = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, m_FileDescriptor, 0);
+                if (mappedData == MAP_FAILED) return;
+
+                m_Data      = static_cast<const u8*>(mappedData);
+                m_SizeBytes = static_cast<u64>(fileStat.st_size);
+#endif
+            }
+
+            ~MappedFile() noexcept
+            {
+#if defined(RDNT_WINDOWS)
+                if (m_Data) UnmapViewOfFile(m_Data);
+                if (m_Mapping) CloseHandle(m_Mapping);
+                if (m_File != INVALID_HANDLE_VALUE) CloseHandle(m_File);
+#else
+                if (m_Data) munmap(const_cast<u8*>(m_Data), m_SizeBytes);
+                if (m_FileDescriptor != -1) close(m_FileDescriptor);
+#endif
+            }
+
+            NODISCARD FORCEINLINE bool IsValid() const noexcept { return m_Data != nullptr; }
+            NODISCARD FORCEINLINE std::span<const u8> GetData() const noexcept { return {m_Data, m_SizeBytes}; }
+
+          private:
+            const u8* m_Data{nullptr};
+            u64 m_SizeBytes{0};
+#if defined(RDNT_WINDOWS)
+            HANDLE m_File{INVALID_HANDLE_VALUE};
+            HANDLE m_Mapping{nullptr};
+#else
+            i32 m_FileDescriptor{-1};
+#endif
+
+            constexpr MappedFile() noexcept = delete;
+        };
+
     }  // namespace CoreUtils
 
 }  // namespace Radiant
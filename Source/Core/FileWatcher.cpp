@@ -0,0 +1,105 @@
+#include "FileWatcher.hpp"
+
+#if defined(RDNT_LINUX)
+#include <sys/inotify.h>
+#endif
+
+namespace Radiant
+{
+
+    FileWatcher::FileWatcher() noexcept
+    {
+#if defined(RDNT_LINUX)
+        m_InotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_InotifyFD < 0) LOG_WARN("FileWatcher: inotify_init1() failed, errno: {}, falling back to polling.", errno);
+#endif
+    }
+
+    FileWatcher::~FileWatcher() noexcept
+    {
+#if defined(RDNT_LINUX)
+        if (m_InotifyFD >= 0) close(m_InotifyFD);
+#endif
+    }
+
+    void FileWatcher::Watch(const std::filesystem::path& filePath) noexcept
+    {
+        std::error_code errorCode{};
+        const auto canonicalPath = std::filesystem::weakly_canonical(filePath, errorCode);
+        if (errorCode) return;
+
+        std::scoped_lock lock(m_Mtx);
+        if (!m_Files.try_emplace(canonicalPath.string(), std::filesystem::last_write_time(canonicalPath, errorCode)).second) return;
+
+#if defined(RDNT_LINUX)
+        if (m_InotifyFD < 0) return;
+
+        const auto directoryPath = canonicalPath.parent_path().string();
+        if (std::ranges::any_of(m_WatchedDirectories, [&](const auto& watchedDirectory) noexcept
+                                { return watchedDirectory.second == directoryPath; }))
+            return;
+
+        // NOTE: Close after write catches in place saves, moved to catches the rename ones.
+        const i32 watchDescriptor = inotify_add_watch(m_InotifyFD, directoryPath.data(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watchDescriptor < 0)
+        {
+            LOG_WARN("FileWatcher: Failed to watch directory: {}, errno: {}", directoryPath, errno);
+            return;
+        }
+        m_WatchedDirectories.insert_or_assign(watchDescriptor, directoryPath);
+#endif
+    }
+
+    std::vector<std::string> FileWatcher::PollChanges() noexcept
+    {
+        std::vector<std::string> changedFiles{};
+        const auto AddChangedFileFunc = [&](std::string&& filePath) noexcept
+        {
+            if (std::ranges::find(changedFiles, filePath) == changedFiles.end()) changedFiles.emplace_back(std::move(filePath));
+        };
+
+        std::scoped_lock lock(m_Mtx);
+#if defined(RDNT_LINUX)
+        if (m_InotifyFD >= 0)
+        {
+            alignas(inotify_event) std::array<char, 4096> eventBuffer{};
+            while (true)
+            {
+                // Non-blocking, fails with EAGAIN once queue is drained.
+                const auto readBytes = read(m_InotifyFD, eventBuffer.data(), eventBuffer.size());
+                if (readBytes <= 0) break;
+
+                for (i64 offset{}; offset < readBytes;)
+                {
+                    const auto* event = reinterpret_cast<const inotify_event*>(eventBuffer.data() + offset);
+                    offset += sizeof(inotify_event) + event->len;
+
+                    const auto directoryIt = m_WatchedDirectories.find(event->wd);
+                    if (event->len == 0 || directoryIt == m_WatchedDirectories.end()) continue;
+
+                    auto filePath = (std::filesystem::path(directoryIt->second) / event->name).string();
+                    if (m_Files.contains(filePath)) AddChangedFileFunc(std::move(filePath));
+                }
+            }
+            return changedFiles;
+        }
+#endif
+
+        if (Timer::Now() - m_LastPollTime < s_PollInterval) return changedFiles;
+        m_LastPollTime = Timer::Now();
+
+        for (auto& [filePath, lastWriteTime] : m_Files)
+        {
+            // File can be missing for a moment while editor replaces it, it's picked up on next poll then.
+            std::error_code errorCode{};
+            const auto writeTime = std::filesystem::last_write_time(filePath, errorCode);
+            if (errorCode || writeTime == lastWriteTime) continue;
+
+            lastWriteTime = writeTime;
+            AddChangedFileFunc(std::string(filePath));
+        }
+
+        return changedFiles;
+    }
+
+}  // namespace Radiant
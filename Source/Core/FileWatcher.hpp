@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Core/Core.hpp>
+
+namespace Radiant
+{
+
+    // NOTE: Reports watched files modified since the last poll. On linux directories of watched files are watched through inotify
+    // (editors often save through temporary file + rename, which is visible only as directory event), elsewhere(or if inotify isn't
+    // available) modification times are polled. Paths are canonical.
+    class FileWatcher final : private Uncopyable, private Unmovable
+    {
+      public:
+        FileWatcher() noexcept;
+        ~FileWatcher() noexcept;
+
+        // NOTE: Thread-safe, watching the same file again does nothing.
+        void Watch(const std::filesystem::path& filePath) noexcept;
+        NODISCARD std::vector<std::string> PollChanges() noexcept;
+
+      private:
+        static constexpr auto s_PollInterval = std::chrono::milliseconds(250);
+
+        std::mutex m_Mtx{};
+        UnorderedMap<std::string, std::filesystem::file_time_type> m_Files;  // Last write time is used by polling only.
+        std::chrono::time_point<std::chrono::high_resolution_clock> m_LastPollTime{Timer::Now()};
+#if defined(RDNT_LINUX)
+        i32 m_InotifyFD{-1};
+        UnorderedMap<i32, std::string> m_WatchedDirectories;  // Watch descriptor -> directory.
+#endif
+    };
+
+}  // namespace Radiant
@@ -43,6 +43,19 @@ namespace Radiant
             return (val + alignment - 1) & ~(alignment - 1);
         }
 
+        // NOTE: Gribb-Hartmann, world space planes(xyz - normal pointing inside, w - distance) out of clip space conditions
+        // -w <= x <= w, -w <= y <= w, 0 <= z <= w, so it works for both regular and reversed depth.
+        NODISCARD static std::array<glm::vec4, 6> ExtractFrustumPlanes(const glm::mat4& viewProjectionMatrix) noexcept
+        {
+            const glm::mat4 m = glm::transpose(viewProjectionMatrix);  // Rows of the original matrix.
+
+            std::array<glm::vec4, 6> planes = {m[3] + m[0], m[3] - m[0], m[3] + m[1], m[3] - m[1], m[2], m[3] - m[2]};
+            for (auto& plane : planes)
+                plane /= glm::length(glm::vec3(plane));
+
+            return planes;
+        }
+
     }  // namespace Math
 
 }  // namespace Radiant
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Core/Core.hpp>
+#include <span>
+
+namespace Radiant
+{
+
+    // NOTE: CPU-only part of in-place bindless updates, knows nothing about descriptors, so it can be fed with simulated updates.
+    // Update written into current frame's descriptors right away has to be repeated for every other buffered frame once its slot
+    // comes around(frames in flight still read the old one). TUpdate needs BindlessID and Binding members. Not thread-safe.
+    template <typename TUpdate, u8 FrameCount> class BindlessUpdateQueue final : private Uncopyable, private Unmovable
+    {
+      public:
+        constexpr BindlessUpdateQueue() noexcept = default;
+        ~BindlessUpdateQueue() noexcept          = default;
+
+        // Queues update for every buffered frame except the current one.
+        void Push(const TUpdate& update, const u8 currentFrameIndex) noexcept
+        {
+            for (u8 frame{}; frame < FrameCount; ++frame)
+            {
+                if (frame == currentFrameIndex) continue;
+                m_PendingUpdatesPerFrame[frame].emplace_back(update);
+            }
+        }
+
+        // NOTE: Has to be called before ID is released, otherwise once it's handed out again, stale update would overwrite the new
+        // descriptor(and reference already destroyed view).
+        void Remove(const u32 bindlessID, const u32 binding) noexcept
+        {
+            for (auto& pendingUpdates : m_PendingUpdatesPerFrame)
+                std::erase_if(pendingUpdates, [&](const TUpdate& update)
+                              { return update.BindlessID == bindlessID && update.Binding == binding; });
+        }
+
+        NODISCARD FORCEINLINE std::span<const TUpdate> Get(const u8 frameIndex) const noexcept
+        {
+            return m_PendingUpdatesPerFrame[frameIndex];
+        }
+        FORCEINLINE void Clear(const u8 frameIndex) noexcept { m_PendingUpdatesPerFrame[frameIndex].clear(); }
+
+      private:
+        std::array<std::vector<TUpdate>, FrameCount> m_PendingUpdatesPerFrame{};
+    };
+
+}  // namespace Radiant
@@ -15,6 +15,8 @@ namespace Radiant
     static constexpr bool s_bForceGfxValidation        = false;
     static constexpr bool s_bUseTextureCompressionBC   = true;
     static constexpr bool s_bShaderDebugPrintf         = false;  // it disables performance metrics for NSight!
+    static constexpr bool s_bUseTextureStreaming       = s_bUseTextureCompressionBC;  // Streams prebaked BCn mips only.
+    static constexpr bool s_bUseDescriptorBuffer       = true;  // Bindless through VK_EXT_descriptor_buffer if supported, sets otherwise.
 
     static constexpr bool s_bRequireRayTracing  = false;
     static constexpr bool s_bRequireMeshShading = false;
@@ -83,4 +85,14 @@ namespace Radiant
                            // the background using the normal painting operation (i.e. the Porter and Duff over operator).
     };
 
+    // NOTE: 32-bit scalar(uint/int/bool/float bits) only, shader declares it as [vk::constant_id(ID)] global. Resolved at pipeline
+    // creation, so variants share the same SPIR-V(and shader cache entry), workgroup size can be one of them too([numthreads()] of
+    // such constants is emitted as LocalSizeId).
+    struct GfxSpecializationConstant
+    {
+        u32 ID{0};
+        u32 Value{0};
+    };
+    using GfxSpecializationConstants = std::vector<GfxSpecializationConstant>;
+
 }  // namespace Radiant
@@ -0,0 +1,40 @@
+#include "DownsamplePlanner.hpp"
+
+namespace Radiant
+{
+
+    namespace DownsamplePlanner
+    {
+
+        std::vector<DownsampleDispatch> PlanDispatches(const glm::uvec2& srcDimensions, const u32 mipCount) noexcept
+        {
+            std::vector<DownsampleDispatch> dispatches{};
+            u32 srcMip{0};
+            while (srcMip < mipCount)
+            {
+                const auto mipDimensions      = GetMipDimensions(srcDimensions, srcMip);
+                const bool bFitsLastWorkGroup = glm::max(mipDimensions.x, mipDimensions.y) <= SPD_TILE_SIZE * SPD_TILE_SIZE;
+                const u32 maxDispatchMipCount = glm::min(mipCount - srcMip, bFitsLastWorkGroup ? SPD_MAX_MIP_COUNT : s_SharedMipCount);
+
+                // Mips read from memory(first one and mip 6) handle odd sizes, groupshared ones are 2x2 footprints only, so odd sized mip
+                // ends the dispatch.
+                u32 dispatchMipCount{1};
+                while (dispatchMipCount < maxDispatchMipCount)
+                {
+                    const auto dimensions = GetMipDimensions(srcDimensions, srcMip + dispatchMipCount);
+                    if (dispatchMipCount != s_SharedMipCount && ((dimensions.x & 1) != 0 || (dimensions.y & 1) != 0)) break;
+
+                    ++dispatchMipCount;
+                }
+
+                dispatches.emplace_back(srcMip, dispatchMipCount, mipDimensions,
+                                        (mipDimensions + glm::uvec2(SPD_TILE_SIZE - 1)) / glm::uvec2(SPD_TILE_SIZE));
+                srcMip += dispatchMipCount;
+            }
+
+            return dispatches;
+        }
+
+    }  // namespace DownsamplePlanner
+
+}  // namespace Radiant
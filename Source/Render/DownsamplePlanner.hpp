@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+#include <mip_building_defines.hpp>
+
+namespace Radiant
+{
+
+    // NOTE: CPU-only part of GfxDownsampler, splits mip chain into dispatches of mip_building.slang, so it can be checked without GPU.
+    namespace DownsamplePlanner
+    {
+
+        // NOTE: Past mip 6 the last workgroup reduces everything alone, it sees at most SPD_TILE_SIZE^2 texels of mip 6.
+        static constexpr u32 s_SharedMipCount = 6;
+
+        struct DownsampleDispatch final
+        {
+            u32 SrcMip{0};    // Relative to downsample source, dispatch writes mips [SrcMip + 1, SrcMip + MipCount].
+            u32 MipCount{0};  // Up to SPD_MAX_MIP_COUNT.
+            glm::uvec2 SrcDimensions{1};
+            glm::uvec2 WorkGroupCount{1};
+        };
+
+        NODISCARD FORCEINLINE static glm::uvec2 GetMipDimensions(const glm::uvec2& srcDimensions, const u32 mipLevel) noexcept
+        {
+            return glm::max(srcDimensions >> mipLevel, glm::uvec2(1));
+        }
+
+        // Every dispatch starts from the last mip of the previous one, mipCount doesn't count the source.
+        NODISCARD std::vector<DownsampleDispatch> PlanDispatches(const glm::uvec2& srcDimensions, const u32 mipCount) noexcept;
+
+    }  // namespace DownsamplePlanner
+
+}  // namespace Radiant
@@ -65,6 +65,9 @@ namespace Radiant
             return m_BDA.value();
         }
 
+        // NOTE: Valid only for HOST buffers, used for CPU readback.
+        NODISCARD FORCEINLINE void* GetMapped() const noexcept { return m_Mapped; }
+
         void SetData(const void* data, const u64 dataSize) noexcept
         {
             if (!m_Mapped) return;
@@ -173,6 +173,10 @@ namespace Radiant
         // NOTE: Reset all states only after every GPU op finished!
 
         m_Device->PollDeletionQueues();
+        m_Device->FlushBindlessWrites();
+        m_Device->FlushPendingBindlessUpdates();
+        m_TextureStreamer->Update(m_CurrentFrameIndex, m_GlobalFrameNumber);
+        m_ShaderHotReloader->Update();
 
         m_Device->GetLogicalDevice()->resetCommandPool(*currentFrameData.GeneralCommandPoolVK);
         m_Device->GetLogicalDevice()->resetCommandPool(*currentFrameData.AsyncComputeCommandPoolVK);
@@ -206,6 +210,7 @@ namespace Radiant
                 prevFrameGPUProfilerData[taskIndex].EndTime =
                     (currentFrameData.TimestampResults[timestampIndex + 1] - currentFrameData.TimestampResults[0]) * frequencyFactor;
             }
+            m_KernelAutotuner->Update(prevFrameGPUProfilerData);
         }
         currentFrameData.CurrentTimestampIndex = 0;
 
@@ -472,11 +477,31 @@ namespace Radiant
             executionContext.CommandBuffer.end();
             SubmitImmediateExecuteContext(executionContext);
         }
+
+        if (m_Device->IsGraphicsPipelineLibrarySupported()) m_PipelineLibraryCache = MakeUnique<GfxPipelineLibraryCache>();
+        m_ShaderHotReloader = MakeUnique<GfxShaderHotReloader>();
+        m_PipelineManifest  = MakeUnique<GfxPipelineManifest>(m_Device);
+        m_PipelineManifest->WarmUp();
+        m_KernelAutotuner = MakeUnique<GfxKernelAutotuner>(
+            GfxKernelAutotuner::GetFileName(m_Device->GetGPUProperties().vendorID, m_Device->GetGPUProperties().deviceID),
+            Application::Get().HasCommandLineArgument("--autotune-kernels"));
+
+        m_TextureStreamer = MakeUnique<GfxTextureStreamer>(m_Device);
+        m_Downsampler     = MakeUnique<GfxDownsampler>(m_Device);
+        m_GeometryPool    = MakeUnique<GfxGeometryPool>(m_Device);
     }
 
     void GfxContext::Shutdown() noexcept
     {
         LOG_INFO("{}", __FUNCTION__);
+
+        // NOTE: Geometry pool frees are deferred through device deletion queues and capture the pool, so they're flushed while it's alive.
+        m_Device->WaitIdle();
+        m_Device->PollDeletionQueues(true);
+        m_GeometryPool.reset();
+        m_PipelineManifest.reset();
+        m_PipelineLibraryCache.reset();
+        m_KernelAutotuner.reset();
     }
 
     void GfxContext::InvalidateSwapchain() noexcept
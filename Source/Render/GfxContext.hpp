@@ -15,6 +15,11 @@
 
 // NOTE: Including device first place ruins surface creation!
 #include <Render/GfxDevice.hpp>
+#include <Render/GfxTextureStreamer.hpp>
+#include <Render/GfxDownsampler.hpp>
+#include <Render/GfxGeometryPool.hpp>
+#include <Render/GfxKernelAutotuner.hpp>
+#include <Render/GfxShaderHotReloader.hpp>
 
 namespace Radiant
 {
@@ -159,6 +164,13 @@ namespace Radiant
         NODISCARD FORCEINLINE const auto& GetInstance() const noexcept { return m_Instance; }
         NODISCARD FORCEINLINE auto& GetDevice() const noexcept { return m_Device; }
         NODISCARD FORCEINLINE auto& GetDefaultWhiteTexture() const noexcept { return m_DefaultWhiteTexture; }
+        NODISCARD FORCEINLINE auto& GetTextureStreamer() const noexcept { return m_TextureStreamer; }
+        NODISCARD FORCEINLINE auto& GetDownsampler() const noexcept { return m_Downsampler; }
+        NODISCARD FORCEINLINE auto& GetGeometryPool() const noexcept { return m_GeometryPool; }
+        NODISCARD FORCEINLINE auto& GetPipelineManifest() const noexcept { return m_PipelineManifest; }
+        NODISCARD FORCEINLINE auto& GetPipelineLibraryCache() const noexcept { return m_PipelineLibraryCache; }
+        NODISCARD FORCEINLINE auto& GetKernelAutotuner() const noexcept { return m_KernelAutotuner; }
+        NODISCARD FORCEINLINE auto& GetShaderHotReloader() const noexcept { return m_ShaderHotReloader; }
 
         NODISCARD FORCEINLINE const auto GetSwapchainImageFormat() const noexcept { return m_SwapchainImageFormat; }
         NODISCARD FORCEINLINE const auto& GetSwapchainExtent() const noexcept { return m_SwapchainExtent; }
@@ -239,6 +251,7 @@ namespace Radiant
                 }
             }
             RDNT_ASSERT(queue, "Failed to retreive queue!");
+            m_Device->FlushBindlessWrites();           // Registrations made while recording.
             std::scoped_lock lock(queue->QueueMutex);  // Synchronizing access to single queue
 
             // Creating temporary fence to avoid stalling the whole command queue.
@@ -273,7 +286,14 @@ namespace Radiant
         vk::UniqueDebugUtilsMessengerEXT m_DebugUtilsMessenger{};
 
         Unique<GfxDevice> m_Device{nullptr};
+        Unique<GfxShaderHotReloader> m_ShaderHotReloader{nullptr};  // Outlives context-owned pipelines, they forget themselves on destroy.
         Shared<GfxTexture> m_DefaultWhiteTexture{nullptr};
+        Unique<GfxTextureStreamer> m_TextureStreamer{nullptr};
+        Unique<GfxDownsampler> m_Downsampler{nullptr};
+        Unique<GfxGeometryPool> m_GeometryPool{nullptr};
+        Unique<GfxPipelineManifest> m_PipelineManifest{nullptr};
+        Unique<GfxPipelineLibraryCache> m_PipelineLibraryCache{nullptr};  // Set only if VK_EXT_graphics_pipeline_library is supported.
+        Unique<GfxKernelAutotuner> m_KernelAutotuner{nullptr};
 
         struct FrameData
         {
@@ -51,6 +51,7 @@ namespace Radiant
                                 .setDynamicRendering(vk::True)
                                 .setSynchronization2(vk::True)
                                 .setShaderDemoteToHelperInvocation(vk::True)  // NOTE: Fucking slang requires it
+                                .setPipelineCreationCacheControl(vk::True)    // Probing pipeline cache to detect misses.
                                 .setMaintenance4(vk::True);
 
         // The train starts here...
@@ -66,6 +67,7 @@ namespace Radiant
                 .setTimelineSemaphore(vk::True)
                 .setHostQueryReset(vk::True)
                 .setSamplerFilterMinmax(vk::True)
+                .setDrawIndirectCount(vk::True)  // GPU-driven rendering: draw count comes from the culling compute pass.
                 .setDescriptorIndexing(vk::True)
                 .setDescriptorBindingPartiallyBound(vk::True)
                 .setDescriptorBindingSampledImageUpdateAfterBind(vk::True)
@@ -122,12 +124,15 @@ namespace Radiant
                                                                 .setShaderInt64(vk::True)
                                                                 .setFillModeNonSolid(vk::True)
                                                                 .setMultiDrawIndirect(vk::True)
+                                                                .setDrawIndirectFirstInstance(vk::True)
                                                                 .setSamplerAnisotropy(vk::True)
                                                                 .setPipelineStatisticsQuery(vk::True)
                                                                 .setDepthClamp(vk::True)
                                                                 .setGeometryShader(vk::True)
                                                                 .setTextureCompressionBC(s_bUseTextureCompressionBC ? vk::True : vk::False)
                                                                 .setShaderStorageImageArrayDynamicIndexing(vk::True)
+                                                                .setShaderStorageImageReadWithoutFormat(vk::True)
+                                                                .setShaderStorageImageWriteWithoutFormat(vk::True)
                                                                 .setShaderSampledImageArrayDynamicIndexing(vk::True);
         SelectGPUAndCreateDeviceThings(instance, surface, requiredDeviceExtensions, vkFeatures10, &vkFeatures13);
 
@@ -168,6 +173,54 @@ namespace Radiant
                     m_bMemoryPrioritySupported = true;
                 }
 
+                // NOTE: Without fast linking libraries don't pay off, monolithic pipelines are used then(e.g. some lavapipe versions).
+                if (std::ranges::find_if(supportedDeviceExtensions,
+                                         [](const vk::ExtensionProperties& deviceExtension) {
+                                             return strcmp(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME,
+                                                           deviceExtension.extensionName) == 0;
+                                         }) != supportedDeviceExtensions.end() &&
+                    std::ranges::find_if(supportedDeviceExtensions, [](const vk::ExtensionProperties& deviceExtension)
+                                         { return strcmp(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, deviceExtension.extensionName) == 0; }) !=
+                        supportedDeviceExtensions.end())
+                {
+                    auto graphicsPipelineLibraryFeatures = vk::PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT();
+                    auto gpuFeatures2                    = vk::PhysicalDeviceFeatures2().setPNext(&graphicsPipelineLibraryFeatures);
+                    gpu.getFeatures2(&gpuFeatures2);
+
+                    auto graphicsPipelineLibraryProperties = vk::PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT();
+                    auto gpuProperties2                    = vk::PhysicalDeviceProperties2().setPNext(&graphicsPipelineLibraryProperties);
+                    gpu.getProperties2(&gpuProperties2);
+
+                    if (graphicsPipelineLibraryFeatures.graphicsPipelineLibrary &&
+                        graphicsPipelineLibraryProperties.graphicsPipelineLibraryFastLinking)
+                    {
+                        requiredDeviceExtensions.emplace_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+                        requiredDeviceExtensions.emplace_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+                        m_bGraphicsPipelineLibrarySupported = true;
+                    }
+                }
+                LOG_INFO("Graphics pipeline library: {}", m_bGraphicsPipelineLibrarySupported ? "ON" : "OFF(monolithic pipelines)");
+
+                if (s_bUseDescriptorBuffer &&
+                    std::ranges::find_if(supportedDeviceExtensions, [](const vk::ExtensionProperties& deviceExtension)
+                                         { return strcmp(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, deviceExtension.extensionName) == 0; }) !=
+                        supportedDeviceExtensions.end())
+                {
+                    auto descriptorBufferFeatures = vk::PhysicalDeviceDescriptorBufferFeaturesEXT();
+                    auto gpuFeatures2             = vk::PhysicalDeviceFeatures2().setPNext(&descriptorBufferFeatures);
+                    gpu.getFeatures2(&gpuFeatures2);
+
+                    auto gpuProperties2 = vk::PhysicalDeviceProperties2().setPNext(&m_DescriptorBufferProperties);
+                    gpu.getProperties2(&gpuProperties2);
+
+                    if (descriptorBufferFeatures.descriptorBuffer)
+                    {
+                        requiredDeviceExtensions.emplace_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+                        m_bDescriptorBufferSupported = true;
+                    }
+                }
+                LOG_INFO("Bindless backend: {}", m_bDescriptorBufferSupported ? "descriptor buffer" : "descriptor sets");
+
                 for (const auto& rde : requiredDeviceExtensions)
                 {
                     const bool bExtensionFound = std::ranges::find_if(supportedDeviceExtensions,
@@ -288,6 +341,15 @@ namespace Radiant
             queuesCI.emplace_back().setQueuePriorities(queuePriorities).setQueueCount(queueCount).setQueueFamilyIndex(queueFamily);
         }
 
+        // Optional features are known only after GPU is chosen, so they're prepended to the train.
+        auto graphicsPipelineLibraryFeaturesEXT =
+            vk::PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT().setGraphicsPipelineLibrary(vk::True).setPNext(const_cast<void*>(pNext));
+        if (m_bGraphicsPipelineLibrarySupported) pNext = &graphicsPipelineLibraryFeaturesEXT;
+
+        auto descriptorBufferFeaturesEXT =
+            vk::PhysicalDeviceDescriptorBufferFeaturesEXT().setDescriptorBuffer(vk::True).setPNext(const_cast<void*>(pNext));
+        if (m_bDescriptorBufferSupported) pNext = &descriptorBufferFeaturesEXT;
+
         const auto logicalDeviceCI = vk::DeviceCreateInfo()
                                          .setPEnabledFeatures(&requiredDeviceFeatures)
                                          .setQueueCreateInfos(queuesCI)
@@ -420,18 +482,20 @@ namespace Radiant
                 .setStageFlags(vk::ShaderStageFlagBits::eAll)
                 .setDescriptorType(vk::DescriptorType::eSampler)};
 
-        constexpr std::array<vk::DescriptorBindingFlags, 4> bindingFlags{
-            vk::FlagTraits<vk::DescriptorBindingFlagBits>::allFlags ^ vk::DescriptorBindingFlagBits::eVariableDescriptorCount,
-            vk::FlagTraits<vk::DescriptorBindingFlagBits>::allFlags ^ vk::DescriptorBindingFlagBits::eVariableDescriptorCount,
-            vk::FlagTraits<vk::DescriptorBindingFlagBits>::allFlags ^ vk::DescriptorBindingFlagBits::eVariableDescriptorCount,
-            vk::FlagTraits<vk::DescriptorBindingFlagBits>::allFlags ^ vk::DescriptorBindingFlagBits::eVariableDescriptorCount};
+        // NOTE: Descriptor buffers have no update-after-bind flags, descriptors are plain memory there.
+        const vk::DescriptorBindingFlags bindingFlag =
+            m_bDescriptorBufferSupported
+                ? vk::DescriptorBindingFlagBits::ePartiallyBound
+                : vk::FlagTraits<vk::DescriptorBindingFlagBits>::allFlags ^ vk::DescriptorBindingFlagBits::eVariableDescriptorCount;
+        const std::array<vk::DescriptorBindingFlags, 4> bindingFlags{bindingFlag, bindingFlag, bindingFlag, bindingFlag};
         const auto megaSetLayoutExtendedInfo = vk::DescriptorSetLayoutBindingFlagsCreateInfo().setBindingFlags(bindingFlags);
 
-        m_DescriptorSetLayout =
-            m_Device->createDescriptorSetLayoutUnique(vk::DescriptorSetLayoutCreateInfo()
-                                                          .setBindings(bindings)
-                                                          .setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
-                                                          .setPNext(&megaSetLayoutExtendedInfo));
+        m_DescriptorSetLayout = m_Device->createDescriptorSetLayoutUnique(
+            vk::DescriptorSetLayoutCreateInfo()
+                .setBindings(bindings)
+                .setFlags(m_bDescriptorBufferSupported ? vk::DescriptorSetLayoutCreateFlagBits::eDescriptorBufferEXT
+                                                       : vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
+                .setPNext(&megaSetLayoutExtendedInfo));
         SetDebugName("RDNT_BINDLESS_DESCRIPTOR_LAYOUT", *m_DescriptorSetLayout);
 
         m_PipelineLayout = m_Device->createPipelineLayoutUnique(
@@ -443,6 +507,12 @@ namespace Radiant
                                            .setStageFlags(vk::ShaderStageFlagBits::eAll)));
         SetDebugName("RDNT_BINDLESS_PIPELINE_LAYOUT", *m_PipelineLayout);
 
+        if (m_bDescriptorBufferSupported)
+        {
+            CreateBindlessDescriptorBuffer();
+            return;
+        }
+
         constexpr std::array<vk::DescriptorPoolSize, 4> poolSizes{
             vk::DescriptorPoolSize().setDescriptorCount(Shaders::s_MAX_BINDLESS_STORAGE_IMAGES).setType(vk::DescriptorType::eStorageImage),
             vk::DescriptorPoolSize()
@@ -471,6 +541,124 @@ namespace Radiant
         }
     }
 
+    void GfxDevice::CreateBindlessDescriptorBuffer() noexcept
+    {
+        auto& descriptorBuffer = m_BindlessDescriptorBuffer;
+        descriptorBuffer.FrameStride =
+            CoreUtils::AlignSize(m_Device->getDescriptorSetLayoutSizeEXT(*m_DescriptorSetLayout),
+                                 m_DescriptorBufferProperties.descriptorBufferOffsetAlignment);
+        for (u32 binding{}; binding < descriptorBuffer.BindingOffsets.size(); ++binding)
+            descriptorBuffer.BindingOffsets[binding] = m_Device->getDescriptorSetLayoutBindingOffsetEXT(*m_DescriptorSetLayout, binding);
+
+        const auto& properties = m_DescriptorBufferProperties;
+        auto& descriptorSizes  = descriptorBuffer.DescriptorSizes;
+        descriptorSizes[Shaders::s_BINDLESS_STORAGE_IMAGE_BINDING]          = properties.storageImageDescriptorSize;
+        descriptorSizes[Shaders::s_BINDLESS_COMBINED_IMAGE_SAMPLER_BINDING] = properties.combinedImageSamplerDescriptorSize;
+        descriptorSizes[Shaders::s_BINDLESS_SAMPLED_IMAGE_BINDING]          = properties.sampledImageDescriptorSize;
+        descriptorSizes[Shaders::s_BINDLESS_SAMPLER_BINDING]                = properties.samplerDescriptorSize;
+
+        // Set holds both samplers and resources, so buffer is bound as both and has to fit both ranges.
+        const vk::DeviceSize bufferSize = descriptorBuffer.FrameStride * s_BufferedFrameCount;
+        RDNT_ASSERT(bufferSize <= properties.maxSamplerDescriptorBufferRange && bufferSize <= properties.maxResourceDescriptorBufferRange,
+                    "Bindless descriptor buffer is too big: {} bytes!", bufferSize);
+
+        AllocateBuffer(EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT,
+                       vk::BufferCreateInfo()
+                           .setSize(bufferSize)
+                           .setUsage(vk::BufferUsageFlagBits::eResourceDescriptorBufferEXT |
+                                     vk::BufferUsageFlagBits::eSamplerDescriptorBufferEXT | vk::BufferUsageFlagBits::eShaderDeviceAddress)
+                           .setSharingMode(vk::SharingMode::eExclusive),
+                       (VkBuffer&)descriptorBuffer.Handle, descriptorBuffer.Allocation);
+        SetDebugName("RDNT_BINDLESS_DESCRIPTOR_BUFFER", descriptorBuffer.Handle);
+
+        descriptorBuffer.Mapped  = static_cast<u8*>(Map(descriptorBuffer.Allocation));
+        descriptorBuffer.Address = m_Device->getBufferAddress(vk::BufferDeviceAddressInfo().setBuffer(descriptorBuffer.Handle));
+        std::memset(descriptorBuffer.Mapped, 0, bufferSize);
+
+        LOG_INFO("Bindless descriptor buffer: {:.3f} MB, {} bytes per frame.", bufferSize / 1024.0f / 1024.0f,
+                 descriptorBuffer.FrameStride);
+    }
+
+    void GfxDevice::WriteBindlessDescriptors(const std::span<const PendingBindlessUpdate> updates,
+                                             const std::optional<u8> frameIndex) noexcept
+    {
+        const u8 firstFrame = frameIndex.value_or(0);
+        const u8 lastFrame  = frameIndex.has_value() ? *frameIndex : s_BufferedFrameCount - 1;
+        if (!m_bDescriptorBufferSupported)
+        {
+            std::vector<vk::WriteDescriptorSet> writes{};
+            writes.reserve(updates.size() * (lastFrame - firstFrame + 1));
+            for (const auto& update : updates)
+            {
+                for (u8 frame{firstFrame}; frame <= lastFrame; ++frame)
+                {
+                    writes.emplace_back(vk::WriteDescriptorSet()
+                                            .setDescriptorCount(1)
+                                            .setDescriptorType(GetBindlessDescriptorType(update.Binding))
+                                            .setDstArrayElement(update.BindlessID)
+                                            .setDstBinding(update.Binding)
+                                            .setDstSet(m_BindlessResourcesPerFrame[frame].DescriptorSet)
+                                            .setImageInfo(update.ImageInfo));
+                }
+            }
+
+            m_Device->updateDescriptorSets(writes, {});
+            return;
+        }
+
+        const auto& descriptorBuffer = m_BindlessDescriptorBuffer;
+        for (const auto& update : updates)
+        {
+            const auto descriptorType = GetBindlessDescriptorType(update.Binding);
+            auto descriptorData       = vk::DescriptorDataEXT();
+            switch (descriptorType)
+            {
+                case vk::DescriptorType::eSampler: descriptorData.setPSampler(&update.ImageInfo.sampler); break;
+                case vk::DescriptorType::eCombinedImageSampler: descriptorData.setPCombinedImageSampler(&update.ImageInfo); break;
+                case vk::DescriptorType::eSampledImage: descriptorData.setPSampledImage(&update.ImageInfo); break;
+                case vk::DescriptorType::eStorageImage: descriptorData.setPStorageImage(&update.ImageInfo); break;
+                default: RDNT_ASSERT(false, "Unknown bindless descriptor type!");
+            }
+
+            // Descriptor is fetched once and copied into every requested frame copy.
+            const u64 descriptorSize = descriptorBuffer.DescriptorSizes[update.Binding];
+            const u64 bindingOffset  = descriptorBuffer.BindingOffsets[update.Binding] + update.BindlessID * descriptorSize;
+            u8* firstDescriptor      = descriptorBuffer.Mapped + firstFrame * descriptorBuffer.FrameStride + bindingOffset;
+            m_Device->getDescriptorEXT(vk::DescriptorGetInfoEXT().setType(descriptorType).setData(descriptorData), descriptorSize,
+                                       firstDescriptor);
+            for (u8 frame = firstFrame + 1; frame <= lastFrame; ++frame)
+            {
+                std::memcpy(descriptorBuffer.Mapped + frame * descriptorBuffer.FrameStride + bindingOffset, firstDescriptor,
+                            descriptorSize);
+            }
+        }
+
+        // NOTE: No-op on coherent memory.
+        RDNT_ASSERT(vmaFlushAllocation(m_Allocator, descriptorBuffer.Allocation, 0, VK_WHOLE_SIZE) == VK_SUCCESS,
+                    "VMA: Failed to flush bindless descriptor buffer!");
+    }
+
+    void GfxDevice::BindBindlessResources(const vk::CommandBuffer& cmd, const vk::PipelineBindPoint pipelineBindPoint) noexcept
+    {
+        FlushBindlessWrites();
+
+        const auto currentFrameIndex = static_cast<u8>(m_CurrentFrameNumber % s_BufferedFrameCount);
+        if (!m_bDescriptorBufferSupported)
+        {
+            cmd.bindDescriptorSets(pipelineBindPoint, *m_PipelineLayout, 0, m_BindlessResourcesPerFrame[currentFrameIndex].DescriptorSet,
+                                   {});
+            return;
+        }
+
+        cmd.bindDescriptorBuffersEXT(vk::DescriptorBufferBindingInfoEXT()
+                                         .setAddress(m_BindlessDescriptorBuffer.Address)
+                                         .setUsage(vk::BufferUsageFlagBits::eResourceDescriptorBufferEXT |
+                                                   vk::BufferUsageFlagBits::eSamplerDescriptorBufferEXT));
+        const u32 bufferIndex{0};
+        const vk::DeviceSize bufferOffset = currentFrameIndex * m_BindlessDescriptorBuffer.FrameStride;
+        cmd.setDescriptorBufferOffsetsEXT(pipelineBindPoint, *m_PipelineLayout, 0, bufferIndex, bufferOffset);
+    }
+
     void GfxDevice::AllocateMemory(VmaAllocation& allocation, const vk::MemoryRequirements& finalMemoryRequirements,
                                    const vk::MemoryPropertyFlags preferredFlags) noexcept
     {
@@ -595,6 +783,12 @@ namespace Radiant
         for (auto& [samplerCI, samplerPair] : m_SamplerMap)
             PopBindlessThing(samplerPair.second, Shaders::s_BINDLESS_SAMPLER_BINDING);
 
+        if (m_BindlessDescriptorBuffer.Handle)
+        {
+            Unmap(m_BindlessDescriptorBuffer.Allocation);
+            DeallocateBuffer((VkBuffer&)m_BindlessDescriptorBuffer.Handle, m_BindlessDescriptorBuffer.Allocation);
+        }
+
         vmaDestroyAllocator(m_Allocator);
         CoreUtils::SaveData(s_PipelineCacheName, m_Device->getPipelineCacheData(*m_PipelineCache));
     }
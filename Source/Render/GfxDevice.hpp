@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Render/CoreDefines.hpp>
+#include <Render/BindlessUpdateQueue.hpp>
 #include <vulkan/vulkan.hpp>
 
 #define VK_NO_PROTOTYPES
@@ -172,6 +173,7 @@ namespace Radiant
 
         NODISCARD FORCEINLINE auto& GetBindlessPipelineLayout() const noexcept { return *m_PipelineLayout; }
         FORCEINLINE const auto GetMSAASamples() const noexcept { return m_MSAASamples; }
+        NODISCARD FORCEINLINE bool IsGraphicsPipelineLibrarySupported() const noexcept { return m_bGraphicsPipelineLibrarySupported; }
 
         void PushBindlessThing(const vk::DescriptorImageInfo& imageInfo, std::optional<u32>& bindlessID, const u32 binding) noexcept
         {
@@ -188,27 +190,56 @@ namespace Radiant
 
             bindlessID = static_cast<u32>(m_BindlessThingsIDs[binding].Emplace(m_BindlessThingsIDs[binding].GetSize()));
 
-            const auto descriptorType =
-                (binding == Shaders::s_BINDLESS_STORAGE_IMAGE_BINDING)
-                    ? vk::DescriptorType::eStorageImage
-                    : (binding == Shaders::s_BINDLESS_SAMPLER_BINDING
-                           ? vk::DescriptorType::eSampler
-                           : (binding == Shaders::s_BINDLESS_SAMPLED_IMAGE_BINDING ? vk::DescriptorType::eSampledImage
-                                                                                   : vk::DescriptorType::eCombinedImageSampler));
+            // NOTE: ID is valid right away, descriptor itself is written by FlushBindlessWrites() along with the rest of the batch.
+            m_PendingBindlessWrites.emplace_back(imageInfo, *bindlessID, binding);
+            m_bHasPendingBindlessWrites.store(true, std::memory_order_release);
+        }
 
-            std::array<vk::WriteDescriptorSet, s_BufferedFrameCount> writes{};
-            for (u8 frame{}; frame < s_BufferedFrameCount; ++frame)
-            {
-                writes[frame] = vk::WriteDescriptorSet()
-                                    .setDescriptorCount(1)
-                                    .setDescriptorType(descriptorType)
-                                    .setDstArrayElement(*bindlessID)
-                                    .setDstBinding(binding)
-                                    .setDstSet(m_BindlessResourcesPerFrame[frame].DescriptorSet)
-                                    .setImageInfo(imageInfo);
-            }
+        // NOTE: Writes every registration since last flush into sets of all buffered frames with single updateDescriptorSets()(or
+        // straight into descriptor buffer). Called at frame begin, whenever bindless resources are bound and right before submits, so
+        // nothing reaches GPU with unwritten descriptors(every binding is UPDATE_AFTER_BIND, so writing after bind is fine).
+        void FlushBindlessWrites() noexcept
+        {
+            if (!m_bHasPendingBindlessWrites.load(std::memory_order_acquire)) return;
+
+            std::scoped_lock lock(m_BindlessThingsMtx);
+            FlushBindlessWritesLocked();
+        }
+
+        // NOTE: Rewrites descriptor in-place, so whoever references bindlessID(materials, etc.) stays valid. Used by texture streaming.
+        // Only current frame's set is written right away, sets of frames in flight are written once their frame slot comes around.
+        void UpdateBindlessThing(const vk::DescriptorImageInfo& imageInfo, const u32 bindlessID, const u32 binding) noexcept
+        {
+            std::scoped_lock lock(m_BindlessThingsMtx);
+            RDNT_ASSERT(binding == Shaders::s_BINDLESS_STORAGE_IMAGE_BINDING || binding == Shaders::s_BINDLESS_SAMPLER_BINDING ||
+                            binding == Shaders::s_BINDLESS_COMBINED_IMAGE_SAMPLER_BINDING ||
+                            binding == Shaders::s_BINDLESS_SAMPLED_IMAGE_BINDING,
+                        "Unknown binding!");
+
+            if (binding != Shaders::s_BINDLESS_SAMPLER_BINDING) RDNT_ASSERT(imageInfo.imageView, "ImageView is invalid!");
+            if (binding == Shaders::s_BINDLESS_SAMPLER_BINDING || binding == Shaders::s_BINDLESS_COMBINED_IMAGE_SAMPLER_BINDING)
+                RDNT_ASSERT(imageInfo.sampler, "Sampler is invalid!");
+
+            // Pending registration of the same ID would overwrite this update otherwise.
+            FlushBindlessWritesLocked();
+
+            const auto currentFrameIndex = static_cast<u8>(m_CurrentFrameNumber % s_BufferedFrameCount);
+            const PendingBindlessUpdate update{.ImageInfo = imageInfo, .BindlessID = bindlessID, .Binding = binding};
+            WriteBindlessDescriptors({&update, 1}, currentFrameIndex);
 
-            m_Device->updateDescriptorSets(writes, {});
+            m_PendingBindlessUpdates.Push(update, currentFrameIndex);
+        }
+
+        // NOTE: Should be called once frame slot's fence was waited.
+        void FlushPendingBindlessUpdates() noexcept
+        {
+            std::scoped_lock lock(m_BindlessThingsMtx);
+            const auto currentFrameIndex = static_cast<u8>(m_CurrentFrameNumber % s_BufferedFrameCount);
+            const auto pendingUpdates    = m_PendingBindlessUpdates.Get(currentFrameIndex);
+            if (pendingUpdates.empty()) return;
+
+            WriteBindlessDescriptors(pendingUpdates, currentFrameIndex);
+            m_PendingBindlessUpdates.Clear(currentFrameIndex);
         }
 
         void PopBindlessThing(std::optional<u32>& bindlessID, const u32 binding) noexcept
@@ -219,13 +250,22 @@ namespace Radiant
                             binding == Shaders::s_BINDLESS_SAMPLED_IMAGE_BINDING,
                         "Unknown binding!");
             RDNT_ASSERT(bindlessID.has_value(), "BindlessID is invalid!");
+
+            // Released ID can be handed out again before next flush, its stale write mustn't land after the new one.
+            FlushBindlessWritesLocked();
+            m_PendingBindlessUpdates.Remove(*bindlessID, binding);
             m_BindlessThingsIDs[binding].Release(static_cast<PoolID>(*bindlessID));
             bindlessID = std::nullopt;
         }
 
-        NODISCARD FORCEINLINE auto& GetCurrentFrameBindlessResources() const noexcept
+        // NOTE: Binds current frame's bindless descriptors(set or descriptor buffer range) at set 0 of bindless pipeline layout.
+        void BindBindlessResources(const vk::CommandBuffer& cmd, const vk::PipelineBindPoint pipelineBindPoint) noexcept;
+
+        NODISCARD FORCEINLINE bool IsDescriptorBufferUsed() const noexcept { return m_bDescriptorBufferSupported; }
+        NODISCARD FORCEINLINE vk::PipelineCreateFlags GetExtraPipelineCreateFlags() const noexcept
         {
-            return m_BindlessResourcesPerFrame[m_CurrentFrameNumber % s_BufferedFrameCount];
+            // Pipelines that read descriptors from descriptor buffers have to be created with this flag.
+            return m_bDescriptorBufferSupported ? vk::PipelineCreateFlagBits::eDescriptorBufferEXT : vk::PipelineCreateFlags{};
         }
 
         NODISCARD auto GetBindlessStatistics() const noexcept
@@ -243,6 +283,9 @@ namespace Radiant
         vk::PhysicalDevice m_PhysicalDevice{};
         vk::PhysicalDeviceProperties m_GPUProperties{};
         bool m_bMemoryPrioritySupported{false};
+        bool m_bGraphicsPipelineLibrarySupported{false};
+        bool m_bDescriptorBufferSupported{false};
+        vk::PhysicalDeviceDescriptorBufferPropertiesEXT m_DescriptorBufferProperties{};
         u64 m_CurrentFrameNumber{0};
 
         // Bindless resources part1
@@ -252,7 +295,20 @@ namespace Radiant
             vk::UniqueDescriptorPool DescriptorPool{};
             vk::DescriptorSet DescriptorSet{};
         };
-        std::array<BindlessResources, s_BufferedFrameCount> m_BindlessResourcesPerFrame{};
+        std::array<BindlessResources, s_BufferedFrameCount> m_BindlessResourcesPerFrame{};  // Unused with descriptor buffer.
+
+        // NOTE: Alternative to descriptor sets, single host visible buffer, descriptors are written by index(ID -> byte offset). Every
+        // buffered frame has its own copy of the layout, so in-place updates(texture streaming) don't race frames in flight.
+        struct BindlessDescriptorBuffer
+        {
+            vk::Buffer Handle{};
+            VmaAllocation Allocation{};
+            u8* Mapped{nullptr};
+            vk::DeviceAddress Address{0};
+            vk::DeviceSize FrameStride{0};                   // Layout size aligned to descriptorBufferOffsetAlignment.
+            std::array<vk::DeviceSize, 4> BindingOffsets{};  // Indexed by binding.
+            std::array<u64, 4> DescriptorSizes{};            // Indexed by binding.
+        } m_BindlessDescriptorBuffer{};
 
         // Bindless resources part2
         vk::UniqueDescriptorSetLayout m_DescriptorSetLayout{};
@@ -261,6 +317,19 @@ namespace Radiant
         // Bindless resources part3
         std::array<Pool<u32>, 4> m_BindlessThingsIDs{};
 
+        struct PendingBindlessUpdate
+        {
+            vk::DescriptorImageInfo ImageInfo{};
+            u32 BindlessID{0};
+            u32 Binding{0};
+        };
+        BindlessUpdateQueue<PendingBindlessUpdate, s_BufferedFrameCount> m_PendingBindlessUpdates{};
+        std::vector<PendingBindlessUpdate> m_PendingBindlessWrites{};  // New registrations, go into sets of all buffered frames.
+        std::atomic<bool> m_bHasPendingBindlessWrites{false};
+
+        // NOTE: Into given buffered frame or all of them if frameIndex is empty, through the backend in use.
+        void WriteBindlessDescriptors(const std::span<const PendingBindlessUpdate> updates, const std::optional<u8> frameIndex) noexcept;
+
         vk::UniquePipelineCache m_PipelineCache{};
         mutable UnorderedMap<vk::SamplerCreateInfo, std::pair<vk::UniqueSampler, std::optional<u32>>> m_SamplerMap{};
 
@@ -348,6 +417,26 @@ namespace Radiant
         void InitVMA(const vk::UniqueInstance& instance) noexcept;
         void LoadPipelineCache() noexcept;
         void CreateBindlessSystem() noexcept;
+        void CreateBindlessDescriptorBuffer() noexcept;
+
+        NODISCARD FORCEINLINE static vk::DescriptorType GetBindlessDescriptorType(const u32 binding) noexcept
+        {
+            return (binding == Shaders::s_BINDLESS_STORAGE_IMAGE_BINDING)
+                       ? vk::DescriptorType::eStorageImage
+                       : (binding == Shaders::s_BINDLESS_SAMPLER_BINDING
+                              ? vk::DescriptorType::eSampler
+                              : (binding == Shaders::s_BINDLESS_SAMPLED_IMAGE_BINDING ? vk::DescriptorType::eSampledImage
+                                                                                      : vk::DescriptorType::eCombinedImageSampler));
+        }
+
+        void FlushBindlessWritesLocked() noexcept
+        {
+            if (m_PendingBindlessWrites.empty()) return;
+
+            WriteBindlessDescriptors(m_PendingBindlessWrites, std::nullopt);
+            m_PendingBindlessWrites.clear();
+            m_bHasPendingBindlessWrites.store(false, std::memory_order_release);
+        }
 
         void Shutdown() noexcept;
     };
@@ -0,0 +1,85 @@
+#include "GfxDownsampler.hpp"
+#include "DownsamplePlanner.hpp"
+
+#include <Render/GfxContext.hpp>
+#include <Render/GfxShader.hpp>
+
+namespace Radiant
+{
+
+    void GfxDownsampler::Init() noexcept
+    {
+        auto spdShader = MakeShared<GfxShader>(m_Device, GfxShaderDescription{.Path = "../Assets/Shaders/mip_building.slang"});
+        GfxPipelineDescription pipelineDesc = {
+            .DebugName = "SinglePassDownsampler", .PipelineOptions = GfxComputePipelineOptions{}, .Shader = spdShader};
+        m_Pipeline = MakeUnique<GfxPipeline>(m_Device, pipelineDesc);
+
+        m_AtomicCounterBuffer = MakeUnique<GfxBuffer>(
+            m_Device, GfxBufferDescription(sizeof(u32) * s_AtomicCounterCount, sizeof(u32), vk::BufferUsageFlagBits::eStorageBuffer,
+                                           EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+        m_Device->SetDebugName("SinglePassDownsamplerAtomicCounterBuffer", (const vk::Buffer&)*m_AtomicCounterBuffer);
+
+        // NOTE: Counters have to start from zero, afterwards the last workgroup of each dispatch resets its counter.
+        auto executionContext = GfxContext::Get().CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
+        executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+        executionContext.CommandBuffer.fillBuffer(*m_AtomicCounterBuffer, 0, vk::WholeSize, 0);
+        executionContext.CommandBuffer.end();
+        GfxContext::Get().SubmitImmediateExecuteContext(executionContext);
+    }
+
+    void GfxDownsampler::Dispatch(const vk::CommandBuffer& cmd, GfxPipelineStateCache& pipelineStateCache,
+                                  const GfxDownsampleDescription& downsampleDesc) noexcept
+    {
+        const auto mipCount = static_cast<u32>(downsampleDesc.DstMipTextureIDs.size());
+        RDNT_ASSERT(mipCount > 0, "GfxDownsampler: Nothing to downsample!");
+
+        pipelineStateCache.Bind(cmd, m_Pipeline.get());
+
+        struct PushConstantBlock
+        {
+            u64 AtomicCounter{0};
+            glm::uvec2 SrcDimensions{1};
+            u32 SrcTextureID{0};
+            u32 DstMip0TextureID{0};
+            u32 MipCount{0};
+            u32 WorkGroupCount{0};
+            u32 Reduction{SPD_REDUCTION_AVERAGE};
+            u32 bCopyMip0{0};
+            u32 bSrcIsStorageImage{0};
+            std::array<u32, SPD_MAX_MIP_COUNT> DstMipTextureIDs{};
+        };
+        static_assert(sizeof(PushConstantBlock) <= 128, "GfxDownsampler: PushConstantBlock exceeds guaranteed push constants size!");
+
+        for (const auto& dispatch : DownsamplePlanner::PlanDispatches(downsampleDesc.SrcDimensions, mipCount))
+        {
+            const u32 srcMip             = dispatch.SrcMip;
+            const u32 atomicCounterIndex = m_AtomicCounterIndex.fetch_add(1, std::memory_order_relaxed) % s_AtomicCounterCount;
+
+            PushConstantBlock pc  = {};
+            pc.AtomicCounter      = m_AtomicCounterBuffer->GetBDA() + sizeof(u32) * atomicCounterIndex;
+            pc.SrcDimensions      = dispatch.SrcDimensions;
+            pc.SrcTextureID       = srcMip == 0 ? downsampleDesc.SrcTextureID : downsampleDesc.DstMipTextureIDs[srcMip - 1];
+            pc.DstMip0TextureID   = downsampleDesc.DstMip0TextureID.value_or(0);
+            pc.MipCount           = dispatch.MipCount;
+            pc.WorkGroupCount     = dispatch.WorkGroupCount.x * dispatch.WorkGroupCount.y;
+            pc.Reduction          = static_cast<u32>(downsampleDesc.Reduction);
+            pc.bCopyMip0          = srcMip == 0 && downsampleDesc.DstMip0TextureID.has_value() ? 1 : 0;
+            pc.bSrcIsStorageImage = srcMip == 0 ? 0 : 1;
+            std::copy_n(downsampleDesc.DstMipTextureIDs.cbegin() + srcMip, dispatch.MipCount, pc.DstMipTextureIDs.begin());
+
+            if (srcMip != 0)
+            {
+                cmd.pipelineBarrier2(vk::DependencyInfo().setMemoryBarriers(
+                    vk::MemoryBarrier2()
+                        .setSrcAccessMask(vk::AccessFlagBits2::eShaderStorageWrite)
+                        .setSrcStageMask(vk::PipelineStageFlagBits2::eComputeShader)
+                        .setDstAccessMask(vk::AccessFlagBits2::eShaderStorageRead | vk::AccessFlagBits2::eShaderStorageWrite)
+                        .setDstStageMask(vk::PipelineStageFlagBits2::eComputeShader)));
+            }
+
+            cmd.pushConstants<PushConstantBlock>(m_Device->GetBindlessPipelineLayout(), vk::ShaderStageFlagBits::eAll, 0, pc);
+            cmd.dispatch(dispatch.WorkGroupCount.x, dispatch.WorkGroupCount.y, 1);
+        }
+    }
+
+}  // namespace Radiant
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+#include <Render/GfxBuffer.hpp>
+#include <Render/GfxPipeline.hpp>
+#include <mip_building_defines.hpp>
+
+namespace Radiant
+{
+
+    enum class EDownsampleReduction : u8
+    {
+        DOWNSAMPLE_REDUCTION_AVERAGE = SPD_REDUCTION_AVERAGE,
+        DOWNSAMPLE_REDUCTION_MIN     = SPD_REDUCTION_MIN,
+        DOWNSAMPLE_REDUCTION_MAX     = SPD_REDUCTION_MAX,
+    };
+
+    struct GfxDownsampleDescription
+    {
+        glm::uvec2 SrcDimensions{1};
+        u32 SrcTextureID{0};                                // Bindless combined image sampler in ShaderReadOnlyOptimal.
+        std::vector<u32> DstMipTextureIDs{};                // Bindless storage images in General, mips [1, N] relative to the source.
+        std::optional<u32> DstMip0TextureID{std::nullopt};  // Source gets copied into it, e.g. HZB mip 0 out of depth buffer.
+        EDownsampleReduction Reduction{EDownsampleReduction::DOWNSAMPLE_REDUCTION_AVERAGE};
+    };
+
+    // NOTE: Single pass downsampler(AMD FidelityFX SPD like), builds up to SPD_MAX_MIP_COUNT mips in one dispatch, see mip_building.slang.
+    // Chains with odd sized mips or sources larger than SPD_TILE_SIZE^2 are split into several dispatches, any chain is supported.
+    // Destination mips are written as float4 storage images, so their formats should be storage capable(no sRGB).
+    class GfxDevice;
+    struct GfxPipelineStateCache;
+    class GfxDownsampler final : private Uncopyable, private Unmovable
+    {
+      public:
+        GfxDownsampler(const Unique<GfxDevice>& device) noexcept : m_Device(device) { Init(); }
+        ~GfxDownsampler() noexcept = default;
+
+        // NOTE: Only records dispatches(and barriers between them), synchronization of source and destination mips is caller's job.
+        void Dispatch(const vk::CommandBuffer& cmd, GfxPipelineStateCache& pipelineStateCache,
+                      const GfxDownsampleDescription& downsampleDesc) noexcept;
+
+      private:
+        static constexpr u32 s_AtomicCounterCount = 64;  // Dispatches that aren't separated by barriers shouldn't share the counter.
+
+        const Unique<GfxDevice>& m_Device;
+        Unique<GfxPipeline> m_Pipeline{nullptr};
+        Unique<GfxBuffer> m_AtomicCounterBuffer{nullptr};
+        std::atomic<u32> m_AtomicCounterIndex{0};
+
+        constexpr GfxDownsampler() noexcept = delete;
+        void Init() noexcept;
+    };
+
+}  // namespace Radiant
@@ -0,0 +1,85 @@
+#include "GfxGeometryPool.hpp"
+
+#include <Render/GfxDevice.hpp>
+
+namespace Radiant
+{
+
+    void GfxGeometryAllocation::Release() noexcept
+    {
+        if (!m_Pool) return;
+
+        m_Pool->Free(m_Vertices, m_Indices);
+        m_Pool = nullptr;
+    }
+
+    void GfxGeometryPool::Init() noexcept
+    {
+        m_VertexPositionBuffer =
+            MakeShared<GfxBuffer>(m_Device, GfxBufferDescription(s_MaxVertexCount * sizeof(VertexPosition), sizeof(VertexPosition),
+                                                                 vk::BufferUsageFlagBits::eVertexBuffer,
+                                                                 EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+        m_Device->SetDebugName("RDNT_GEOMETRY_POOL_VERTEX_POSITIONS", (const vk::Buffer&)*m_VertexPositionBuffer);
+
+        if constexpr (QUANTIZE_VERTEX_POSITIONS)
+        {
+            m_DepthOnlyVertexPositionBuffer = MakeShared<GfxBuffer>(
+                m_Device, GfxBufferDescription(s_MaxVertexCount * sizeof(VertexPositionQuantized), sizeof(VertexPositionQuantized),
+                                               vk::BufferUsageFlagBits::eVertexBuffer,
+                                               EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+            m_Device->SetDebugName("RDNT_GEOMETRY_POOL_VERTEX_POSITIONS_QUANTIZED", (const vk::Buffer&)*m_DepthOnlyVertexPositionBuffer);
+        }
+        else
+            m_DepthOnlyVertexPositionBuffer = m_VertexPositionBuffer;
+
+        m_VertexAttributeBuffer =
+            MakeShared<GfxBuffer>(m_Device, GfxBufferDescription(s_MaxVertexCount * sizeof(VertexAttribute), sizeof(VertexAttribute),
+                                                                 vk::BufferUsageFlagBits::eVertexBuffer,
+                                                                 EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+        m_Device->SetDebugName("RDNT_GEOMETRY_POOL_VERTEX_ATTRIBUTES", (const vk::Buffer&)*m_VertexAttributeBuffer);
+
+        m_IndexBuffer = MakeShared<GfxBuffer>(m_Device, GfxBufferDescription(s_MaxIndexCount * sizeof(u32), sizeof(u32),
+                                                                             vk::BufferUsageFlagBits::eIndexBuffer,
+                                                                             EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+        m_Device->SetDebugName("RDNT_GEOMETRY_POOL_INDICES", (const vk::Buffer&)*m_IndexBuffer);
+    }
+
+    std::optional<GfxGeometryAllocation> GfxGeometryPool::Allocate(const u64 vertexCount, const u64 indexCount) noexcept
+    {
+        std::scoped_lock lock(m_Mtx);
+
+        const auto vertices = m_VertexAllocator.Allocate(vertexCount);
+        if (!vertices.has_value())
+        {
+            LOG_ERROR("GfxGeometryPool: Out of vertex space! Requested: {}, used: {}/{}, largest free block: {}", vertexCount,
+                      m_VertexAllocator.GetUsedSize(), m_VertexAllocator.GetCapacity(), m_VertexAllocator.GetLargestFreeBlockSize());
+            return std::nullopt;
+        }
+
+        const auto indices = m_IndexAllocator.Allocate(indexCount);
+        if (!indices.has_value())
+        {
+            LOG_ERROR("GfxGeometryPool: Out of index space! Requested: {}, used: {}/{}, largest free block: {}", indexCount,
+                      m_IndexAllocator.GetUsedSize(), m_IndexAllocator.GetCapacity(), m_IndexAllocator.GetLargestFreeBlockSize());
+
+            // NOTE: Vertex range was never handed out, so GPU can't be using it, no need to defer.
+            m_VertexAllocator.Free(*vertices);
+            return std::nullopt;
+        }
+
+        return GfxGeometryAllocation(this, *vertices, *indices);
+    }
+
+    void GfxGeometryPool::Free(const OffsetAllocator::Allocation& vertices, const OffsetAllocator::Allocation& indices) noexcept
+    {
+        // NOTE: Ranges can be still read by in-flight frames, so they're reused only after deletion queue flush.
+        m_Device->PushObjectToDelete(
+            [this, vertices, indices]() noexcept
+            {
+                std::scoped_lock lock(m_Mtx);
+                m_VertexAllocator.Free(vertices);
+                m_IndexAllocator.Free(indices);
+            });
+    }
+
+}  // namespace Radiant
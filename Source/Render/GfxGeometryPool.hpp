@@ -0,0 +1,113 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+#include <Render/GfxBuffer.hpp>
+#include <Render/OffsetAllocator.hpp>
+
+namespace Radiant
+{
+
+    struct GfxGeometryPoolStatistics
+    {
+        u64 UsedVertexCount{0};
+        u64 VertexCapacity{0};
+        u64 UsedIndexCount{0};
+        u64 IndexCapacity{0};
+        u64 FreeVertexBlockCount{0};
+        u64 FreeIndexBlockCount{0};
+    };
+
+    class GfxDevice;
+    class GfxGeometryPool;
+
+    // NOTE: Move-only handle of vertex and index ranges, returns them to the pool on destruction(deferred until GPU is done with them).
+    class GfxGeometryAllocation final : private Uncopyable
+    {
+      public:
+        GfxGeometryAllocation() noexcept = default;
+        GfxGeometryAllocation(GfxGeometryPool* pool, const OffsetAllocator::Allocation& vertices,
+                              const OffsetAllocator::Allocation& indices) noexcept
+            : m_Pool(pool), m_Vertices(vertices), m_Indices(indices)
+        {
+        }
+        ~GfxGeometryAllocation() noexcept { Release(); }
+
+        GfxGeometryAllocation(GfxGeometryAllocation&& other) noexcept
+            : m_Pool(std::exchange(other.m_Pool, nullptr)), m_Vertices(other.m_Vertices), m_Indices(other.m_Indices)
+        {
+        }
+        GfxGeometryAllocation& operator=(GfxGeometryAllocation&& other) noexcept
+        {
+            if (this == &other) return *this;
+
+            Release();
+            m_Pool     = std::exchange(other.m_Pool, nullptr);
+            m_Vertices = other.m_Vertices;
+            m_Indices  = other.m_Indices;
+            return *this;
+        }
+
+        NODISCARD FORCEINLINE auto GetVertexOffset() const noexcept { return m_Vertices.Offset; }
+        NODISCARD FORCEINLINE auto GetIndexOffset() const noexcept { return m_Indices.Offset; }
+
+      private:
+        GfxGeometryPool* m_Pool{nullptr};
+        OffsetAllocator::Allocation m_Vertices{};
+        OffsetAllocator::Allocation m_Indices{};
+
+        void Release() noexcept;
+    };
+
+    // NOTE: Single set of vertex position/attribute/index megabuffers shared by every loaded mesh, so passes bind geometry once and draws
+    // differ by offsets only. Vertex streams share one allocator since they're indexed by the same vertex offset. Buffers never grow,
+    // BDAs are baked into instance data, so running out of space fails the allocation and callers skip the geometry.
+    class GfxGeometryPool final : private Uncopyable, private Unmovable
+    {
+      public:
+        GfxGeometryPool(const Unique<GfxDevice>& device) noexcept
+            : m_Device(device), m_VertexAllocator(s_MaxVertexCount), m_IndexAllocator(s_MaxIndexCount)
+        {
+            Init();
+        }
+        ~GfxGeometryPool() noexcept = default;
+
+        NODISCARD std::optional<GfxGeometryAllocation> Allocate(const u64 vertexCount, const u64 indexCount) noexcept;
+
+        NODISCARD FORCEINLINE const auto& GetVertexPositionBuffer() const noexcept { return m_VertexPositionBuffer; }
+        NODISCARD FORCEINLINE const auto& GetDepthOnlyVertexPositionBuffer() const noexcept { return m_DepthOnlyVertexPositionBuffer; }
+        NODISCARD FORCEINLINE const auto& GetVertexAttributeBuffer() const noexcept { return m_VertexAttributeBuffer; }
+        NODISCARD FORCEINLINE const auto& GetIndexBuffer() const noexcept { return m_IndexBuffer; }
+
+        NODISCARD GfxGeometryPoolStatistics GetStatistics() const noexcept
+        {
+            std::scoped_lock lock(m_Mtx);
+            return GfxGeometryPoolStatistics{.UsedVertexCount      = m_VertexAllocator.GetUsedSize(),
+                                             .VertexCapacity       = m_VertexAllocator.GetCapacity(),
+                                             .UsedIndexCount       = m_IndexAllocator.GetUsedSize(),
+                                             .IndexCapacity        = m_IndexAllocator.GetCapacity(),
+                                             .FreeVertexBlockCount = m_VertexAllocator.GetFreeBlockCount(),
+                                             .FreeIndexBlockCount  = m_IndexAllocator.GetFreeBlockCount()};
+        }
+
+      private:
+        friend class GfxGeometryAllocation;
+
+        static constexpr u64 s_MaxVertexCount = 1ull << 22;
+        static constexpr u64 s_MaxIndexCount  = 1ull << 24;
+
+        const Unique<GfxDevice>& m_Device;
+        mutable std::mutex m_Mtx{};
+        OffsetAllocator m_VertexAllocator;
+        OffsetAllocator m_IndexAllocator;
+
+        Shared<GfxBuffer> m_VertexPositionBuffer{nullptr};
+        Shared<GfxBuffer> m_DepthOnlyVertexPositionBuffer{nullptr};  // Aliases m_VertexPositionBuffer unless positions are quantized.
+        Shared<GfxBuffer> m_VertexAttributeBuffer{nullptr};
+        Shared<GfxBuffer> m_IndexBuffer{nullptr};
+
+        constexpr GfxGeometryPool() noexcept = delete;
+        void Init() noexcept;
+        void Free(const OffsetAllocator::Allocation& vertices, const OffsetAllocator::Allocation& indices) noexcept;
+    };
+
+}  // namespace Radiant
@@ -0,0 +1,150 @@
+#include "GfxKernelAutotuner.hpp"
+
+#include <iomanip>
+
+namespace Radiant
+{
+
+    // NOTE: Plain text, pass and its best variant per line.
+    static constexpr u32 s_KernelAutotunerVersion = 1;
+
+    std::vector<u32> GfxKernelAutotuner::RegisterKernel(const std::string& passName, const std::vector<GfxKernelVariant>& variants) noexcept
+    {
+        RDNT_ASSERT(!variants.empty(), "Kernel [{}] has no variants!", passName);
+
+        KernelState kernelState{};
+        for (const auto& variant : variants)
+            kernelState.VariantNames.emplace_back(variant.Name);
+
+        std::scoped_lock lock(m_Mtx);
+        if (m_bTuning)
+        {
+            kernelState.AverageTimes.resize(variants.size(), 0.0);
+            m_Kernels.insert_or_assign(passName, std::move(kernelState));
+
+            std::vector<u32> variantIndices(variants.size());
+            std::iota(variantIndices.begin(), variantIndices.end(), 0);
+            return variantIndices;
+        }
+
+        kernelState.bTuned = true;
+        if (const auto it = m_BestVariantNames.find(passName); it != m_BestVariantNames.end())
+        {
+            const auto variantIt = std::ranges::find(kernelState.VariantNames, it->second);
+            if (variantIt != kernelState.VariantNames.end())
+                kernelState.VariantIndex = static_cast<u32>(std::distance(kernelState.VariantNames.begin(), variantIt));
+            else
+                LOG_WARN("Kernel autotuner: [{}] variant [{}] doesn't exist anymore, falling back to default.", passName, it->second);
+        }
+
+        const auto variantIndex = kernelState.VariantIndex;
+        m_Kernels.insert_or_assign(passName, std::move(kernelState));
+        return {variantIndex};
+    }
+
+    u32 GfxKernelAutotuner::GetVariantIndex(const std::string& passName) const noexcept
+    {
+        std::scoped_lock lock(m_Mtx);
+        const auto it = m_Kernels.find(passName);
+        RDNT_ASSERT(it != m_Kernels.end(), "Kernel [{}] isn't registered!", passName);
+        return it->second.VariantIndex;
+    }
+
+    void GfxKernelAutotuner::Update(const std::vector<ProfilerTask>& gpuProfilerData) noexcept
+    {
+        if (!m_bTuning) return;
+
+        std::scoped_lock lock(m_Mtx);
+        for (auto& [passName, kernelState] : m_Kernels)
+        {
+            if (kernelState.bTuned) continue;
+
+            // Pass can be disabled, kernel just waits for it then.
+            const auto taskIt = std::ranges::find(gpuProfilerData, passName, &ProfilerTask::Name);
+            if (taskIt == gpuProfilerData.end()) continue;
+
+            if (++kernelState.FrameCount <= s_WarmUpFrameCount) continue;
+
+            kernelState.AccumulatedTime += taskIt->GetLength();
+            if (kernelState.FrameCount < s_WarmUpFrameCount + s_SampleFrameCount) continue;
+
+            kernelState.AverageTimes[kernelState.VariantIndex] = kernelState.AccumulatedTime / s_SampleFrameCount;
+            kernelState.FrameCount                             = 0;
+            kernelState.AccumulatedTime                        = 0.0;
+            if (++kernelState.VariantIndex < kernelState.VariantNames.size()) continue;
+
+            FinishTuning(passName, kernelState);
+        }
+    }
+
+    void GfxKernelAutotuner::FinishTuning(const std::string& passName, KernelState& kernelState) noexcept
+    {
+        const auto bestTimeIt    = std::ranges::min_element(kernelState.AverageTimes);
+        kernelState.VariantIndex = static_cast<u32>(std::distance(kernelState.AverageTimes.begin(), bestTimeIt));
+        kernelState.bTuned       = true;
+
+        LOG_INFO("Kernel autotuner: [{}] tuned, best variant: [{}].", passName, kernelState.VariantNames[kernelState.VariantIndex]);
+        for (u32 variantIndex{}; variantIndex < kernelState.VariantNames.size(); ++variantIndex)
+            LOG_INFO("\t[{}]: {:.4f} ms", kernelState.VariantNames[variantIndex], kernelState.AverageTimes[variantIndex] * 1000.0);
+
+        m_BestVariantNames.insert_or_assign(passName, kernelState.VariantNames[kernelState.VariantIndex]);
+        m_bDirty = true;
+
+        if (std::ranges::all_of(m_Kernels, [](const auto& kernel) noexcept { return kernel.second.bTuned; }))
+            LOG_INFO("Kernel autotuner: every kernel is tuned, results are saved on exit to: {}", m_FileName);
+    }
+
+    std::string GfxKernelAutotuner::GetFileName(const u32 vendorID, const u32 deviceID) noexcept
+    {
+        return std::format("kernel_autotune_{:x}_{:x}.txt", vendorID, deviceID);
+    }
+
+    void GfxKernelAutotuner::Load() noexcept
+    {
+        if (!std::filesystem::exists(m_FileName))
+        {
+            if (!m_bTuning) LOG_INFO("Kernel autotuner: no tuning data for this GPU, run with --autotune-kernels to get it.");
+            return;
+        }
+
+        std::ifstream input(m_FileName);
+        u32 version{0};
+        u64 entryCount{0};
+        if (!(input >> version >> entryCount) || version != s_KernelAutotunerVersion)
+        {
+            LOG_WARN("Kernel autotuner: tuning data is outdated, default variants are used.");
+            return;
+        }
+
+        for (u64 i{}; i < entryCount; ++i)
+        {
+            std::string passName{}, variantName{};
+            if (!(input >> std::quoted(passName) >> std::quoted(variantName)))
+            {
+                LOG_WARN("Kernel autotuner: tuning data is corrupted, default variants are used.");
+                m_BestVariantNames.clear();
+                return;
+            }
+
+            m_BestVariantNames.insert_or_assign(std::move(passName), std::move(variantName));
+        }
+
+        LOG_INFO("Loaded kernel autotuner data: {} kernels.", m_BestVariantNames.size());
+    }
+
+    void GfxKernelAutotuner::Save() noexcept
+    {
+        std::scoped_lock lock(m_Mtx);
+        if (!m_bDirty) return;
+
+        std::ofstream output(m_FileName, std::ios::out | std::ios::trunc);
+        RDNT_ASSERT(output.is_open(), "Failed to open: {}", m_FileName);
+
+        output << s_KernelAutotunerVersion << ' ' << m_BestVariantNames.size() << '\n';
+        for (const auto& [passName, variantName] : m_BestVariantNames)
+            output << std::quoted(passName) << ' ' << std::quoted(variantName) << '\n';
+
+        m_bDirty = false;
+    }
+
+}  // namespace Radiant
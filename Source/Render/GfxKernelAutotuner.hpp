@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+
+namespace Radiant
+{
+
+    // NOTE: One configuration of compute kernel(workgroup size, etc.), name is what gets persisted, so don't rename them carelessly.
+    struct GfxKernelVariant
+    {
+        std::string Name{s_DEFAULT_STRING};
+        GfxSpecializationConstants SpecializationConstants{};
+    };
+
+    // NOTE: Picks the fastest variant of compute kernels per GPU. Kernel is identified by render graph pass it's dispatched in, so its
+    // timings are taken straight from pass timestamps. In tuning mode(--autotune-kernels) every registered kernel cycles through its
+    // variants, each one is timed over a number of frames and the best ones are persisted per vendor/device ID, next startups on the same
+    // GPU build only them. Kernels without tuning data use the first(default) variant. Knows nothing about device, so it's testable on CPU.
+    class GfxKernelAutotuner final : private Uncopyable, private Unmovable
+    {
+      public:
+        GfxKernelAutotuner(const std::string& fileName, const bool bTuning) noexcept : m_FileName(fileName), m_bTuning(bTuning) { Load(); }
+        ~GfxKernelAutotuner() noexcept { Save(); }
+
+        // NOTE: Tuning data is per vendor/device ID.
+        NODISCARD static std::string GetFileName(const u32 vendorID, const u32 deviceID) noexcept;
+
+        // NOTE: Returns indices of variants that should be built: all of them while tuning, otherwise just the selected one.
+        NODISCARD std::vector<u32> RegisterKernel(const std::string& passName, const std::vector<GfxKernelVariant>& variants) noexcept;
+        NODISCARD u32 GetVariantIndex(const std::string& passName) const noexcept;
+
+        // NOTE: Fed with GPU timings of finished frame, does nothing unless tuning.
+        void Update(const std::vector<ProfilerTask>& gpuProfilerData) noexcept;
+        NODISCARD FORCEINLINE bool IsTuning() const noexcept { return m_bTuning; }
+
+        static constexpr u32 s_WarmUpFrameCount = 16;  // Skipped after every switch, timings lag behind by buffered frame count.
+        static constexpr u32 s_SampleFrameCount = 128;
+
+      private:
+        struct KernelState
+        {
+            std::vector<std::string> VariantNames{};
+            std::vector<f64> AverageTimes{};  // Seconds, filled while tuning.
+            u32 VariantIndex{0};
+            u32 FrameCount{0};
+            f64 AccumulatedTime{0.0};
+            bool bTuned{false};
+        };
+
+        std::string m_FileName{s_DEFAULT_STRING};
+        mutable std::mutex m_Mtx{};
+        UnorderedMap<std::string, KernelState> m_Kernels;
+        UnorderedMap<std::string, std::string> m_BestVariantNames;  // Pass name -> variant name, persisted.
+        bool m_bTuning{false};
+        bool m_bDirty{false};
+
+        constexpr GfxKernelAutotuner() noexcept = delete;
+        void Load() noexcept;
+        void Save() noexcept;
+        void FinishTuning(const std::string& passName, KernelState& kernelState) noexcept;
+    };
+
+}  // namespace Radiant
@@ -1,90 +1,220 @@
 #include "GfxPipeline.hpp"
 
 #include <Core/Application.hpp>
+#include <Render/GfxContext.hpp>
 #include <Render/GfxDevice.hpp>
 #include <Render/GfxShader.hpp>
 #include <Render/GfxTexture.hpp>
 
+#include <iomanip>
+
 namespace Radiant
 {
-    void GfxPipeline::HotReload() noexcept
+#if RDNT_DEBUG
+    static constexpr const char* s_PipelineManifestName = "pso_manifest_debug.txt";
+#elif RDNT_RELEASE
+    static constexpr const char* s_PipelineManifestName = "pso_manifest_release.txt";
+#else
+#error Unknown build type!
+#endif
+
+    namespace PipelineManifestUtils
     {
-        if (m_bIsHotReloadGoing)
+        // NOTE: Plain text, entry per line, bump version whenever pipeline options change!
+        static constexpr u32 s_PipelineManifestVersion = 2;
+
+        // NOTE: Everything that ends up in pipeline state, shared by manifest file and entry key.
+        static void WritePipelineOptions(std::ostream& output, const GfxPipelineOptions& pipelineOptions) noexcept
         {
-            LOG_INFO("Pipeline [{}] already hot-reloading, wait until it's done before you can hot-reload again!", m_Description.DebugName);
-            return;
+            const auto WriteArrayFunc = [&](const auto& array) noexcept
+            {
+                output << ' ' << array.size();
+                for (const auto& element : array)
+                    output << ' ' << static_cast<u32>(element);
+            };
+
+            output << ' ' << pipelineOptions.index();
+            if (const auto* gpo = std::get_if<GfxGraphicsPipelineOptions>(&pipelineOptions); gpo)
+            {
+                WriteArrayFunc(gpo->RenderingFormats);
+                WriteArrayFunc(gpo->DynamicStates);
+                WriteArrayFunc(gpo->BlendModes);
+                output << ' ' << static_cast<VkCullModeFlags>(gpo->CullMode) << ' ' << static_cast<u32>(gpo->FrontFace) << ' '
+                       << static_cast<u32>(gpo->PrimitiveTopology) << ' ' << static_cast<u32>(gpo->PolygonMode) << ' ' << gpo->bMeshShading
+                       << ' ' << gpo->bDepthClamp << ' ' << gpo->bDepthTest << ' ' << gpo->bDepthWrite << ' '
+                       << static_cast<u32>(gpo->DepthCompareOp) << ' ' << gpo->DepthBounds.x << ' ' << gpo->DepthBounds.y << ' '
+                       << static_cast<u32>(gpo->Back) << ' ' << static_cast<u32>(gpo->Front) << ' ' << gpo->bStencilTest << ' '
+                       << gpo->bMultisample;
+            }
+            else if (const auto* cpo = std::get_if<GfxComputePipelineOptions>(&pipelineOptions); cpo)
+            {
+                output << ' ' << cpo->SpecializationConstants.size();
+                for (const auto& specializationConstant : cpo->SpecializationConstants)
+                    output << ' ' << specializationConstant.ID << ' ' << specializationConstant.Value;
+            }
+            else if (const auto* rtpo = std::get_if<GfxRayTracingPipelineOptions>(&pipelineOptions); rtpo)
+                output << ' ' << rtpo->MaxRayRecursionDepth;
         }
 
-        RDNT_ASSERT(m_Description.Shader, "Pipeline hasn't shader attached to it!");
-        m_bIsHotReloadGoing.store(true);
-        m_bCanSwitchHotReloadedDummy.store(false);
+        static void WriteEntry(std::ostream& output, const GfxPipelineManifestEntry& entry) noexcept
+        {
+            output << std::quoted(entry.DebugName) << ' ' << std::quoted(entry.ShaderDescription.Path) << ' '
+                   << entry.ShaderDescription.Defines.size();
+            for (const auto& define : entry.ShaderDescription.Defines)
+                output << ' ' << std::quoted(define.Name) << ' ' << std::quoted(define.Value);
+
+            WritePipelineOptions(output, entry.PipelineOptions);
+            output << '\n';
+        }
+
+        // NOTE: Pipeline whose state changes under the same name/shader/defines gets a new entry instead of keeping the stale one.
+        // Same precision as the manifest file, so keys of loaded entries match the recorded ones.
+        NODISCARD static u64 MakeEntryKey(const GfxPipelineManifestEntry& entry) noexcept
+        {
+            std::ostringstream keyData{};
+            keyData << std::setprecision(std::numeric_limits<f32>::max_digits10) << entry.DebugName << '|' << entry.ShaderDescription.Path
+                    << '|' << GfxShaderUtils::HashDefines(entry.ShaderDescription.Defines);
+            WritePipelineOptions(keyData, entry.PipelineOptions);
+
+            const auto keyString = keyData.str();
+            return ankerl::unordered_dense::detail::wyhash::hash(keyString.data(), keyString.size());
+        }
 
-        auto brightFuture = Application::Get().GetThreadPool()->Submit(
-            [&]() noexcept
+        NODISCARD static bool ReadEntry(std::istream& input, GfxPipelineManifestEntry& entry) noexcept
+        {
+            const auto ReadArrayFunc = [&]<typename T>(std::vector<T>& array) noexcept
             {
-                const auto hotReloadBeginTime = Timer::Now();
-                m_Description.Shader->HotReload();
-                Invalidate();
+                u64 size{0};
+                if (!(input >> size)) return false;
 
-                m_bCanSwitchHotReloadedDummy.store(true);
-                m_bIsHotReloadGoing.store(false);
+                array.resize(size);
+                for (auto& element : array)
+                {
+                    u32 value{0};
+                    if (!(input >> value)) return false;
+                    element = static_cast<T>(value);
+                }
+                return true;
+            };
+            const auto ReadEnumFunc = [&]<typename T>(T& value) noexcept
+            {
+                u32 rawValue{0};
+                if (!(input >> rawValue)) return false;
 
-                const auto hotReloadTimeDiff =
-                    std::chrono::duration<f32, std::chrono::milliseconds::period>(Timer::Now() - hotReloadBeginTime).count();
-                std::stringstream ss;
-                ss << "Worker[" << std::this_thread::get_id() << "] hot-reloaded pipeline ";
-                LOG_INFO("{} [{}] in {:.4f} ms.", ss.str(), m_Description.DebugName, hotReloadTimeDiff);
-            });
-        (void)brightFuture;
-    }
+                value = static_cast<T>(rawValue);
+                return true;
+            };
 
-    void GfxPipeline::Invalidate() noexcept
+            u64 defineCount{0};
+            if (!(input >> std::quoted(entry.DebugName) >> std::quoted(entry.ShaderDescription.Path) >> defineCount)) return false;
+
+            entry.ShaderDescription.Defines.resize(defineCount);
+            for (auto& define : entry.ShaderDescription.Defines)
+                if (!(input >> std::quoted(define.Name) >> std::quoted(define.Value))) return false;
+
+            u64 optionsIndex{0};
+            if (!(input >> optionsIndex)) return false;
+
+            switch (optionsIndex)
+            {
+                case 1:
+                {
+                    auto& gpo = entry.PipelineOptions.emplace<GfxGraphicsPipelineOptions>();
+                    if (!ReadArrayFunc(gpo.RenderingFormats) || !ReadArrayFunc(gpo.DynamicStates) || !ReadArrayFunc(gpo.BlendModes))
+                        return false;
+
+                    if (!ReadEnumFunc(gpo.CullMode) || !ReadEnumFunc(gpo.FrontFace) || !ReadEnumFunc(gpo.PrimitiveTopology) ||
+                        !ReadEnumFunc(gpo.PolygonMode))
+                        return false;
+
+                    if (!(input >> gpo.bMeshShading >> gpo.bDepthClamp >> gpo.bDepthTest >> gpo.bDepthWrite)) return false;
+                    if (!ReadEnumFunc(gpo.DepthCompareOp) || !(input >> gpo.DepthBounds.x >> gpo.DepthBounds.y)) return false;
+
+                    return ReadEnumFunc(gpo.Back) && ReadEnumFunc(gpo.Front) && (input >> gpo.bStencilTest >> gpo.bMultisample);
+                }
+                case 2:
+                {
+                    auto& cpo = entry.PipelineOptions.emplace<GfxComputePipelineOptions>();
+
+                    u64 specializationConstantCount{0};
+                    if (!(input >> specializationConstantCount)) return false;
+
+                    cpo.SpecializationConstants.resize(specializationConstantCount);
+                    for (auto& specializationConstant : cpo.SpecializationConstants)
+                        if (!(input >> specializationConstant.ID >> specializationConstant.Value)) return false;
+
+                    return true;
+                }
+                case 3:
+                {
+                    auto& rtpo = entry.PipelineOptions.emplace<GfxRayTracingPipelineOptions>();
+                    return static_cast<bool>(input >> rtpo.MaxRayRecursionDepth);
+                }
+                default: return false;
+            }
+        }
+
+    }  // namespace PipelineManifestUtils
+
+    namespace PipelineUtils
     {
-        RDNT_ASSERT(!std::holds_alternative<std::monostate>(m_Description.PipelineOptions), "PipelineOptions aren't setup!");
-        RDNT_ASSERT(m_Description.Shader, "Pipeline hasn't shader attached to it!");
+        // NOTE: Fixed function state of graphics pipeline, shared by monolithic pipelines and pipeline library parts.
+        struct GraphicsPipelineState
+        {
+            std::vector<vk::Format> ColorAttachmentFormats{};
+            vk::Format DepthAttachmentFormat{vk::Format::eUndefined};
+            std::vector<vk::PipelineColorBlendAttachmentState> ColorBlendAttachments{};
+            vk::PipelineDepthStencilStateCreateInfo DepthStencilStateCI{};
+            vk::PipelineInputAssemblyStateCreateInfo InputAssemblyStateCI{};
+            vk::PipelineVertexInputStateCreateInfo VertexInputStateCI{};
+            vk::PipelineRasterizationStateCreateInfo RasterizationStateCI{};
+            vk::PipelineMultisampleStateCreateInfo MultisampleStateCI{};
 
-        if (const auto* gpo = std::get_if<GfxGraphicsPipelineOptions>(&m_Description.PipelineOptions); gpo)
+            // Filled by MakeGraphicsPipelineCreateInfo(), they point into arrays above.
+            vk::PipelineRenderingCreateInfo DynamicRenderingInfo{};
+            vk::PipelineColorBlendStateCreateInfo BlendStateCI{};
+            vk::PipelineDynamicStateCreateInfo DynamicStateCI{};
+        };
+
+        NODISCARD static GraphicsPipelineState MakeGraphicsPipelineState(const GfxGraphicsPipelineOptions& gpo,
+                                                                         const vk::SampleCountFlagBits msaaSamples) noexcept
         {
-            RDNT_ASSERT(!gpo->RenderingFormats.empty(), "Graphics Pipeline requires rendering formats!");
+            RDNT_ASSERT(!gpo.RenderingFormats.empty(), "Graphics Pipeline requires rendering formats!");
 
-            auto dynamicRenderingInfo = vk::PipelineRenderingCreateInfo();
-            std::vector<vk::Format> colorAttachmentFormats;
-            for (u32 i{}; i < gpo->RenderingFormats.size(); ++i)
+            GraphicsPipelineState state{};
+            for (u32 i{}; i < gpo.RenderingFormats.size(); ++i)
             {
-                const auto format = gpo->RenderingFormats[i];
+                const auto format = gpo.RenderingFormats[i];
                 // TODO: Stencil formats
                 if (GfxTexture::IsDepthFormat(format))
                 {
-                    RDNT_ASSERT(dynamicRenderingInfo.depthAttachmentFormat == vk::Format::eUndefined,
-                                "Depth attachment already initialized?!");
-                    dynamicRenderingInfo.setDepthAttachmentFormat(format);
+                    RDNT_ASSERT(state.DepthAttachmentFormat == vk::Format::eUndefined, "Depth attachment already initialized?!");
+                    state.DepthAttachmentFormat = format;
                 }
                 else
                 {
-                    colorAttachmentFormats.emplace_back(format);
+                    state.ColorAttachmentFormats.emplace_back(format);
                 }
             }
-            dynamicRenderingInfo.setColorAttachmentFormats(colorAttachmentFormats);
-
-            const auto depthStencilStateCI = vk::PipelineDepthStencilStateCreateInfo()
-                                                 .setBack(gpo->Back)
-                                                 .setFront(gpo->Front)
-                                                 .setStencilTestEnable(gpo->bStencilTest)
-                                                 .setDepthBoundsTestEnable(gpo->DepthBounds != glm::vec2{0.f})
-                                                 .setDepthCompareOp(gpo->DepthCompareOp)
-                                                 .setDepthTestEnable(gpo->bDepthTest)
-                                                 .setDepthWriteEnable(gpo->bDepthWrite)
-                                                 .setMinDepthBounds(gpo->DepthBounds.x)
-                                                 .setMaxDepthBounds(gpo->DepthBounds.y);
-
-            std::vector<vk::PipelineColorBlendAttachmentState> colorBlendAttachments;
-            for (u32 i{}; i < colorAttachmentFormats.size(); ++i)
-            {
-                auto& colorBlendAttachment = colorBlendAttachments.emplace_back(vk::PipelineColorBlendAttachmentState().setColorWriteMask(
-                    vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB |
-                    vk::ColorComponentFlagBits::eA));
-                const auto blendMode =
-                    gpo->BlendModes.empty() ? GfxGraphicsPipelineOptions::EBlendMode::BLEND_MODE_NONE : gpo->BlendModes[i];
+
+            state.DepthStencilStateCI = vk::PipelineDepthStencilStateCreateInfo()
+                                            .setBack(gpo.Back)
+                                            .setFront(gpo.Front)
+                                            .setStencilTestEnable(gpo.bStencilTest)
+                                            .setDepthBoundsTestEnable(gpo.DepthBounds != glm::vec2{0.f})
+                                            .setDepthCompareOp(gpo.DepthCompareOp)
+                                            .setDepthTestEnable(gpo.bDepthTest)
+                                            .setDepthWriteEnable(gpo.bDepthWrite)
+                                            .setMinDepthBounds(gpo.DepthBounds.x)
+                                            .setMaxDepthBounds(gpo.DepthBounds.y);
+
+            for (u32 i{}; i < state.ColorAttachmentFormats.size(); ++i)
+            {
+                auto& colorBlendAttachment =
+                    state.ColorBlendAttachments.emplace_back(vk::PipelineColorBlendAttachmentState().setColorWriteMask(
+                        vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB |
+                        vk::ColorComponentFlagBits::eA));
+                const auto blendMode = gpo.BlendModes.empty() ? GfxGraphicsPipelineOptions::EBlendMode::BLEND_MODE_NONE : gpo.BlendModes[i];
                 switch (blendMode)
                 {
                     case GfxGraphicsPipelineOptions::EBlendMode::BLEND_MODE_NONE: break;
@@ -112,53 +242,260 @@ namespace Radiant
                     }
                 }
             }
-            const auto blendStateCI = vk::PipelineColorBlendStateCreateInfo().setAttachments(colorBlendAttachments);
-
-            const auto inputAssemblyStateCI =
-                vk::PipelineInputAssemblyStateCreateInfo().setTopology(gpo->PrimitiveTopology).setPrimitiveRestartEnable(vk::False);
-            const auto vtxInputStateCI = vk::PipelineVertexInputStateCreateInfo();
-
-            const auto rasterizationStateCI = vk::PipelineRasterizationStateCreateInfo()
-                                                  .setCullMode(gpo->CullMode)
-                                                  .setFrontFace(gpo->FrontFace)
-                                                  .setPolygonMode(gpo->PolygonMode)
-                                                  .setRasterizerDiscardEnable(vk::False)
-                                                  .setDepthClampEnable(gpo->bDepthClamp)
-                                                  .setLineWidth(1.0f);
-
-            const auto msaaStateCI =
-                vk::PipelineMultisampleStateCreateInfo()
-                    .setRasterizationSamples(gpo->bMultisample ? m_Device->GetMSAASamples() : vk::SampleCountFlagBits::e1)
-                    .setMinSampleShading(1.0f);
-
-            const auto dynamicStateCI = vk::PipelineDynamicStateCreateInfo().setDynamicStates(gpo->DynamicStates);
-
-            const auto shaderStages = m_Description.Shader->GetShaderStages();
-            auto [result, pipeline] = m_Device->GetLogicalDevice()->createGraphicsPipelineUnique(
-                m_Device->GetPipelineCache(), vk::GraphicsPipelineCreateInfo()
-                                                  .setPNext(&dynamicRenderingInfo)
-                                                  .setLayout(m_Device->GetBindlessPipelineLayout())
-                                                  .setStages(shaderStages)
-                                                  .setPDepthStencilState(&depthStencilStateCI)
-                                                  .setPInputAssemblyState(gpo->bMeshShading ? nullptr : &inputAssemblyStateCI)
-                                                  .setPVertexInputState(gpo->bMeshShading ? nullptr : &vtxInputStateCI)
-                                                  .setPColorBlendState(&blendStateCI)
-                                                  .setPRasterizationState(&rasterizationStateCI)
-                                                  .setPMultisampleState(&msaaStateCI)
-                                                  .setPDynamicState(&dynamicStateCI));
-            RDNT_ASSERT(result == vk::Result::eSuccess, "Failed to create GRAPHICS pipeline!");
 
+            state.InputAssemblyStateCI =
+                vk::PipelineInputAssemblyStateCreateInfo().setTopology(gpo.PrimitiveTopology).setPrimitiveRestartEnable(vk::False);
+
+            state.RasterizationStateCI = vk::PipelineRasterizationStateCreateInfo()
+                                             .setCullMode(gpo.CullMode)
+                                             .setFrontFace(gpo.FrontFace)
+                                             .setPolygonMode(gpo.PolygonMode)
+                                             .setRasterizerDiscardEnable(vk::False)
+                                             .setDepthClampEnable(gpo.bDepthClamp)
+                                             .setLineWidth(1.0f);
+
+            state.MultisampleStateCI = vk::PipelineMultisampleStateCreateInfo()
+                                           .setRasterizationSamples(gpo.bMultisample ? msaaSamples : vk::SampleCountFlagBits::e1)
+                                           .setMinSampleShading(1.0f);
+            return state;
+        }
+
+        NODISCARD static vk::GraphicsPipelineCreateInfo MakeGraphicsPipelineCreateInfo(
+            GraphicsPipelineState& state, const GfxGraphicsPipelineOptions& gpo,
+            const std::vector<vk::PipelineShaderStageCreateInfo>& shaderStages, const vk::PipelineLayout& pipelineLayout) noexcept
+        {
+            state.DynamicRenderingInfo =
+                vk::PipelineRenderingCreateInfo().setColorAttachmentFormats(state.ColorAttachmentFormats).setDepthAttachmentFormat(
+                    state.DepthAttachmentFormat);
+            state.BlendStateCI   = vk::PipelineColorBlendStateCreateInfo().setAttachments(state.ColorBlendAttachments);
+            state.DynamicStateCI = vk::PipelineDynamicStateCreateInfo().setDynamicStates(gpo.DynamicStates);
+
+            return vk::GraphicsPipelineCreateInfo()
+                .setPNext(&state.DynamicRenderingInfo)
+                .setLayout(pipelineLayout)
+                .setStages(shaderStages)
+                .setPDepthStencilState(&state.DepthStencilStateCI)
+                .setPInputAssemblyState(gpo.bMeshShading ? nullptr : &state.InputAssemblyStateCI)
+                .setPVertexInputState(gpo.bMeshShading ? nullptr : &state.VertexInputStateCI)
+                .setPColorBlendState(&state.BlendStateCI)
+                .setPRasterizationState(&state.RasterizationStateCI)
+                .setPMultisampleState(&state.MultisampleStateCI)
+                .setPDynamicState(&state.DynamicStateCI);
+        }
+
+        // NOTE: Pipeline cache is probed first, so misses(full compiles, hitches when it happens mid-frame) are reported.
+        template <typename TPipelineCreateInfo>
+        NODISCARD static vk::UniquePipeline CreateWithCacheProbe(const Unique<GfxDevice>& device, const std::string& debugName,
+                                                                 const TPipelineCreateInfo& pipelineCI) noexcept
+        {
+            const auto CreateWithFlagsFunc = [&](const vk::PipelineCreateFlags extraFlags) noexcept
+            {
+                auto finalPipelineCI = pipelineCI;
+                finalPipelineCI.setFlags(pipelineCI.flags | extraFlags | device->GetExtraPipelineCreateFlags());
+                if constexpr (std::is_same_v<TPipelineCreateInfo, vk::GraphicsPipelineCreateInfo>)
+                    return device->GetLogicalDevice()->createGraphicsPipelineUnique(device->GetPipelineCache(), finalPipelineCI);
+                else
+                    return device->GetLogicalDevice()->createComputePipelineUnique(device->GetPipelineCache(), finalPipelineCI);
+            };
+
+            auto& pipelineManifest             = GfxContext::Get().GetPipelineManifest();
+            auto [probeResult, probedPipeline] = CreateWithFlagsFunc(vk::PipelineCreateFlagBits::eFailOnPipelineCompileRequired);
+            const bool bCacheHit               = probeResult == vk::Result::eSuccess;
+            if (pipelineManifest) pipelineManifest->ReportCacheLookup(debugName, bCacheHit);
+            if (bCacheHit) return std::move(probedPipeline);
+
+            RDNT_ASSERT(probeResult == vk::Result::ePipelineCompileRequired, "Failed to probe pipeline cache for [{}]!", debugName);
+            auto [result, pipeline] = CreateWithFlagsFunc({});
+            RDNT_ASSERT(result == vk::Result::eSuccess, "Failed to create pipeline [{}]!", debugName);
+            return std::move(pipeline);
+        }
+
+        NODISCARD static u64 HashValues(const std::initializer_list<u64> values) noexcept
+        {
+            return ankerl::unordered_dense::detail::wyhash::hash(std::data(values), values.size() * sizeof(u64));
+        }
+
+        template <typename T> NODISCARD static u64 HashArray(const std::vector<T>& array) noexcept
+        {
+            return ankerl::unordered_dense::detail::wyhash::hash(array.data(), array.size() * sizeof(T));
+        }
+
+    }  // namespace PipelineUtils
+
+    void GfxPipeline::HotReload() noexcept
+    {
+        if (m_bIsHotReloadGoing)
+        {
+            LOG_INFO("Pipeline [{}] already hot-reloading, wait until it's done before you can hot-reload again!", m_Description.DebugName);
+            return;
+        }
+
+        RDNT_ASSERT(m_Description.Shader, "Pipeline hasn't shader attached to it!");
+
+        // Permutations are compiled out of the same source, so they're rebuilt too.
+        const auto activePermutationDefines = m_ActivePermutationDefines;
+        DestroyPermutations();
+        SetPermutation(activePermutationDefines);
+
+        InvalidateAsync();
+    }
+
+    void GfxPipeline::InvalidateAsync() noexcept
+    {
+        m_bIsHotReloadGoing.store(true);
+        m_bCanSwitchHotReloadedDummy.store(false);
+
+        // Optimized link of previous build that hasn't been switched to yet is outdated now.
+        if (m_bCanSwitchOptimizedDummy.exchange(false)) m_Device->PushObjectToDelete(std::move(m_OptimizedDummy));
+
+        m_InvalidateFuture = Application::Get().GetThreadPool()->Submit(
+            [this]() noexcept
+            {
+                const auto invalidateBeginTime = Timer::Now();
+                Invalidate();
+                m_bIsHotReloadGoing.store(false);
+
+                const auto invalidateTimeDiff =
+                    std::chrono::duration<f32, std::chrono::milliseconds::period>(Timer::Now() - invalidateBeginTime).count();
+                std::stringstream ss;
+                ss << "Worker[" << std::this_thread::get_id() << "] built pipeline ";
+                LOG_INFO("{} [{}] in {:.4f} ms.", ss.str(), m_Description.DebugName, invalidateTimeDiff);
+            });
+    }
+
+    void GfxPipeline::SetPermutation(const GfxShaderDefines& defines) noexcept
+    {
+        const u64 permutationKey = GfxShaderUtils::HashDefines(defines);
+        if (permutationKey == m_ActivePermutationKey) return;
+
+        m_ActivePermutationKey     = permutationKey;
+        m_ActivePermutationDefines = defines;
+        if (permutationKey == 0) return;
+
+        std::scoped_lock lock(m_PermutationMtx);
+        if (m_Permutations.contains(permutationKey)) return;
+
+        auto shaderDesc = m_Description.Shader->GetDescription();
+        shaderDesc.Defines.insert(shaderDesc.Defines.end(), defines.cbegin(), defines.cend());
+
+        auto& permutation          = m_Permutations[permutationKey];
+        permutation                = MakeUnique<Permutation>();
+        permutation->CompileFuture = Application::Get().GetThreadPool()->Submit(
+            [this, target = permutation.get(), shaderDesc = std::move(shaderDesc)]() noexcept
+            {
+                const auto compileBeginTime = Timer::Now();
+                GfxShader shader(m_Device, shaderDesc);
+                target->Handle = CreatePipeline(shader);
+                m_Device->SetDebugName(m_Description.DebugName, *target->Handle);
+                target->bReady.store(true);
+
+                const auto compileTimeDiff =
+                    std::chrono::duration<f32, std::chrono::milliseconds::period>(Timer::Now() - compileBeginTime).count();
+                LOG_INFO("Compiled pipeline [{}] permutation [{}] in {:.4f} ms.", m_Description.DebugName,
+                         GfxShaderUtils::HashDefines(shaderDesc.Defines), compileTimeDiff);
+            });
+    }
+
+    void GfxPipeline::DestroyPermutations() noexcept
+    {
+        std::scoped_lock lock(m_PermutationMtx);
+        for (auto& [permutationKey, permutation] : m_Permutations)
+        {
+            // NOTE: Worker writes straight into permutation, so it has to be done before permutation is gone.
+            if (permutation->CompileFuture.valid()) permutation->CompileFuture.wait();
+            if (permutation->Handle) m_Device->PushObjectToDelete(std::move(permutation->Handle));
+        }
+        m_Permutations.clear();
+        m_ActivePermutationKey = 0;
+        m_ActivePermutationDefines.clear();
+    }
+
+    void GfxPipeline::Invalidate() noexcept
+    {
+        RDNT_ASSERT(m_Description.Shader, "Pipeline hasn't shader attached to it!");
+        auto& shader = *m_Description.Shader;
+
+        const auto PublishDummyFunc = [&](vk::UniquePipeline&& pipeline) noexcept
+        {
             m_Dummy = std::move(pipeline);
+            m_Device->SetDebugName(m_Description.DebugName, *m_Dummy);
+            m_bCanSwitchHotReloadedDummy.store(true);
+            m_bCanSwitchHotReloadedDummy.notify_all();
+        };
+
+        // NOTE: Includes are known only after shader has been compiled(or loaded from cache), so they're refreshed on every build.
+        const auto RecordShaderDependenciesFunc = [&]() noexcept
+        {
+            if (auto& shaderHotReloader = GfxContext::Get().GetShaderHotReloader(); shaderHotReloader)
+                shaderHotReloader->RecordDependencies(this, shader.GetDependencyPaths());
+        };
+
+        // NOTE: Shader modules are compiled(or loaded from cache) lazily here and dropped once pipeline(libraries) is built.
+        if (!ShouldUsePipelineLibraries())
+        {
+            std::scoped_lock lock(shader.m_Mtx);
+            PublishDummyFunc(CreatePipeline(shader));
+            RecordShaderDependenciesFunc();
+            shader.Clear();
+            return;
+        }
+
+        std::vector<vk::Pipeline> libraries{};
+        {
+            std::scoped_lock lock(shader.m_Mtx);
+            libraries = CreatePipelineLibraries(shader);
+            RecordShaderDependenciesFunc();
+            shader.Clear();
+        }
+
+        // Fast link doesn't compile anything, so it's bound right away, link time optimized one replaces it once ready.
+        PublishDummyFunc(LinkPipelineLibraries(libraries, false));
+        m_OptimizedDummy = LinkPipelineLibraries(libraries, true);
+        m_Device->SetDebugName(m_Description.DebugName, *m_OptimizedDummy);
+        m_bCanSwitchOptimizedDummy.store(true);
+    }
+
+    void GfxPipeline::RecordToManifest(const GfxShader& shader) const noexcept
+    {
+        auto& pipelineManifest = GfxContext::Get().GetPipelineManifest();
+        if (!pipelineManifest) return;
+
+        pipelineManifest->Record(GfxPipelineManifestEntry{.DebugName         = m_Description.DebugName,
+                                                          .ShaderDescription = shader.GetDescription(),
+                                                          .PipelineOptions   = m_Description.PipelineOptions});
+    }
+
+    vk::UniquePipeline GfxPipeline::CreatePipeline(GfxShader& shader) const noexcept
+    {
+        RDNT_ASSERT(!std::holds_alternative<std::monostate>(m_Description.PipelineOptions), "PipelineOptions aren't setup!");
+        RecordToManifest(shader);
+
+        if (const auto* gpo = std::get_if<GfxGraphicsPipelineOptions>(&m_Description.PipelineOptions); gpo)
+        {
+            auto state              = PipelineUtils::MakeGraphicsPipelineState(*gpo, m_Device->GetMSAASamples());
+            const auto shaderStages = shader.GetShaderStages();
+            return PipelineUtils::CreateWithCacheProbe(
+                m_Device, m_Description.DebugName,
+                PipelineUtils::MakeGraphicsPipelineCreateInfo(state, *gpo, shaderStages, m_Device->GetBindlessPipelineLayout()));
         }
         else if (const auto* cpo = std::get_if<GfxComputePipelineOptions>(&m_Description.PipelineOptions); cpo)
         {
-            auto [result, pipeline] = m_Device->GetLogicalDevice()->createComputePipelineUnique(
-                m_Device->GetPipelineCache(), vk::ComputePipelineCreateInfo()
-                                                  .setLayout(m_Device->GetBindlessPipelineLayout())
-                                                  .setStage(m_Description.Shader->GetShaderStages().back()));
-            RDNT_ASSERT(result == vk::Result::eSuccess, "Failed to create COMPUTE pipeline!");
+            std::vector<vk::SpecializationMapEntry> specializationMapEntries{};
+            std::vector<u32> specializationData{};
+            for (const auto& specializationConstant : cpo->SpecializationConstants)
+            {
+                specializationMapEntries.emplace_back(specializationConstant.ID, static_cast<u32>(specializationData.size() * sizeof(u32)),
+                                                      sizeof(u32));
+                specializationData.emplace_back(specializationConstant.Value);
+            }
+            const auto specializationInfo =
+                vk::SpecializationInfo().setMapEntries(specializationMapEntries).setData<u32>(specializationData);
 
-            m_Dummy = std::move(pipeline);
+            return PipelineUtils::CreateWithCacheProbe(
+                m_Device, m_Description.DebugName,
+                vk::ComputePipelineCreateInfo()
+                    .setLayout(m_Device->GetBindlessPipelineLayout())
+                    .setStage(shader.GetShaderStages(specializationData.empty() ? nullptr : &specializationInfo).back()));
         }
         else if (const auto* rtpo = std::get_if<GfxRayTracingPipelineOptions>(&m_Description.PipelineOptions); rtpo)
         {
@@ -166,17 +503,122 @@ namespace Radiant
         else
             RDNT_ASSERT(false, "This shouldn't happen! {}", __FUNCTION__);
 
-        m_Device->SetDebugName(m_Description.DebugName, *m_Dummy);
-        m_Description.Shader->Clear();
+        return {};
+    }
+
+    bool GfxPipeline::ShouldUsePipelineLibraries() const noexcept
+    {
+        // NOTE: Library cache exists only if VK_EXT_graphics_pipeline_library with fast linking is supported.
+        return std::holds_alternative<GfxGraphicsPipelineOptions>(m_Description.PipelineOptions) &&
+               GfxContext::Get().GetPipelineLibraryCache();
+    }
+
+    std::vector<vk::Pipeline> GfxPipeline::CreatePipelineLibraries(GfxShader& shader) const noexcept
+    {
+        RecordToManifest(shader);
+
+        const auto& gpo            = std::get<GfxGraphicsPipelineOptions>(m_Description.PipelineOptions);
+        auto& pipelineLibraryCache = GfxContext::Get().GetPipelineLibraryCache();
+        auto state                 = PipelineUtils::MakeGraphicsPipelineState(gpo, m_Device->GetMSAASamples());
+        const auto shaderStages    = shader.GetShaderStages();
+
+        // Every part depends on dynamic states and the way they're set, the rest of the key is what part itself is built from.
+        const u64 dynamicStatesHash = PipelineUtils::HashArray(gpo.DynamicStates);
+        const u64 msaaSamples       = static_cast<u64>(state.MultisampleStateCI.rasterizationSamples);
+
+        const auto GetOrCreateLibraryFunc = [&](const vk::GraphicsPipelineLibraryFlagBitsEXT librarySubset,
+                                                const vk::ShaderStageFlags libraryStageMask, const u64 stateHash) noexcept
+        {
+            std::vector<vk::PipelineShaderStageCreateInfo> libraryStages{};
+            std::vector<u64> libraryStageHashes{};
+            for (const auto& shaderStage : shaderStages)
+            {
+                if (!(libraryStageMask & shaderStage.stage)) continue;
+
+                libraryStages.emplace_back(shaderStage);
+                libraryStageHashes.emplace_back(shader.GetStageHash(shaderStage.stage));
+            }
+
+            const u64 libraryKey = PipelineUtils::HashValues({static_cast<u64>(librarySubset), stateHash, dynamicStatesHash,
+                                                              PipelineUtils::HashArray(libraryStageHashes)});
+            return pipelineLibraryCache->GetOrCreate(
+                libraryKey,
+                [&]() noexcept
+                {
+                    auto pipelineCI =
+                        PipelineUtils::MakeGraphicsPipelineCreateInfo(state, gpo, libraryStages, m_Device->GetBindlessPipelineLayout());
+                    auto libraryCI = vk::GraphicsPipelineLibraryCreateInfoEXT().setFlags(librarySubset).setPNext(
+                        const_cast<void*>(pipelineCI.pNext));
+                    pipelineCI.setPNext(&libraryCI)
+                        .setFlags(vk::PipelineCreateFlagBits::eLibraryKHR | vk::PipelineCreateFlagBits::eRetainLinkTimeOptimizationInfoEXT);
+
+                    auto library = PipelineUtils::CreateWithCacheProbe(m_Device, m_Description.DebugName, pipelineCI);
+                    m_Device->SetDebugName(m_Description.DebugName + "_LIBRARY", *library);
+                    return library;
+                });
+        };
+
+        std::vector<vk::Pipeline> libraries{};
+        if (!gpo.bMeshShading)
+        {
+            libraries.emplace_back(GetOrCreateLibraryFunc(vk::GraphicsPipelineLibraryFlagBitsEXT::eVertexInputInterface, {},
+                                                          PipelineUtils::HashValues({static_cast<u64>(gpo.PrimitiveTopology)})));
+        }
+
+        libraries.emplace_back(GetOrCreateLibraryFunc(
+            vk::GraphicsPipelineLibraryFlagBitsEXT::ePreRasterizationShaders,
+            vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eTessellationControl |
+                vk::ShaderStageFlagBits::eTessellationEvaluation | vk::ShaderStageFlagBits::eGeometry | vk::ShaderStageFlagBits::eTaskEXT |
+                vk::ShaderStageFlagBits::eMeshEXT,
+            PipelineUtils::HashValues({static_cast<VkCullModeFlags>(gpo.CullMode), static_cast<u64>(gpo.FrontFace),
+                                       static_cast<u64>(gpo.PolygonMode), gpo.bDepthClamp})));
+
+        libraries.emplace_back(GetOrCreateLibraryFunc(
+            vk::GraphicsPipelineLibraryFlagBitsEXT::eFragmentShader, vk::ShaderStageFlagBits::eFragment,
+            PipelineUtils::HashValues({static_cast<u64>(state.DepthAttachmentFormat), gpo.bDepthTest, gpo.bDepthWrite,
+                                       static_cast<u64>(gpo.DepthCompareOp), std::bit_cast<u32>(gpo.DepthBounds.x),
+                                       std::bit_cast<u32>(gpo.DepthBounds.y), static_cast<u64>(gpo.Back), static_cast<u64>(gpo.Front),
+                                       gpo.bStencilTest, msaaSamples})));
+
+        libraries.emplace_back(GetOrCreateLibraryFunc(
+            vk::GraphicsPipelineLibraryFlagBitsEXT::eFragmentOutputInterface, {},
+            PipelineUtils::HashValues(
+                {PipelineUtils::HashArray(gpo.RenderingFormats), PipelineUtils::HashArray(gpo.BlendModes), msaaSamples})));
+
+        return libraries;
+    }
+
+    vk::UniquePipeline GfxPipeline::LinkPipelineLibraries(const std::vector<vk::Pipeline>& libraries, const bool bOptimize) const noexcept
+    {
+        const auto libraryCI  = vk::PipelineLibraryCreateInfoKHR().setLibraries(libraries);
+        const auto pipelineCI = vk::GraphicsPipelineCreateInfo()
+                                    .setPNext(&libraryCI)
+                                    .setLayout(m_Device->GetBindlessPipelineLayout())
+                                    .setFlags(bOptimize ? vk::PipelineCreateFlagBits::eLinkTimeOptimizationEXT : vk::PipelineCreateFlags{});
+
+        // NOTE: Fast link never compiles, so only optimized one goes through cache probe.
+        if (bOptimize) return PipelineUtils::CreateWithCacheProbe(m_Device, m_Description.DebugName, pipelineCI);
+
+        auto finalPipelineCI = pipelineCI;
+        finalPipelineCI.setFlags(pipelineCI.flags | m_Device->GetExtraPipelineCreateFlags());
+        auto [result, pipeline] = m_Device->GetLogicalDevice()->createGraphicsPipelineUnique(m_Device->GetPipelineCache(), finalPipelineCI);
+        RDNT_ASSERT(result == vk::Result::eSuccess, "Failed to link pipeline [{}]!", m_Description.DebugName);
+        return std::move(pipeline);
     }
 
     void GfxPipeline::Destroy() noexcept
     {
+        if (m_InvalidateFuture.valid()) m_InvalidateFuture.wait();
+        if (auto& shaderHotReloader = GfxContext::Get().GetShaderHotReloader(); shaderHotReloader) shaderHotReloader->Forget(this);
+        DestroyPermutations();
         m_Device->PushObjectToDelete(std::move(m_Handle));
     }
 
     GfxPipeline::operator const vk::Pipeline&() const noexcept
     {
+        // First use waits for initial build(only fast link with pipeline libraries), hot-reloads keep old handle until new one is ready.
+        if (!m_Handle) m_bCanSwitchHotReloadedDummy.wait(false);
+
         if (m_bCanSwitchHotReloadedDummy)
         {
             if (m_Handle) m_Device->PushObjectToDelete(std::move(m_Handle));
@@ -184,8 +626,130 @@ namespace Radiant
             m_bCanSwitchHotReloadedDummy.store(false);
         }
 
+        // NOTE: Optimized flag is checked first, it's raised after fast linked dummy is published, so it can't overtake it.
+        if (m_bCanSwitchOptimizedDummy && !m_bCanSwitchHotReloadedDummy)
+        {
+            m_Device->PushObjectToDelete(std::move(m_Handle));
+            m_Handle = std::move(m_OptimizedDummy);
+            m_bCanSwitchOptimizedDummy.store(false);
+        }
+
+        if (m_ActivePermutationKey != 0)
+        {
+            std::scoped_lock lock(m_PermutationMtx);
+            if (const auto it = m_Permutations.find(m_ActivePermutationKey); it != m_Permutations.end() && it->second->bReady)
+                return *it->second->Handle;
+        }
+
         RDNT_ASSERT(m_Handle, "Pipeline handle is invalid!");
         return *m_Handle;
     }
 
+    void GfxPipelineManifest::Record(const GfxPipelineManifestEntry& entry) noexcept
+    {
+        const auto entryKey = PipelineManifestUtils::MakeEntryKey(entry);
+
+        std::scoped_lock lock(m_Mtx);
+        if (m_Entries.contains(entryKey)) return;
+
+        m_Entries.emplace(entryKey, entry);
+        m_bDirty = true;
+    }
+
+    void GfxPipelineManifest::ReportCacheLookup(const std::string& debugName, const bool bHit) noexcept
+    {
+        if (bHit)
+        {
+            ++m_CacheHitCount;
+            return;
+        }
+
+        ++m_CacheMissCount;
+        if (!m_bWarmingUp) LOG_WARN("Pipeline cache miss: [{}] compiled from scratch, it'll be warmed up next time.", debugName);
+    }
+
+    void GfxPipelineManifest::WarmUp() noexcept
+    {
+        std::vector<GfxPipelineManifestEntry> entries{};
+        {
+            std::scoped_lock lock(m_Mtx);
+            for (const auto& [entryKey, entry] : m_Entries)
+            {
+                // NOTE: Ray tracing pipelines aren't implemented yet.
+                if (std::holds_alternative<GfxGraphicsPipelineOptions>(entry.PipelineOptions) ||
+                    std::holds_alternative<GfxComputePipelineOptions>(entry.PipelineOptions))
+                    entries.emplace_back(entry);
+            }
+        }
+        if (entries.empty()) return;
+
+        m_bWarmingUp.store(true);
+        const auto warmUpBeginTime = Timer::Now();
+        {
+            // Builds are kicked off on thread pool by constructors, destructors wait for them, handles are thrown away.
+            std::vector<Unique<GfxPipeline>> pipelines{};
+            for (const auto& entry : entries)
+            {
+                pipelines.emplace_back(MakeUnique<GfxPipeline>(
+                    m_Device, GfxPipelineDescription{.DebugName       = entry.DebugName,
+                                                     .PipelineOptions = entry.PipelineOptions,
+                                                     .Shader          = MakeShared<GfxShader>(m_Device, entry.ShaderDescription)}));
+            }
+        }
+        m_bWarmingUp.store(false);
+
+        const auto warmUpTime = std::chrono::duration<f32, std::chrono::milliseconds::period>(Timer::Now() - warmUpBeginTime).count();
+        LOG_INFO("Warmed up {} pipelines from manifest in {:.4f} ms, pipeline cache hits: {}, misses: {}.", entries.size(), warmUpTime,
+                 m_CacheHitCount.load(), m_CacheMissCount.load());
+
+        // From now on every miss is a first use hitch.
+        m_CacheHitCount.store(0);
+        m_CacheMissCount.store(0);
+    }
+
+    void GfxPipelineManifest::Load() noexcept
+    {
+        if (!std::filesystem::exists(s_PipelineManifestName)) return;
+
+        std::ifstream input(s_PipelineManifestName);
+        u32 version{0};
+        u64 entryCount{0};
+        if (!(input >> version >> entryCount) || version != PipelineManifestUtils::s_PipelineManifestVersion)
+        {
+            LOG_WARN("Pipeline manifest is outdated, it'll be recorded from scratch.");
+            return;
+        }
+
+        for (u64 i{}; i < entryCount; ++i)
+        {
+            GfxPipelineManifestEntry entry{};
+            if (!PipelineManifestUtils::ReadEntry(input, entry))
+            {
+                LOG_WARN("Pipeline manifest is corrupted, it'll be recorded from scratch.");
+                m_Entries.clear();
+                return;
+            }
+
+            m_Entries.emplace(PipelineManifestUtils::MakeEntryKey(entry), std::move(entry));
+        }
+
+        LOG_INFO("Loaded pipeline manifest: {} pipelines.", m_Entries.size());
+    }
+
+    void GfxPipelineManifest::Save() noexcept
+    {
+        std::scoped_lock lock(m_Mtx);
+        if (!m_bDirty) return;
+
+        std::ofstream output(s_PipelineManifestName, std::ios::out | std::ios::trunc);
+        RDNT_ASSERT(output.is_open(), "Failed to open: {}", s_PipelineManifestName);
+
+        output << std::setprecision(std::numeric_limits<f32>::max_digits10);
+        output << PipelineManifestUtils::s_PipelineManifestVersion << ' ' << m_Entries.size() << '\n';
+        for (const auto& [entryKey, entry] : m_Entries)
+            PipelineManifestUtils::WriteEntry(output, entry);
+
+        m_bDirty = false;
+    }
+
 }  // namespace Radiant
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Core/Core.hpp>
+#include <Render/GfxShader.hpp>
 #include <variant>
 
 #include <vulkan/vulkan.hpp>
@@ -9,7 +10,6 @@ namespace Radiant
 {
 
     class GfxDevice;
-    class GfxShader;
 
     // NOTE: Programmable Vertex Pulling only.
     struct GfxGraphicsPipelineOptions
@@ -46,6 +46,7 @@ namespace Radiant
 
     struct GfxComputePipelineOptions
     {
+        GfxSpecializationConstants SpecializationConstants{};  // Different sets of the same shader are different pipelines.
     };
 
     struct GfxRayTracingPipelineOptions
@@ -53,11 +54,13 @@ namespace Radiant
         u32 MaxRayRecursionDepth{1};
     };
 
+    using GfxPipelineOptions =
+        std::variant<std::monostate, GfxGraphicsPipelineOptions, GfxComputePipelineOptions, GfxRayTracingPipelineOptions>;
+
     struct GfxPipelineDescription
     {
         std::string DebugName{s_DEFAULT_STRING};
-        std::variant<std::monostate, GfxGraphicsPipelineOptions, GfxComputePipelineOptions, GfxRayTracingPipelineOptions> PipelineOptions{
-            std::monostate{}};
+        GfxPipelineOptions PipelineOptions{std::monostate{}};
         Shared<GfxShader> Shader{nullptr};
     };
 
@@ -69,11 +72,13 @@ namespace Radiant
         {
             if (auto* gpo = std::get_if<GfxGraphicsPipelineOptions>(&m_Description.PipelineOptions); gpo)
             {
-                gpo->DynamicStates.emplace_back(vk::DynamicState::eViewportWithCount);
-                gpo->DynamicStates.emplace_back(vk::DynamicState::eScissorWithCount);
+                // NOTE: Options coming from pipeline manifest have them already.
+                for (const auto dynamicState : {vk::DynamicState::eViewportWithCount, vk::DynamicState::eScissorWithCount})
+                    if (std::ranges::find(gpo->DynamicStates, dynamicState) == gpo->DynamicStates.end())
+                        gpo->DynamicStates.emplace_back(dynamicState);
             }
-            Invalidate();
-            LOG_INFO("Created <{}> pipeline.", m_Description.DebugName);
+            // NOTE: Built on thread pool, so pipelines created back to back compile their shaders concurrently.
+            InvalidateAsync();
         }
         ~GfxPipeline() noexcept { Destroy(); }
 
@@ -81,6 +86,11 @@ namespace Radiant
         operator const vk::Pipeline&() const noexcept;
 
         void HotReload() noexcept;
+        NODISCARD FORCEINLINE bool IsHotReloadGoing() const noexcept { return m_bIsHotReloadGoing.load(); }
+
+        // NOTE: Defines are added on top of shader description ones, empty set selects generic variant. Permutation is compiled lazily
+        // on thread pool, until it's ready pipeline is bound with generic variant, so toggling features never stalls the frame.
+        void SetPermutation(const GfxShaderDefines& defines) noexcept;
 
       private:
         const Unique<GfxDevice>& m_Device;
@@ -90,10 +100,122 @@ namespace Radiant
         mutable vk::UniquePipeline m_Dummy{};
         mutable std::atomic<bool> m_bCanSwitchHotReloadedDummy{true};
         mutable std::atomic<bool> m_bIsHotReloadGoing{false};
+        mutable vk::UniquePipeline m_OptimizedDummy{};  // Link time optimized replacement of fast linked pipeline library.
+        mutable std::atomic<bool> m_bCanSwitchOptimizedDummy{false};
+        std::future<void> m_InvalidateFuture{};
+
+        struct Permutation
+        {
+            vk::UniquePipeline Handle{};
+            std::future<void> CompileFuture{};
+            std::atomic<bool> bReady{false};
+        };
+        mutable std::mutex m_PermutationMtx{};
+        UnorderedMap<u64, Unique<Permutation>> m_Permutations;  // Key is define set hash.
+        GfxShaderDefines m_ActivePermutationDefines{};
+        u64 m_ActivePermutationKey{0};  // NOTE: 0 means generic variant.
 
         constexpr GfxPipeline() noexcept = delete;
         void Invalidate() noexcept;
+        void InvalidateAsync() noexcept;
         void Destroy() noexcept;
+        void DestroyPermutations() noexcept;
+        NODISCARD vk::UniquePipeline CreatePipeline(GfxShader& shader) const noexcept;
+        void RecordToManifest(const GfxShader& shader) const noexcept;
+
+        NODISCARD bool ShouldUsePipelineLibraries() const noexcept;
+        NODISCARD std::vector<vk::Pipeline> CreatePipelineLibraries(GfxShader& shader) const noexcept;
+        NODISCARD vk::UniquePipeline LinkPipelineLibraries(const std::vector<vk::Pipeline>& libraries, const bool bOptimize) const noexcept;
+    };
+
+    struct GfxPipelineLibraryStatistics
+    {
+        u32 LibraryCount{0};
+        u32 ReuseCount{0};
+    };
+
+    // NOTE: VK_EXT_graphics_pipeline_library parts(vertex input, pre-rasterization, fragment shader, fragment output) shared by every
+    // graphics pipeline. Key is hash of state the part depends on(+ SPIR-V of its stages), so cull mode/blend mode/attachment format
+    // variants of the same shaders compile only the part that differs and the rest is just linked.
+    class GfxPipelineLibraryCache final : private Uncopyable, private Unmovable
+    {
+      public:
+        GfxPipelineLibraryCache() noexcept  = default;
+        ~GfxPipelineLibraryCache() noexcept = default;
+
+        template <typename TCreateFunc> NODISCARD vk::Pipeline GetOrCreate(const u64 key, TCreateFunc&& createFunc) noexcept
+        {
+            {
+                std::scoped_lock lock(m_Mtx);
+                if (const auto it = m_Libraries.find(key); it != m_Libraries.end())
+                {
+                    ++m_ReuseCount;
+                    return *it->second;
+                }
+            }
+
+            // Built outside the lock, so different parts compile concurrently, loser of the race for the same part throws its one away.
+            auto library = createFunc();
+            std::scoped_lock lock(m_Mtx);
+            return *m_Libraries.try_emplace(key, std::move(library)).first->second;
+        }
+
+        NODISCARD FORCEINLINE GfxPipelineLibraryStatistics GetStatistics() const noexcept
+        {
+            std::scoped_lock lock(m_Mtx);
+            return {.LibraryCount = static_cast<u32>(m_Libraries.size()), .ReuseCount = m_ReuseCount};
+        }
+
+      private:
+        mutable std::mutex m_Mtx{};
+        UnorderedMap<u64, vk::UniquePipeline> m_Libraries;
+        u32 m_ReuseCount{0};
+    };
+
+    struct GfxPipelineManifestEntry
+    {
+        std::string DebugName{s_DEFAULT_STRING};
+        GfxShaderDescription ShaderDescription{};  // Permutation defines included.
+        GfxPipelineOptions PipelineOptions{std::monostate{}};
+    };
+
+    struct GfxPipelineCacheStatistics
+    {
+        u32 HitCount{0};
+        u32 MissCount{0};
+    };
+
+    // NOTE: Every pipeline(and permutation) created is recorded here and persisted next to pipeline cache, on next startup all of them
+    // are built in parallel up front, so driver pipeline cache is warm by the time renderers and permutations ask for them.
+    // Pipeline cache lookups are probed(VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT), so misses(== first use hitches)
+    // are counted and reported.
+    class GfxPipelineManifest final : private Uncopyable, private Unmovable
+    {
+      public:
+        GfxPipelineManifest(const Unique<GfxDevice>& device) noexcept : m_Device(device) { Load(); }
+        ~GfxPipelineManifest() noexcept { Save(); }
+
+        void Record(const GfxPipelineManifestEntry& entry) noexcept;
+        void WarmUp() noexcept;
+
+        void ReportCacheLookup(const std::string& debugName, const bool bHit) noexcept;
+        NODISCARD FORCEINLINE GfxPipelineCacheStatistics GetCacheStatistics() const noexcept
+        {
+            return {.HitCount = m_CacheHitCount.load(), .MissCount = m_CacheMissCount.load()};
+        }
+
+      private:
+        const Unique<GfxDevice>& m_Device;
+        std::mutex m_Mtx{};
+        UnorderedMap<u64, GfxPipelineManifestEntry> m_Entries;  // Key is hash of debug name, shader path, defines and spec constants.
+        bool m_bDirty{false};
+        std::atomic<bool> m_bWarmingUp{false};
+        std::atomic<u32> m_CacheHitCount{0};
+        std::atomic<u32> m_CacheMissCount{0};
+
+        constexpr GfxPipelineManifest() noexcept = delete;
+        void Load() noexcept;
+        void Save() noexcept;
     };
 
 }  // namespace Radiant
@@ -1,5 +1,6 @@
 #include "GfxShader.hpp"
 
+#include <Core/Application.hpp>
 #include <Render/GfxDevice.hpp>
 
 #include <slang.h>
@@ -17,6 +18,8 @@ namespace Radiant
 
     namespace SlangUtils
     {
+        static constexpr const char* s_Profile    = "sm_6_7" /*"glsl460"*/;
+        static constexpr const char* s_Capability = "spirv_1_6";
         NODISCARD static vk::ShaderStageFlagBits SlangShaderStageToVulkan(const SlangStage shaderStage) noexcept
         {
             switch (shaderStage)
@@ -41,170 +44,616 @@ namespace Radiant
             return vk::ShaderStageFlagBits::eVertex;
         }
 
-    }  // namespace SlangUtils
+        // NOTE: Creating global session is the most expensive slang call(it loads the whole core module), so it's done once per thread
+        // and reused by every shader compiled on it. Slang API isn't thread-safe, so sessions can't be shared across threads.
+        NODISCARD static slang::IGlobalSession* GetThreadGlobalSession() noexcept
+        {
+            thread_local Slang::ComPtr<slang::IGlobalSession> s_GlobalSession{};
+            if (!s_GlobalSession)
+            {
+                const auto slangResult = slang::createGlobalSession(s_GlobalSession.writeRef());
+                RDNT_ASSERT(SLANG_SUCCEEDED(slangResult), "SLANG: Failed to create global session!");
+            }
 
-    NODISCARD std::vector<vk::PipelineShaderStageCreateInfo> GfxShader::GetShaderStages() noexcept
-    {
-        std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
-        if (m_ModuleMap.empty())
+            return s_GlobalSession.get();
+        }
+
+        NODISCARD static u64 GetPaddingBytes(slang::TypeLayoutReflection* typeLayout) noexcept
         {
-            LOG_WARN("ModuleMap[{}] is empty, hot reloading...", m_Description.Path);
-            HotReload();
+            u64 usedBytes{0}, nestedPaddingBytes{0};
+            switch (typeLayout->getKind())
+            {
+                case slang::TypeReflection::Kind::Struct:
+                {
+                    for (u32 i{}; i < typeLayout->getFieldCount(); ++i)
+                    {
+                        auto* fieldTypeLayout = typeLayout->getFieldByIndex(i)->getTypeLayout();
+                        usedBytes += fieldTypeLayout->getSize();
+                        nestedPaddingBytes += GetPaddingBytes(fieldTypeLayout);
+                    }
+                    break;
+                }
+                case slang::TypeReflection::Kind::Array:
+                {
+                    auto* elementTypeLayout = typeLayout->getElementTypeLayout();
+                    usedBytes               = typeLayout->getElementCount() * elementTypeLayout->getSize();
+                    nestedPaddingBytes      = typeLayout->getElementCount() * GetPaddingBytes(elementTypeLayout);
+                    break;
+                }
+                default: return 0;
+            }
+
+            const u64 sizeBytes = typeLayout->getSize();
+            return (sizeBytes > usedBytes ? sizeBytes - usedBytes : 0) + nestedPaddingBytes;
         }
 
-        for (auto& [shaderStage, module] : m_ModuleMap)
+        NODISCARD static GfxShaderBlockLayout MakeBlockLayout(std::string&& name, slang::TypeLayoutReflection* typeLayout) noexcept
         {
-            RDNT_ASSERT(module, "Shader module isnt' valid!s");
+            return GfxShaderBlockLayout{.Name         = std::move(name),
+                                        .SizeBytes    = typeLayout->getSize(),
+                                        .PaddingBytes = GetPaddingBytes(typeLayout)};
+        }
+
+        // NOTE: Data is mostly reached through buffer device addresses in push constants, so structs behind those pointers are reported
+        // as uniform blocks alongside real constant buffers.
+        NODISCARD static GfxShaderStageLayout ReflectStageLayout(slang::ProgramLayout* programLayout) noexcept
+        {
+            GfxShaderStageLayout stageLayout{};
+            if (!programLayout) return stageLayout;
 
-            shaderStages.emplace_back(vk::PipelineShaderStageCreateInfo().setStage(shaderStage).setModule(*module).setPName("main"));
+            const auto GetNameFunc = [](const char* name) noexcept { return std::string(name ? name : "<unnamed>"); };
+
+            for (u32 i{}; i < programLayout->getParameterCount(); ++i)
+            {
+                auto* parameter        = programLayout->getParameterByIndex(i);
+                auto* typeLayout       = parameter->getTypeLayout();
+                const bool bBufferWrap = typeLayout->getKind() == slang::TypeReflection::Kind::ConstantBuffer;
+                if (bBufferWrap) typeLayout = typeLayout->getElementTypeLayout();  // [vk::push_constant] T/ConstantBuffer<T> contents.
+
+                const auto parameterName = GetNameFunc(parameter->getName());
+                if (parameter->getCategory() != slang::ParameterCategory::PushConstantBuffer)
+                {
+                    if (bBufferWrap) stageLayout.UniformBlocks.emplace_back(MakeBlockLayout(std::string(parameterName), typeLayout));
+                    continue;
+                }
+
+                stageLayout.PushConstants = MakeBlockLayout(std::string(parameterName), typeLayout);
+                for (u32 k{}; k < typeLayout->getFieldCount(); ++k)
+                {
+                    auto* field           = typeLayout->getFieldByIndex(k);
+                    auto* fieldTypeLayout = field->getTypeLayout();
+                    if (fieldTypeLayout->getKind() != slang::TypeReflection::Kind::Pointer) continue;
+
+                    auto* pointeeTypeLayout = fieldTypeLayout->getElementTypeLayout();
+                    if (!pointeeTypeLayout || pointeeTypeLayout->getKind() != slang::TypeReflection::Kind::Struct) continue;
+
+                    stageLayout.UniformBlocks.emplace_back(MakeBlockLayout(
+                        std::format("{}.{} -> {}", parameterName, GetNameFunc(field->getName()), GetNameFunc(pointeeTypeLayout->getName())),
+                        pointeeTypeLayout));
+                }
+            }
+
+            return stageLayout;
         }
 
-        RDNT_ASSERT(!shaderStages.empty(), "Shaders aren't compiled!");
-        return shaderStages;
-    }
+    }  // namespace SlangUtils
 
-    void GfxShader::Invalidate() noexcept
+    namespace ShaderCacheUtils
     {
-        if (TryLoadCache()) return;
-
-        using Slang::ComPtr;
-        constexpr auto diagnoseSlangBlob = [](slang::IBlob* diagnosticsBlob) noexcept
+        // NOTE: All stages of one shader(+ define set) live in a single file: header, dependency paths, stage index and SPIR-V words.
+        // Key covers contents of the whole dependency closure reported by slang(shader itself + everything it includes), compiler build
+        // and compile options, so editing included header invalidates it, while checkout touching write times only doesn't.
+        // Bump version whenever compile options change!
+        static constexpr u32 s_ShaderCacheMagic            = 0x53445252;  // "RRDS"
+        static constexpr u32 s_ShaderCacheVersion          = 2;
+        static constexpr u64 s_ShaderCacheSectionAlignment = 16;
+
+        struct ShaderCacheString
         {
-            if (diagnosticsBlob) LOG_ERROR("{}", (const char*)diagnosticsBlob->getBufferPointer());
+            u64 Offset{0};
+            u64 Length{0};
         };
 
-        ComPtr<slang::IGlobalSession> slangGlobalSession;
-        auto slangResult = slang::createGlobalSession(slangGlobalSession.writeRef());
-        RDNT_ASSERT(SLANG_SUCCEEDED(slangResult), "SLANG: Failed to create global session!");
+        struct ShaderCacheHeader
+        {
+            u32 Magic{s_ShaderCacheMagic};
+            u32 Version{s_ShaderCacheVersion};
+            u64 Key{0};
+            u64 FileSizeBytes{0};
+            u64 DependenciesOffset{0};
+            u64 StagesOffset{0};
+            u32 DependencyCount{0};
+            u32 StageCount{0};
+        };
 
-        const slang::TargetDesc targetDesc = {
-            .format  = SLANG_SPIRV,
-            .profile = slangGlobalSession->findProfile("sm_6_7" /*"glsl460"*/),
-            .flags   = SLANG_TARGET_FLAG_GENERATE_SPIRV_DIRECTLY,
-#if RDNT_DEBUG
-            .floatingPointMode = SLANG_FLOATING_POINT_MODE_DEFAULT,
-#else
-            .floatingPointMode = SLANG_FLOATING_POINT_MODE_FAST,
-#endif
-            .forceGLSLScalarBufferLayout = true
+        struct ShaderCacheStage
+        {
+            u32 Stage{0};
+            u32 WordCount{0};
+            u64 CodeOffset{0};
         };
 
-        std::vector<slang::CompilerOptionEntry> compileOptions = {};
-        compileOptions.emplace_back(slang::CompilerOptionName::Capability,
-                                    slang::CompilerOptionValue{.intValue0 = slangGlobalSession->findCapability("spirv_1_6")});
-        compileOptions.emplace_back(slang::CompilerOptionName::DisableWarning,
-                                    slang::CompilerOptionValue{.kind         = slang::CompilerOptionValueKind::String,
-                                                               .stringValue0 = "39001"});  // NOTE: vulkan bindings aliasing
-        compileOptions.emplace_back(slang::CompilerOptionName::DisableWarning,
-                                    slang::CompilerOptionValue{.kind         = slang::CompilerOptionValueKind::String,
-                                                               .stringValue0 = "41012"});  // NOTE: spvSparseResidency
-
-        if constexpr (RDNT_DEBUG)
+        NODISCARD static std::optional<u64> MakeShaderCacheKey(const GfxShaderDescription& shaderDesc,
+                                                               const std::vector<std::string>& dependencyPaths) noexcept
         {
-            compileOptions.emplace_back(slang::CompilerOptionName::Optimization,
-                                        slang::CompilerOptionValue{.intValue0 = SLANG_OPTIMIZATION_LEVEL_NONE});
-            //compileOptions.emplace_back(slang::CompilerOptionName::DebugInformation,
-            //                            slang::CompilerOptionValue{.intValue0 = SLANG_DEBUG_INFO_LEVEL_MAXIMAL});
-            //compileOptions.emplace_back(
-            //    slang::CompilerOptionName::DebugInformationFormat,
-            //    slang::CompilerOptionValue{.intValue0 = SLANG_DEBUG_INFO_FORMAT_DEFAULT /*SLANG_DEBUG_INFO_FORMAT_C7*/});
-            // compileOptions.emplace_back(slang::CompilerOptionName::DumpIntermediates, slang::CompilerOptionValue{.intValue0 = 1});
+            std::string keyData = std::to_string(s_ShaderCacheVersion) + spGetBuildTagString() + SlangUtils::s_Profile +
+                                  SlangUtils::s_Capability + s_ShaderCacheDir;
+            keyData += GfxShaderUtils::GetNormalizedShaderPath(shaderDesc.Path);
+            keyData += std::to_string(GfxShaderUtils::HashDefines(shaderDesc.Defines));
+            for (const auto& dependencyPath : dependencyPaths)
+            {
+                std::ifstream dependencyFile(dependencyPath, std::ios::in | std::ios::binary);
+                if (!dependencyFile.is_open()) return std::nullopt;
+
+                keyData += dependencyPath;
+                keyData.append(std::istreambuf_iterator<char>(dependencyFile), std::istreambuf_iterator<char>());
+            }
+
+            return ankerl::unordered_dense::detail::wyhash::hash(keyData.data(), keyData.size());
         }
-        else
+
+        NODISCARD static std::vector<u8> WriteShaderCache(const u64 key, const GfxShaderBinaries& shaderBinaries) noexcept
         {
-            compileOptions.emplace_back(slang::CompilerOptionName::Optimization,
-                                        slang::CompilerOptionValue{.intValue0 = SLANG_OPTIMIZATION_LEVEL_MAXIMAL});
+            std::vector<u8> cacheData(sizeof(ShaderCacheHeader));
+            const auto AppendFunc = [&](const void* data, const u64 sizeBytes) noexcept -> u64
+            {
+                const u64 offset = CoreUtils::AlignSize(cacheData.size(), s_ShaderCacheSectionAlignment);
+                cacheData.resize(offset + sizeBytes);
+                if (sizeBytes != 0) std::memcpy(cacheData.data() + offset, data, sizeBytes);
+                return offset;
+            };
+
+            std::vector<ShaderCacheString> dependencies{};
+            for (const auto& dependencyPath : shaderBinaries.DependencyPaths)
+            {
+                dependencies.emplace_back(AppendFunc(dependencyPath.data(), dependencyPath.size()), dependencyPath.size());
+            }
+
+            std::vector<ShaderCacheStage> stages{};
+            for (const auto& [shaderStageVK, shaderBinary] : shaderBinaries.SPIRV)
+            {
+                stages.emplace_back(static_cast<u32>(shaderStageVK), static_cast<u32>(shaderBinary.size()),
+                                    AppendFunc(shaderBinary.data(), shaderBinary.size() * sizeof(shaderBinary[0])));
+            }
+
+            ShaderCacheHeader header  = {.Key = key};
+            header.DependencyCount    = static_cast<u32>(dependencies.size());
+            header.DependenciesOffset = AppendFunc(dependencies.data(), dependencies.size() * sizeof(dependencies[0]));
+            header.StageCount         = static_cast<u32>(stages.size());
+            header.StagesOffset       = AppendFunc(stages.data(), stages.size() * sizeof(stages[0]));
+            header.FileSizeBytes      = cacheData.size();
+            std::memcpy(cacheData.data(), &header, sizeof(header));
+
+            return cacheData;
         }
 
-        const slang::SessionDesc sessionDesc = {.targets                  = &targetDesc,
-                                                .targetCount              = 1,
-                                                .defaultMatrixLayoutMode  = SLANG_MATRIX_LAYOUT_COLUMN_MAJOR,
-                                                .compilerOptionEntries    = compileOptions.data(),
-                                                .compilerOptionEntryCount = static_cast<u32>(compileOptions.size())};
+    }  // namespace ShaderCacheUtils
 
-        ComPtr<slang::ISession> localSession;
-        slangResult = slangGlobalSession->createSession(sessionDesc, localSession.writeRef());
-        RDNT_ASSERT(SLANG_SUCCEEDED(slangResult), "SLANG: Failed to create local session!");
+    namespace GfxShaderUtils
+    {
+        u64 HashDefines(const GfxShaderDefines& defines) noexcept
+        {
+            if (defines.empty()) return 0;
+
+            auto sortedDefines = defines;
+            std::ranges::sort(sortedDefines, [](const auto& lhs, const auto& rhs) noexcept { return lhs.Name < rhs.Name; });
 
-        ComPtr<slang::IModule> slangModule;
+            std::string definesString{};
+            for (const auto& define : sortedDefines)
+                definesString += define.Name + "=" + define.Value + ";";
+
+            const u64 hash = ankerl::unordered_dense::detail::wyhash::hash(definesString.data(), definesString.size());
+            return hash != 0 ? hash : 1;
+        }
+
+        std::string GetNormalizedShaderPath(const std::string_view& shaderPath) noexcept
         {
-            ComPtr<slang::IBlob> diagnosticBlob;
-            slangModule = localSession->loadModule(m_Description.Path.data(), diagnosticBlob.writeRef());
-            diagnoseSlangBlob(diagnosticBlob);
-            RDNT_ASSERT(slangModule, "SLANG: Failed to load slang shader!");
+            return std::filesystem::path(shaderPath).lexically_normal().generic_string();
         }
 
-        for (u32 i{}; i < slangModule->getDefinedEntryPointCount(); ++i)
+        u32 GetSpecializationConstant(const GfxSpecializationConstants& constants, const u32 id, const u32 defaultValue) noexcept
         {
-            std::vector<slang::IComponentType*> shaderComponents{slangModule};
+            const auto it = std::ranges::find(constants, id, &GfxSpecializationConstant::ID);
+            return it != constants.end() ? it->Value : defaultValue;
+        }
 
-            ComPtr<slang::IEntryPoint> entryPoint;
-            slangResult = slangModule->getDefinedEntryPoint(i, entryPoint.writeRef());
-            RDNT_ASSERT(SLANG_SUCCEEDED(slangResult) && entryPoint, "Failed to retrieve entry point [{}] from shader: {}", i,
-                        m_Description.Path);
+        // NOTE: <shader_name>.slang_<path hash>[_<define set hash>].rdshader, path hash keeps same named shaders from different
+        // directories(final.slang vs shadows/final.slang) apart, define hash does the same for permutations of the same file.
+        NODISCARD static std::string GetShaderCacheName(const GfxShaderDescription& shaderDesc)
+        {
+            const std::string suffix(".slang");
+            const u64 pos = shaderDesc.Path.rfind(suffix);  // Find the last occurrence of ".slang".
+            RDNT_ASSERT(pos != std::string::npos, "Shader path doesn't contain <.slang>!");
 
-            auto entryPointLayout = entryPoint->getLayout();
-            RDNT_ASSERT(entryPointLayout, "SLANG: EntryPointLayout isn't valid!");
+            // Search for the previous slash to isolate the filename.
+            const u64 lastSlashIndex = shaderDesc.Path.rfind('/', pos);
+            auto shaderName          = lastSlashIndex != std::string::npos ? shaderDesc.Path.substr(lastSlashIndex + 1)
+                                                                           : shaderDesc.Path.substr(0, pos + suffix.length());
 
-            auto reflectedEntryPoint = entryPointLayout->getEntryPointByIndex(0);
-            RDNT_ASSERT(reflectedEntryPoint, "SLANG: ReflectedEntryPoint isn't valid!");
+            const auto normalizedPath = GetNormalizedShaderPath(shaderDesc.Path);
+            shaderName += "_" + std::to_string(ankerl::unordered_dense::detail::wyhash::hash(normalizedPath.data(), normalizedPath.size()));
+            if (!shaderDesc.Defines.empty()) shaderName += "_" + std::to_string(HashDefines(shaderDesc.Defines));
 
-            const auto shaderStageVK = SlangUtils::SlangShaderStageToVulkan(reflectedEntryPoint->getStage());
-            if (m_ModuleMap.contains(shaderStageVK)) continue;
+            return std::string(s_ShaderCacheDir) + shaderName + ".rdshader";
+        }
 
-            shaderComponents.emplace_back(entryPoint);
-            ComPtr<slang::IComponentType> composedProgram;
+        static void SaveShaderCache(const GfxShaderDescription& shaderDesc, const GfxShaderBinaries& shaderBinaries) noexcept
+        {
+            const auto cacheKey = ShaderCacheUtils::MakeShaderCacheKey(shaderDesc, shaderBinaries.DependencyPaths);
+            if (!cacheKey.has_value())
             {
-                ComPtr<slang::IBlob> diagnosticBlob;
-                slangResult = localSession->createCompositeComponentType(shaderComponents.data(), shaderComponents.size(),
-                                                                         composedProgram.writeRef(), diagnosticBlob.writeRef());
-                diagnoseSlangBlob(diagnosticBlob);
-                RDNT_ASSERT(SLANG_SUCCEEDED(slangResult), "SLANG: Failed to compose shader program!");
+                LOG_WARN("Failed to read dependencies of shader: {}, it won't be cached!", shaderDesc.Path);
+                return;
             }
 
-            ComPtr<slang::IBlob> spirvCode;
+            if (!std::filesystem::exists(s_ShaderCacheDir)) std::filesystem::create_directory(s_ShaderCacheDir);
+            CoreUtils::SaveData(GetShaderCacheName(shaderDesc), ShaderCacheUtils::WriteShaderCache(*cacheKey, shaderBinaries));
+        }
+
+        std::optional<GfxShaderBinaries> CompileSPIRV(const GfxShaderDescription& shaderDesc) noexcept
+        {
+            using Slang::ComPtr;
+            constexpr auto diagnoseSlangBlob = [](slang::IBlob* diagnosticsBlob) noexcept
+            {
+                if (diagnosticsBlob) LOG_ERROR("{}", (const char*)diagnosticsBlob->getBufferPointer());
+            };
+
+            auto* slangGlobalSession = SlangUtils::GetThreadGlobalSession();
+
+            const slang::TargetDesc targetDesc = {
+                .format  = SLANG_SPIRV,
+                .profile = slangGlobalSession->findProfile(SlangUtils::s_Profile),
+                .flags   = SLANG_TARGET_FLAG_GENERATE_SPIRV_DIRECTLY,
+#if RDNT_DEBUG
+                .floatingPointMode = SLANG_FLOATING_POINT_MODE_DEFAULT,
+#else
+                .floatingPointMode = SLANG_FLOATING_POINT_MODE_FAST,
+#endif
+                .forceGLSLScalarBufferLayout = true
+            };
+
+            std::vector<slang::CompilerOptionEntry> compileOptions = {};
+            compileOptions.emplace_back(
+                slang::CompilerOptionName::Capability,
+                slang::CompilerOptionValue{.intValue0 = slangGlobalSession->findCapability(SlangUtils::s_Capability)});
+            compileOptions.emplace_back(slang::CompilerOptionName::DisableWarning,
+                                        slang::CompilerOptionValue{.kind         = slang::CompilerOptionValueKind::String,
+                                                                   .stringValue0 = "39001"});  // NOTE: vulkan bindings aliasing
+            compileOptions.emplace_back(slang::CompilerOptionName::DisableWarning,
+                                        slang::CompilerOptionValue{.kind         = slang::CompilerOptionValueKind::String,
+                                                                   .stringValue0 = "41012"});  // NOTE: spvSparseResidency
+
+            if constexpr (RDNT_DEBUG)
+            {
+                compileOptions.emplace_back(slang::CompilerOptionName::Optimization,
+                                            slang::CompilerOptionValue{.intValue0 = SLANG_OPTIMIZATION_LEVEL_NONE});
+                //compileOptions.emplace_back(slang::CompilerOptionName::DebugInformation,
+                //                            slang::CompilerOptionValue{.intValue0 = SLANG_DEBUG_INFO_LEVEL_MAXIMAL});
+                //compileOptions.emplace_back(
+                //    slang::CompilerOptionName::DebugInformationFormat,
+                //    slang::CompilerOptionValue{.intValue0 = SLANG_DEBUG_INFO_FORMAT_DEFAULT /*SLANG_DEBUG_INFO_FORMAT_C7*/});
+                // compileOptions.emplace_back(slang::CompilerOptionName::DumpIntermediates, slang::CompilerOptionValue{.intValue0 = 1});
+            }
+            else
+            {
+                compileOptions.emplace_back(slang::CompilerOptionName::Optimization,
+                                            slang::CompilerOptionValue{.intValue0 = SLANG_OPTIMIZATION_LEVEL_MAXIMAL});
+            }
+
+            std::vector<slang::PreprocessorMacroDesc> preprocessorMacros = {};
+            for (const auto& define : shaderDesc.Defines)
+                preprocessorMacros.emplace_back(define.Name.data(), define.Value.data());
+
+            const slang::SessionDesc sessionDesc = {.targets                  = &targetDesc,
+                                                    .targetCount              = 1,
+                                                    .defaultMatrixLayoutMode  = SLANG_MATRIX_LAYOUT_COLUMN_MAJOR,
+                                                    .preprocessorMacros       = preprocessorMacros.data(),
+                                                    .preprocessorMacroCount   = static_cast<SlangInt>(preprocessorMacros.size()),
+                                                    .compilerOptionEntries    = compileOptions.data(),
+                                                    .compilerOptionEntryCount = static_cast<u32>(compileOptions.size())};
+
+            ComPtr<slang::ISession> localSession;
+            auto slangResult = slangGlobalSession->createSession(sessionDesc, localSession.writeRef());
+            RDNT_ASSERT(SLANG_SUCCEEDED(slangResult), "SLANG: Failed to create local session!");
+
+            ComPtr<slang::IModule> slangModule;
             {
                 ComPtr<slang::IBlob> diagnosticBlob;
-                slangResult = composedProgram->getEntryPointCode(0, 0, spirvCode.writeRef(), diagnosticBlob.writeRef());
+                slangModule = localSession->loadModule(shaderDesc.Path.data(), diagnosticBlob.writeRef());
                 diagnoseSlangBlob(diagnosticBlob);
-                RDNT_ASSERT(SLANG_SUCCEEDED(slangResult), "SLANG: Failed to compile shader program!");
+                if (!slangModule)
+                {
+                    LOG_ERROR("SLANG: Failed to load slang shader: {}", shaderDesc.Path);
+                    return std::nullopt;
+                }
             }
 
-            m_ModuleMap.emplace(shaderStageVK, m_Device->GetLogicalDevice()->createShaderModuleUnique(
-                                                   vk::ShaderModuleCreateInfo()
-                                                       .setPCode(static_cast<const u32*>(spirvCode->getBufferPointer()))
-                                                       .setCodeSize(spirvCode->getBufferSize())));
+            GfxShaderBinaries shaderBinaries{};
+            for (SlangInt32 i{}; i < slangModule->getDependencyFileCount(); ++i)
+                shaderBinaries.DependencyPaths.emplace_back(slangModule->getDependencyFilePath(i));
+
+            // NOTE: Shader itself goes first, cache loading checks it against requested path.
+            const auto normalizedPath = GetNormalizedShaderPath(shaderDesc.Path);
+            std::erase_if(shaderBinaries.DependencyPaths, [&](const std::string& dependencyPath)
+                          { return GetNormalizedShaderPath(dependencyPath) == normalizedPath; });
+            shaderBinaries.DependencyPaths.insert(shaderBinaries.DependencyPaths.begin(), shaderDesc.Path);
 
-            const auto GetStrippedShaderNameFunc = [](const std::string& shaderPath, const std::string& shaderStage) -> std::string
+            for (u32 i{}; i < slangModule->getDefinedEntryPointCount(); ++i)
             {
-                const std::string suffix(".slang");
-                const u64 pos = shaderPath.rfind(suffix);  // Find the last occurrence of ".slang".
-                RDNT_ASSERT(pos != std::string::npos, "Shader path doesn't contain <.slang>!");
-
-                // Search for the previous slash to isolate the filename.
-                const u64 lastSlashIndex = shaderPath.rfind('/', pos);
-                if (lastSlashIndex != std::string::npos)  // Get filename with .slang
-                    return shaderPath.substr(lastSlashIndex + 1) + "." + shaderStage;
-                else  // If no slash is found, return the whole substring including .slang
-                    return shaderPath.substr(0, pos + suffix.length()) + "." + shaderStage;
+                std::vector<slang::IComponentType*> shaderComponents{slangModule};
+
+                ComPtr<slang::IEntryPoint> entryPoint;
+                slangResult = slangModule->getDefinedEntryPoint(i, entryPoint.writeRef());
+                RDNT_ASSERT(SLANG_SUCCEEDED(slangResult) && entryPoint, "Failed to retrieve entry point [{}] from shader: {}", i,
+                            shaderDesc.Path);
+
+                auto entryPointLayout = entryPoint->getLayout();
+                RDNT_ASSERT(entryPointLayout, "SLANG: EntryPointLayout isn't valid!");
+
+                auto reflectedEntryPoint = entryPointLayout->getEntryPointByIndex(0);
+                RDNT_ASSERT(reflectedEntryPoint, "SLANG: ReflectedEntryPoint isn't valid!");
+
+                const auto shaderStageVK = SlangUtils::SlangShaderStageToVulkan(reflectedEntryPoint->getStage());
+                if (shaderBinaries.SPIRV.contains(shaderStageVK)) continue;
+
+                shaderComponents.emplace_back(entryPoint);
+                ComPtr<slang::IComponentType> composedProgram;
+                {
+                    ComPtr<slang::IBlob> diagnosticBlob;
+                    slangResult = localSession->createCompositeComponentType(shaderComponents.data(), shaderComponents.size(),
+                                                                             composedProgram.writeRef(), diagnosticBlob.writeRef());
+                    diagnoseSlangBlob(diagnosticBlob);
+                    if (SLANG_FAILED(slangResult))
+                    {
+                        LOG_ERROR("SLANG: Failed to compose shader program: {}", shaderDesc.Path);
+                        return std::nullopt;
+                    }
+                }
+
+                shaderBinaries.Layouts[shaderStageVK] = SlangUtils::ReflectStageLayout(composedProgram->getLayout());
+
+                ComPtr<slang::IBlob> spirvCode;
+                {
+                    ComPtr<slang::IBlob> diagnosticBlob;
+                    slangResult = composedProgram->getEntryPointCode(0, 0, spirvCode.writeRef(), diagnosticBlob.writeRef());
+                    diagnoseSlangBlob(diagnosticBlob);
+                    if (SLANG_FAILED(slangResult))
+                    {
+                        LOG_ERROR("SLANG: Failed to compile shader program: {}", shaderDesc.Path);
+                        return std::nullopt;
+                    }
+                }
+
+                auto& shaderBinary = shaderBinaries.SPIRV[shaderStageVK];
+                shaderBinary.resize(spirvCode->getBufferSize() / sizeof(u32));
+                std::memcpy(shaderBinary.data(), spirvCode->getBufferPointer(), spirvCode->getBufferSize());
+            }
+
+            return shaderBinaries;
+        }
+
+        bool CompileToCache(const GfxShaderDescription& shaderDesc) noexcept
+        {
+            const auto shaderBinaries = CompileSPIRV(shaderDesc);
+            if (!shaderBinaries.has_value()) return false;
+
+            SaveShaderCache(shaderDesc, *shaderBinaries);
+            return true;
+        }
+
+        NODISCARD static std::vector<std::string> GetStandaloneShaderPaths(const std::string& shaderDir) noexcept
+        {
+            std::vector<std::filesystem::path> slangFiles{};
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(shaderDir))
+                if (entry.is_regular_file() && entry.path().extension() == ".slang") slangFiles.emplace_back(entry.path());
+
+            // NOTE: Files included by others(kernels.slang, FullScreenQuad.slang, ..) are libraries, not standalone shaders.
+            UnorderedSet<std::string> includedFileNames{};
+            for (const auto& slangFile : slangFiles)
+            {
+                std::ifstream file(slangFile);
+                std::string line{};
+                while (std::getline(file, line))
+                {
+                    if (!line.starts_with("#include")) continue;
+
+                    // Both #include "file.slang" and #include <file.slang> are used.
+                    const auto first = line.find_first_of("\"<");
+                    if (first == std::string::npos) continue;
+
+                    const auto last = line.find(line[first] == '<' ? '>' : '"', first + 1);
+                    if (last == std::string::npos) continue;
+
+                    includedFileNames.emplace(std::filesystem::path(line.substr(first + 1, last - first - 1)).filename().string());
+                }
+            }
+
+            std::vector<std::string> shaderPaths{};
+            for (const auto& slangFile : slangFiles)
+                if (!includedFileNames.contains(slangFile.filename().string())) shaderPaths.emplace_back(slangFile.generic_string());
+
+            return shaderPaths;
+        }
+
+        void RunCompileBenchmark(const std::string& shaderDir) noexcept
+        {
+            const auto shaderPaths = GetStandaloneShaderPaths(shaderDir);
+
+            struct CompileResult
+            {
+                u32 StageCount{0};
+                f32 CompileTime{0.0f};
+                bool bSucceeded{false};
             };
 
-            const auto strippedShaderName =
-                std::string(s_ShaderCacheDir) + GetStrippedShaderNameFunc(m_Description.Path, vk::to_string(shaderStageVK));
-            const auto shaderNameSpv = strippedShaderName + ".spv";
+            const auto benchmarkBeginTime = Timer::Now();
+            std::vector<std::future<CompileResult>> compileFutures{};
+            for (const auto& shaderPath : shaderPaths)
+            {
+                compileFutures.emplace_back(Application::Get().GetThreadPool()->Submit(
+                    [shaderPath]() noexcept
+                    {
+                        const auto compileBeginTime = Timer::Now();
+                        const auto shaderBinaries   = CompileSPIRV(GfxShaderDescription{.Path = shaderPath});
+                        const auto compileTime =
+                            std::chrono::duration<f32, std::chrono::milliseconds::period>(Timer::Now() - compileBeginTime).count();
+                        return CompileResult{.StageCount  = shaderBinaries.has_value() ? static_cast<u32>(shaderBinaries->SPIRV.size()) : 0,
+                                             .CompileTime = compileTime,
+                                             .bSucceeded  = shaderBinaries.has_value()};
+                    }));
+            }
+
+            u32 totalStageCount{0}, failedShaderCount{0};
+            f32 totalCompileTime{0.0f};
+            for (u64 i{}; i < compileFutures.size(); ++i)
+            {
+                const auto compileResult = compileFutures[i].get();
+                LOG_INFO("\t[{}] {} stages in {:.4f} ms{}", shaderPaths[i], compileResult.StageCount, compileResult.CompileTime,
+                         compileResult.bSucceeded ? "" : " (FAILED)");
+
+                totalStageCount += compileResult.StageCount;
+                totalCompileTime += compileResult.CompileTime;
+                if (!compileResult.bSucceeded) ++failedShaderCount;
+            }
+
+            const auto benchmarkTime =
+                std::chrono::duration<f32, std::chrono::milliseconds::period>(Timer::Now() - benchmarkBeginTime).count();
+            LOG_INFO("Shader compile benchmark: {} shaders({} failed), {} stages, {:.4f} ms wall time, {:.4f} ms summed compile time.",
+                     shaderPaths.size(), failedShaderCount, totalStageCount, benchmarkTime, totalCompileTime);
+        }
+
+        bool RunLayoutAudit(const std::string& shaderDir, const std::string& budgetsPath) noexcept
+        {
+            // NOTE: Plain text, "<shader path relative to shaderDir> <max push constant bytes>" per line, '#' starts a comment, "*" entry
+            // is the default one. Vulkan guarantees only 128 bytes of push constants, so that's the default if file doesn't say otherwise.
+            UnorderedMap<std::string, u64> pushConstantBudgets{{"*", 128}};
+            if (std::ifstream budgetsFile(budgetsPath); budgetsFile.is_open())
+            {
+                std::string line{};
+                while (std::getline(budgetsFile, line))
+                {
+                    std::istringstream lineStream(line.substr(0, line.find('#')));
+                    std::string shaderPath{};
+                    u64 budgetBytes{0};
+                    if (lineStream >> shaderPath >> budgetBytes) pushConstantBudgets.insert_or_assign(std::move(shaderPath), budgetBytes);
+                }
+            }
+            else
+                LOG_WARN("Shader layout audit: budgets file [{}] not found, default budget is used.", budgetsPath);
+
+            // Shaders with budgets are audited even if they're included by others(main pass is included by its gpu driven variant).
+            auto shaderPaths = GetStandaloneShaderPaths(shaderDir);
+            for (const auto& budgetShaderPath : pushConstantBudgets | std::views::keys)
+            {
+                if (budgetShaderPath == "*") continue;
+
+                const auto shaderPath = (std::filesystem::path(shaderDir) / budgetShaderPath).generic_string();
+                if (std::filesystem::exists(shaderPath) && std::ranges::find(shaderPaths, shaderPath) == shaderPaths.end())
+                    shaderPaths.emplace_back(shaderPath);
+            }
+
+            std::vector<std::future<std::optional<GfxShaderBinaries>>> compileFutures{};
+            for (const auto& shaderPath : shaderPaths)
+            {
+                compileFutures.emplace_back(Application::Get().GetThreadPool()->Submit(
+                    [shaderPath]() noexcept { return CompileSPIRV(GfxShaderDescription{.Path = shaderPath}); }));
+            }
+
+            u32 failedShaderCount{0};
+            u64 totalPushConstantPaddingBytes{0};
+            for (u64 i{}; i < compileFutures.size(); ++i)
+            {
+                const auto shaderBinaries = compileFutures[i].get();
+                if (!shaderBinaries.has_value())
+                {
+                    LOG_ERROR("\t[{}] FAILED to compile.", shaderPaths[i]);
+                    ++failedShaderCount;
+                    continue;
+                }
+
+                // Single push constant range is shared by every stage and the whole block is pushed before each draw(dispatch).
+                u64 pushConstantBytes{0}, pushConstantPaddingBytes{0};
+                bool bCompute{false};
+                std::vector<GfxShaderBlockLayout> uniformBlocks{};
+                for (const auto& [shaderStageVK, stageLayout] : shaderBinaries->Layouts)
+                {
+                    bCompute |= shaderStageVK == vk::ShaderStageFlagBits::eCompute;
+                    if (stageLayout.PushConstants.has_value() && stageLayout.PushConstants->SizeBytes > pushConstantBytes)
+                    {
+                        pushConstantBytes        = stageLayout.PushConstants->SizeBytes;
+                        pushConstantPaddingBytes = stageLayout.PushConstants->PaddingBytes;
+                    }
+
+                    for (const auto& uniformBlock : stageLayout.UniformBlocks)
+                        if (std::ranges::find(uniformBlocks, uniformBlock.Name, &GfxShaderBlockLayout::Name) == uniformBlocks.end())
+                            uniformBlocks.emplace_back(uniformBlock);
+                }
+                totalPushConstantPaddingBytes += pushConstantPaddingBytes;
+
+                const auto relativePath = std::filesystem::relative(shaderPaths[i], shaderDir).generic_string();
+                const auto budgetIt     = pushConstantBudgets.find(relativePath);
+                const u64 budgetBytes   = budgetIt != pushConstantBudgets.end() ? budgetIt->second : pushConstantBudgets["*"];
+                const bool bOverBudget  = pushConstantBytes > budgetBytes;
+
+                LOG_INFO("\t[{}] push constants: {} bytes per {}({} padding), budget: {} bytes{}", relativePath, pushConstantBytes,
+                         bCompute ? "dispatch" : "draw", pushConstantPaddingBytes, budgetBytes, bOverBudget ? " (OVER BUDGET)" : "");
+                for (const auto& uniformBlock : uniformBlocks)
+                    LOG_INFO("\t\t{}: {} bytes({} padding)", uniformBlock.Name, uniformBlock.SizeBytes, uniformBlock.PaddingBytes);
+
+                if (!bOverBudget) continue;
+
+                LOG_ERROR("Shader layout audit: [{}] pushes {} bytes, budget is {} bytes!", relativePath, pushConstantBytes, budgetBytes);
+                ++failedShaderCount;
+            }
+
+            LOG_INFO("Shader layout audit: {} shaders, {} failed, {} bytes of push constant padding in total.", shaderPaths.size(),
+                     failedShaderCount, totalPushConstantPaddingBytes);
+            return failedShaderCount == 0;
+        }
 
-            // Save raw SPIR-V shader cache.
-            const auto elementsNum = spirvCode->getBufferSize() / sizeof(u32);
-            std::vector<u32> cache(elementsNum);
+    }  // namespace GfxShaderUtils
 
-            std::memcpy(cache.data(), spirvCode->getBufferPointer(), spirvCode->getBufferSize());
-            CoreUtils::SaveData(shaderNameSpv, cache);
+    NODISCARD std::vector<vk::PipelineShaderStageCreateInfo> GfxShader::GetShaderStages(
+        const vk::SpecializationInfo* specializationInfo) noexcept
+    {
+        std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
+        if (m_ModuleMap.empty()) Invalidate();
+
+        for (auto& [shaderStage, module] : m_ModuleMap)
+        {
+            RDNT_ASSERT(module, "Shader module isnt' valid!s");
 
-            // Save last write time used for hot-reloading.
-            const auto lastWriteTime  = static_cast<u32>(std::filesystem::last_write_time(m_Description.Path).time_since_epoch().count());
-            const auto shaderNameMeta = strippedShaderName + ".meta";
-            CoreUtils::SaveData(shaderNameMeta, &lastWriteTime, sizeof(lastWriteTime));
+            shaderStages.emplace_back(vk::PipelineShaderStageCreateInfo()
+                                          .setStage(shaderStage)
+                                          .setModule(*module)
+                                          .setPName("main")
+                                          .setPSpecializationInfo(specializationInfo));
         }
+
+        RDNT_ASSERT(!shaderStages.empty(), "Shaders aren't compiled!");
+        return shaderStages;
+    }
+
+    void GfxShader::Invalidate() noexcept
+    {
+        if (TryLoadCache()) return;
+
+        const auto shaderBinaries = GfxShaderUtils::CompileSPIRV(m_Description);
+        RDNT_ASSERT(shaderBinaries.has_value(), "SLANG: Failed to compile shader: {}", m_Description.Path);
+
+        for (const auto& [shaderStageVK, shaderBinary] : shaderBinaries->SPIRV)
+        {
+            m_StageHashMap.emplace(shaderStageVK, ankerl::unordered_dense::detail::wyhash::hash(
+                                                      shaderBinary.data(), shaderBinary.size() * sizeof(shaderBinary[0])));
+            m_ModuleMap.emplace(shaderStageVK, m_Device->GetLogicalDevice()->createShaderModuleUnique(
+                                                   vk::ShaderModuleCreateInfo()
+                                                       .setPCode(shaderBinary.data())
+                                                       .setCodeSize(shaderBinary.size() * sizeof(shaderBinary[0]))));
+        }
+
+        m_DependencyPaths = shaderBinaries->DependencyPaths;
+
+        GfxShaderUtils::SaveShaderCache(m_Description, *shaderBinaries);
     }
 
     bool GfxShader::TryLoadCache() noexcept
@@ -214,68 +663,71 @@ namespace Radiant
 
         if (!std::filesystem::exists(s_ShaderCacheDir)) std::filesystem::create_directory(s_ShaderCacheDir);
 
-        static constexpr std::array<vk::ShaderStageFlagBits, 16> shaderStagesVK = {vk::ShaderStageFlagBits::eVertex,
-                                                                                   vk::ShaderStageFlagBits::eTessellationControl,
-                                                                                   vk::ShaderStageFlagBits::eTessellationEvaluation,
-                                                                                   vk::ShaderStageFlagBits::eGeometry,
-                                                                                   vk::ShaderStageFlagBits::eFragment,
-                                                                                   vk::ShaderStageFlagBits::eCompute,
-                                                                                   vk::ShaderStageFlagBits::eRaygenKHR,
-                                                                                   vk::ShaderStageFlagBits::eAnyHitKHR,
-                                                                                   vk::ShaderStageFlagBits::eClosestHitKHR,
-                                                                                   vk::ShaderStageFlagBits::eMissKHR,
-                                                                                   vk::ShaderStageFlagBits::eIntersectionKHR,
-                                                                                   vk::ShaderStageFlagBits::eCallableKHR,
-                                                                                   vk::ShaderStageFlagBits::eTaskEXT,
-                                                                                   vk::ShaderStageFlagBits::eMeshEXT,
-                                                                                   vk::ShaderStageFlagBits::eSubpassShadingHUAWEI,
-                                                                                   vk::ShaderStageFlagBits::eClusterCullingHUAWEI};
-
-        bool bEverythingLoaded{true};
-        for (const auto shaderStageVK : shaderStagesVK)
+        const auto shaderCacheName = GfxShaderUtils::GetShaderCacheName(m_Description);
+        if (!std::filesystem::exists(shaderCacheName)) return false;
+
+        using namespace ShaderCacheUtils;
+        const std::vector<u8> cacheData = CoreUtils::LoadData<u8>(shaderCacheName);
+        if (cacheData.size() < sizeof(ShaderCacheHeader)) return false;
+
+        ShaderCacheHeader header = {};
+        std::memcpy(&header, cacheData.data(), sizeof(header));
+        if (header.Magic != s_ShaderCacheMagic || header.Version != s_ShaderCacheVersion || header.FileSizeBytes != cacheData.size())
+            return false;
+
+        // NOTE: Cache file can be truncated or garbage, every offset read from it is checked before use, overflow-safe.
+        const auto IsRangeValidFunc = [&](const u64 offset, const u64 sizeBytes) noexcept
+        { return offset <= cacheData.size() && sizeBytes <= cacheData.size() - offset; };
+
+        if (!IsRangeValidFunc(header.DependenciesOffset, header.DependencyCount * sizeof(ShaderCacheString)) ||
+            !IsRangeValidFunc(header.StagesOffset, header.StageCount * sizeof(ShaderCacheStage)))
+            return false;
+
+        std::vector<ShaderCacheString> dependencies(header.DependencyCount);
+        std::memcpy(dependencies.data(), cacheData.data() + header.DependenciesOffset, dependencies.size() * sizeof(dependencies[0]));
+
+        std::vector<std::string> dependencyPaths{};
+        for (const auto& dependency : dependencies)
         {
-            const auto GetCachedShaderNameFunc = [](const std::string& shaderPath, const std::string& shaderStage) -> std::string
-            {
-                const std::string suffix(".slang");
-                const u64 pos = shaderPath.rfind(suffix);  // Find the last occurrence of ".slang".
-                RDNT_ASSERT(pos != std::string::npos, "Shader path doesn't contain <.slang>!");
-
-                // Search for the previous slash to isolate the filename.
-                const u64 lastSlashIndex = shaderPath.rfind('/', pos);
-                if (lastSlashIndex != std::string::npos)  // Get filename with .slang
-                    return shaderPath.substr(lastSlashIndex + 1) + "." + shaderStage;
-                else  // If no slash is found, return the whole substring including .slang
-                    return shaderPath.substr(0, pos + suffix.length()) + "." + shaderStage;
-            };
+            if (!IsRangeValidFunc(dependency.Offset, dependency.Length)) return false;
 
-            const auto strippedShaderName =
-                std::string(s_ShaderCacheDir) + GetCachedShaderNameFunc(m_Description.Path, vk::to_string(shaderStageVK));
+            dependencyPaths.emplace_back(reinterpret_cast<const char*>(cacheData.data() + dependency.Offset), dependency.Length);
+        }
 
-            const auto shaderNameMeta  = strippedShaderName + ".meta";
-            const auto shaderCacheName = strippedShaderName + ".spv";
-            if (!std::filesystem::exists(shaderCacheName) || !std::filesystem::exists(shaderNameMeta)) continue;
+        // Name hash collision or cache copied over from another shader.
+        if (dependencyPaths.empty() ||
+            GfxShaderUtils::GetNormalizedShaderPath(dependencyPaths.front()) != GfxShaderUtils::GetNormalizedShaderPath(m_Description.Path))
+            return false;
 
-            const std::vector<u32> cacheData = CoreUtils::LoadData<u32>(shaderCacheName);
-            RDNT_ASSERT(!cacheData.empty(), "Failed to load shader cache!");
+        // Stale cache(some file in dependency closure changed or is gone), recompile.
+        if (const auto cacheKey = MakeShaderCacheKey(m_Description, dependencyPaths); !cacheKey.has_value() || *cacheKey != header.Key)
+            return false;
 
-            const std::vector<u32> metaData = CoreUtils::LoadData<u32>(shaderNameMeta);
-            RDNT_ASSERT(!metaData.empty(), "Failed to load shader metadata!");
+        std::vector<ShaderCacheStage> stages(header.StageCount);
+        std::memcpy(stages.data(), cacheData.data() + header.StagesOffset, stages.size() * sizeof(stages[0]));
+        for (const auto& stage : stages)
+        {
+            if (stage.WordCount == 0 || stage.CodeOffset % sizeof(u32) != 0 ||
+                !IsRangeValidFunc(stage.CodeOffset, static_cast<u64>(stage.WordCount) * sizeof(u32)))
+                return false;
+        }
 
-            // Get the last modified time of the whole slang file!
-            const auto lastWriteTime = static_cast<u32>(std::filesystem::last_write_time(m_Description.Path).time_since_epoch().count());
-            if (metaData[0] != lastWriteTime)
-            {
-                bEverythingLoaded = false;
-                continue;
-            }
+        m_DependencyPaths = std::move(dependencyPaths);
 
-            m_ModuleMap.emplace(
-                shaderStageVK,
-                m_Device->GetLogicalDevice()->createShaderModuleUnique(
-                    vk::ShaderModuleCreateInfo().setPCode(cacheData.data()).setCodeSize(cacheData.size() * sizeof(cacheData[0]))));
+        for (const auto& stage : stages)
+        {
+            // NOTE: Sections are aligned, so SPIR-V words are read in place.
+            m_StageHashMap.emplace(static_cast<vk::ShaderStageFlagBits>(stage.Stage),
+                                   ankerl::unordered_dense::detail::wyhash::hash(cacheData.data() + stage.CodeOffset,
+                                                                                 stage.WordCount * sizeof(u32)));
+            m_ModuleMap.emplace(static_cast<vk::ShaderStageFlagBits>(stage.Stage),
+                                m_Device->GetLogicalDevice()->createShaderModuleUnique(
+                                    vk::ShaderModuleCreateInfo()
+                                        .setPCode(reinterpret_cast<const u32*>(cacheData.data() + stage.CodeOffset))
+                                        .setCodeSize(stage.WordCount * sizeof(u32))));
         }
 
-        return bEverythingLoaded && !m_ModuleMap.empty();
+        return !m_ModuleMap.empty();
     }
 
 }  // namespace Radiant
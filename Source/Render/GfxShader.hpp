@@ -1,39 +1,111 @@
 #pragma once
 
+#include <Render/CoreDefines.hpp>
 #include <vulkan/vulkan.hpp>
 
 namespace Radiant
 {
 
+    struct GfxShaderDefine
+    {
+        std::string Name{s_DEFAULT_STRING};
+        std::string Value{"1"};
+    };
+    using GfxShaderDefines = std::vector<GfxShaderDefine>;
+
     struct GfxShaderDescription
     {
-        // TODO: Per shader-stage defines
         std::string Path{s_DEFAULT_STRING};
+        GfxShaderDefines Defines{};  // Applied to every entry point, each define set gets its own cache entry.
     };
 
+    // NOTE: Reflected by slang with the same(scalar) layout rules compiled code uses. Padding covers alignment holes and tail padding
+    // of nested structs and arrays too.
+    struct GfxShaderBlockLayout
+    {
+        std::string Name{s_DEFAULT_STRING};
+        u64 SizeBytes{0};
+        u64 PaddingBytes{0};
+    };
+
+    struct GfxShaderStageLayout
+    {
+        std::optional<GfxShaderBlockLayout> PushConstants{std::nullopt};
+        std::vector<GfxShaderBlockLayout> UniformBlocks{};  // Constant buffers + structs read through push constant pointers(camera, ..).
+    };
+
+    struct GfxShaderBinaries
+    {
+        UnorderedMap<vk::ShaderStageFlagBits, std::vector<u32>> SPIRV{};
+        std::vector<std::string> DependencyPaths{};  // Shader itself + everything it includes, cache key is built out of their contents.
+        UnorderedMap<vk::ShaderStageFlagBits, GfxShaderStageLayout> Layouts{};  // Filled by compiler only, isn't cached.
+    };
+
+    namespace GfxShaderUtils
+    {
+        // NOTE: Order independent, 0 is reserved for empty define set(generic variant).
+        NODISCARD u64 HashDefines(const GfxShaderDefines& defines) noexcept;
+
+        // NOTE: Lexically normalized, forward slashes, so "../Assets/Shaders/./final.slang" and slang reported paths compare equal.
+        NODISCARD std::string GetNormalizedShaderPath(const std::string_view& shaderPath) noexcept;
+
+        NODISCARD u32 GetSpecializationConstant(const GfxSpecializationConstants& constants, const u32 id, const u32 defaultValue) noexcept;
+
+        // NOTE: Device independent, bypasses cache, safe to call from any thread. Empty on compile errors(diagnostics are logged).
+        NODISCARD std::optional<GfxShaderBinaries> CompileSPIRV(const GfxShaderDescription& shaderDesc) noexcept;
+
+        // NOTE: Same as above, but result goes straight into shader cache, so the next shader load picks it up. False on compile errors.
+        NODISCARD bool CompileToCache(const GfxShaderDescription& shaderDesc) noexcept;
+
+        // NOTE: Headless, compiles every shader(.slang file that isn't included by others) under shaderDir concurrently on thread pool
+        // and reports per shader and total times.
+        void RunCompileBenchmark(const std::string& shaderDir) noexcept;
+
+        // NOTE: Headless, reports push constant and uniform block sizes, padding waste and bytes pushed per draw(dispatch) of every shader
+        // under shaderDir. False if any shader fails to compile or its push constants exceed budget from budgetsPath.
+        NODISCARD bool RunLayoutAudit(const std::string& shaderDir, const std::string& budgetsPath) noexcept;
+
+    }  // namespace GfxShaderUtils
+
     class GfxDevice;
     class GfxShader final : private Uncopyable, private Unmovable
     {
       public:
+        // NOTE: Compiled lazily on first GetShaderStages(), which is usually called by pipeline build job on thread pool.
         GfxShader(const Unique<GfxDevice>& device, const GfxShaderDescription& shaderDesc) noexcept
             : m_Device(device), m_Description(shaderDesc)
         {
-            Invalidate();
         }
         ~GfxShader() noexcept = default;
 
-        void Clear() noexcept { m_ModuleMap.clear(); }
-        NODISCARD std::vector<vk::PipelineShaderStageCreateInfo> GetShaderStages() noexcept;
-        FORCEINLINE void HotReload() noexcept
+        NODISCARD FORCEINLINE const auto& GetDescription() const noexcept { return m_Description; }
+        void Clear() noexcept
+        {
+            m_ModuleMap.clear();
+            m_StageHashMap.clear();
+        }
+        NODISCARD std::vector<vk::PipelineShaderStageCreateInfo> GetShaderStages(
+            const vk::SpecializationInfo* specializationInfo = nullptr) noexcept;
+
+        // NOTE: Hash of stage SPIR-V, valid in between GetShaderStages() and Clear(). 0 if there's no such stage.
+        NODISCARD FORCEINLINE u64 GetStageHash(const vk::ShaderStageFlagBits shaderStage) const noexcept
         {
-            Clear();
-            Invalidate();
+            const auto it = m_StageHashMap.find(shaderStage);
+            return it != m_StageHashMap.end() ? it->second : 0;
         }
 
+        // NOTE: Shader itself + everything it includes as reported by slang, valid after first GetShaderStages(), survives Clear().
+        NODISCARD FORCEINLINE const auto& GetDependencyPaths() const noexcept { return m_DependencyPaths; }
+
       private:
+        friend class GfxPipeline;  // Locks m_Mtx while building pipeline, shader can be shared by pipelines built concurrently.
+
         const Unique<GfxDevice>& m_Device;
         GfxShaderDescription m_Description{};
         UnorderedMap<vk::ShaderStageFlagBits, vk::UniqueShaderModule> m_ModuleMap;
+        UnorderedMap<vk::ShaderStageFlagBits, u64> m_StageHashMap;  // Pipeline library parts are shared by stage contents.
+        std::vector<std::string> m_DependencyPaths{};
+        std::mutex m_Mtx{};
 
         constexpr GfxShader() noexcept = delete;
         void Invalidate() noexcept;
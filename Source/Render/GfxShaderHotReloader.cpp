@@ -0,0 +1,136 @@
+#include "GfxShaderHotReloader.hpp"
+
+#include <Core/Application.hpp>
+#include <Render/GfxPipeline.hpp>
+
+namespace Radiant
+{
+
+    namespace ShaderHotReloaderUtils
+    {
+        NODISCARD static std::string MakeShaderKey(const GfxShaderDescription& shaderDesc) noexcept
+        {
+            return shaderDesc.Path + "|" + std::to_string(GfxShaderUtils::HashDefines(shaderDesc.Defines));
+        }
+
+        NODISCARD static std::future<bool> SubmitRecompile(const GfxShaderDescription& shaderDesc) noexcept
+        {
+            return Application::Get().GetThreadPool()->Submit([shaderDesc]() noexcept
+                                                              { return GfxShaderUtils::CompileToCache(shaderDesc); });
+        }
+
+    }  // namespace ShaderHotReloaderUtils
+
+    void GfxShaderHotReloader::RecordDependencies(GfxPipeline* pipeline, const std::vector<std::string>& dependencyPaths) noexcept
+    {
+        std::vector<std::string> canonicalPaths{};
+        for (const auto& dependencyPath : dependencyPaths)
+        {
+            std::error_code errorCode{};
+            const auto canonicalPath = std::filesystem::weakly_canonical(dependencyPath, errorCode);
+            if (errorCode) continue;
+
+            m_FileWatcher.Watch(canonicalPath);
+            canonicalPaths.emplace_back(canonicalPath.string());
+        }
+
+        std::scoped_lock lock(m_Mtx);
+        m_PipelineDependencies.insert_or_assign(pipeline, std::move(canonicalPaths));
+    }
+
+    void GfxShaderHotReloader::Forget(GfxPipeline* pipeline) noexcept
+    {
+        std::scoped_lock lock(m_Mtx);
+        m_PipelineDependencies.erase(pipeline);
+        std::erase(m_DeferredRebuilds, pipeline);
+    }
+
+    void GfxShaderHotReloader::Update() noexcept
+    {
+        const auto changedFiles = m_FileWatcher.PollChanges();
+
+        std::vector<GfxPipeline*> pipelinesToRebuild{};
+        {
+            std::scoped_lock lock(m_Mtx);
+            pipelinesToRebuild = std::exchange(m_DeferredRebuilds, {});
+            for (const auto& changedFile : changedFiles)
+            {
+                for (const auto& [pipeline, dependencyPaths] : m_PipelineDependencies)
+                {
+                    if (std::ranges::find(dependencyPaths, changedFile) == dependencyPaths.end()) continue;
+
+                    // Shader can be shared by pipelines(or created per pipeline out of the same description), it's compiled only once.
+                    const auto& shaderDesc = pipeline->GetDescription().Shader->GetDescription();
+                    const auto shaderKey   = ShaderHotReloaderUtils::MakeShaderKey(shaderDesc);
+                    if (const auto it = m_PendingRecompiles.find(shaderKey); it != m_PendingRecompiles.end())
+                    {
+                        it->second.bChangedAgain = true;
+                        continue;
+                    }
+
+                    LOG_INFO("Shader hot reload: [{}] changed, recompiling [{}].", changedFile, shaderDesc.Path);
+                    auto& pendingRecompile             = m_PendingRecompiles[shaderKey];
+                    pendingRecompile.ShaderDescription = shaderDesc;
+                    pendingRecompile.CompileFuture     = ShaderHotReloaderUtils::SubmitRecompile(shaderDesc);
+                }
+            }
+
+            for (auto it = m_PendingRecompiles.begin(); it != m_PendingRecompiles.end();)
+            {
+                auto& [shaderKey, pendingRecompile] = *it;
+                if (pendingRecompile.CompileFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                {
+                    ++it;
+                    continue;
+                }
+
+                const bool bCompiled = pendingRecompile.CompileFuture.get();
+                if (pendingRecompile.bChangedAgain)
+                {
+                    pendingRecompile.bChangedAgain = false;
+                    pendingRecompile.CompileFuture = ShaderHotReloaderUtils::SubmitRecompile(pendingRecompile.ShaderDescription);
+                    ++it;
+                    continue;
+                }
+
+                if (bCompiled)
+                {
+                    for (const auto& [pipeline, dependencyPaths] : m_PipelineDependencies)
+                    {
+                        if (ShaderHotReloaderUtils::MakeShaderKey(pipeline->GetDescription().Shader->GetDescription()) == shaderKey &&
+                            std::ranges::find(pipelinesToRebuild, pipeline) == pipelinesToRebuild.end())
+                            pipelinesToRebuild.emplace_back(pipeline);
+                    }
+                }
+                else
+                    LOG_WARN("Shader hot reload: [{}] failed to compile, old pipelines are kept.", pendingRecompile.ShaderDescription.Path);
+
+                it = m_PendingRecompiles.erase(it);
+            }
+        }
+
+        // NOTE: Outside the lock, rebuild jobs record new dependencies(includes could've been added or removed). Rebuilds are kicked off
+        // from main thread only, so pipeline that isn't busy now can't become busy before HotReload().
+        std::vector<GfxPipeline*> busyPipelines{};
+        for (auto* pipeline : pipelinesToRebuild)
+        {
+            if (pipeline->IsHotReloadGoing())
+            {
+                busyPipelines.emplace_back(pipeline);
+                continue;
+            }
+
+            pipeline->HotReload();
+        }
+
+        if (busyPipelines.empty()) return;
+
+        std::scoped_lock lock(m_Mtx);
+        for (auto* pipeline : busyPipelines)
+        {
+            // Forgotten(destroyed) pipelines are dropped.
+            if (m_PipelineDependencies.contains(pipeline)) m_DeferredRebuilds.emplace_back(pipeline);
+        }
+    }
+
+}  // namespace Radiant
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Core/FileWatcher.hpp>
+#include <Render/GfxShader.hpp>
+
+namespace Radiant
+{
+
+    class GfxPipeline;
+
+    // NOTE: Include dependency graph of every live pipeline(recorded from slang whenever pipeline's shader is compiled or loaded from
+    // cache), files it consists of are watched. Saved file gets each affected shader(define set) recompiled once on thread pool straight
+    // into shader cache, then only pipelines built out of them are rebuilt(loading that cache). Shader with compile errors keeps its old
+    // pipelines, so broken saves can be fixed on the fly. Pipelines that are still being rebuilt at that moment are retried once their
+    // current build is done, otherwise they'd end up with the outdated shader.
+    class GfxShaderHotReloader final : private Uncopyable, private Unmovable
+    {
+      public:
+        GfxShaderHotReloader() noexcept  = default;
+        ~GfxShaderHotReloader() noexcept = default;
+
+        // NOTE: Thread-safe, called by pipeline build jobs.
+        void RecordDependencies(GfxPipeline* pipeline, const std::vector<std::string>& dependencyPaths) noexcept;
+        void Forget(GfxPipeline* pipeline) noexcept;
+
+        void Update() noexcept;  // Once per frame, kicks off recompiles and rebuilds.
+
+      private:
+        struct PendingRecompile
+        {
+            GfxShaderDescription ShaderDescription{};
+            std::future<bool> CompileFuture{};
+            bool bChangedAgain{false};  // Saved once more while compiling, result is outdated.
+        };
+
+        FileWatcher m_FileWatcher{};
+        std::mutex m_Mtx{};
+        UnorderedMap<GfxPipeline*, std::vector<std::string>> m_PipelineDependencies;  // Canonical paths.
+        UnorderedMap<std::string, PendingRecompile> m_PendingRecompiles;               // Key is shader path + define set hash.
+        // Were busy rebuilding when their shader got recompiled, retried every Update().
+        std::vector<GfxPipeline*> m_DeferredRebuilds;
+    };
+
+}  // namespace Radiant
@@ -106,6 +106,16 @@ namespace Radiant
             m_TexturesToLoad[dstFormat].emplace_back(texturePath);
         }
 
+        void TextureCompressor::PushTextureIntoBatchList(const std::string& textureName, const std::span<const u8> rawImageData,
+                                                         const vk::Format dstFormat) noexcept
+        {
+            RDNT_ASSERT(!textureName.empty(), "Texture name is invalid!");
+            RDNT_ASSERT(!rawImageData.empty(), "Raw image data is empty!");
+            if (IsCacheExist(textureName, dstFormat)) return;
+
+            m_TexturesToLoad[dstFormat].emplace_back(textureName, rawImageData);
+        }
+
         void TextureCompressor::CompressAndCache() noexcept
         {
             if (m_TexturesToLoad.empty()) return;
@@ -126,7 +136,7 @@ namespace Radiant
             u64 currentBatchSize                     = 0;
             u32 currentBatchCount{};
 
-            for (const auto& [format, texturePaths] : m_TexturesToLoad)
+            for (const auto& [format, textureSources] : m_TexturesToLoad)
             {
                 nvtt::CompressionOptions compressionOptions = {};
                 compressionOptions.setFormat(VulkanFormatToNvttFormat(format));
@@ -136,32 +146,34 @@ namespace Radiant
 
                 // NOTE: Storing array of unique ptrs since surface should be per mip per face.
                 std::vector<Unique<nvtt::Surface>> surfaceList;
-                surfaceList.reserve(texturePaths.size());
+                surfaceList.reserve(textureSources.size());
 
-                std::vector<nvtt::OutputOptions> outputOptionList(texturePaths.size());
-                std::vector<std::string> outputTexturePaths(texturePaths.size());
-                std::vector<Unique<RadiantTextureFileWriter>> textureFileWriters(texturePaths.size());
+                std::vector<nvtt::OutputOptions> outputOptionList(textureSources.size());
+                std::vector<std::string> outputTexturePaths(textureSources.size());
+                std::vector<Unique<RadiantTextureFileWriter>> textureFileWriters(textureSources.size());
 
                 // NOTE: Currently hardcoded, will be extended as needed.
                 constexpr i32 face = 0;
 
                 u32 i{};
-                while (i < texturePaths.size())
+                while (i < textureSources.size())
                 {
                     currentBatchCount         = 0;
                     currentBatchSize          = 0;
                     nvtt::BatchList batchList = {};
-                    for (; i < texturePaths.size(); ++i)
+                    for (; i < textureSources.size(); ++i)
                     {
-                        const auto& texturePath  = texturePaths[i];
-                        const auto texturePathFS = std::filesystem::path(texturePath);
-                        RDNT_ASSERT(std::filesystem::exists(texturePathFS), "Texture path: {}, doesn't exist!", texturePath);
+                        const auto& [texturePath, rawData] = textureSources[i];
+                        const bool bIsInMemory             = !rawData.empty();
+                        RDNT_ASSERT(bIsInMemory || std::filesystem::exists(texturePath), "Texture path: {}, doesn't exist!", texturePath);
 
-                        const auto currentFileSizeBytes = std::filesystem::file_size(texturePathFS);
+                        const u64 currentFileSizeBytes = bIsInMemory ? rawData.size() : std::filesystem::file_size(texturePath);
                         if (currentBatchSize + currentFileSizeBytes > batchSizeLimitBytes && currentBatchSize > 0) break;
 
                         auto& srcImage = *surfaceList.emplace_back(MakeUnique<nvtt::Surface>());
-                        RDNT_ASSERT(srcImage.load(texturePath.data()), "Failed to load: {}", texturePath);
+                        RDNT_ASSERT(bIsInMemory ? srcImage.loadFromMemory(rawData.data(), rawData.size())
+                                                : srcImage.load(texturePath.data()),
+                                    "Failed to load: {}", texturePath);
 
                         const auto dimensions = glm::uvec2(srcImage.width(), srcImage.height());
                         const u32 mipCount    = srcImage.countMipmaps();
@@ -377,6 +389,177 @@ namespace Radiant
             return std::filesystem::exists(textureCachePath);
         }
 
+        struct TextureSnapshotHeader
+        {
+            u64 CacheKey{0};
+            vk::Format Format{vk::Format::eUndefined};
+            glm::uvec2 Dimensions{1};
+            u32 LayerCount{1};
+            u32 MipCount{1};
+
+            bool operator==(const TextureSnapshotHeader& other) const noexcept = default;
+        };
+
+        NODISCARD static TextureSnapshotHeader MakeTextureSnapshotHeader(const u64 cacheKey, const GfxTexture& texture) noexcept
+        {
+            const auto& textureDesc = texture.GetDescription();
+            return TextureSnapshotHeader{.CacheKey   = cacheKey,
+                                         .Format     = textureDesc.Format,
+                                         .Dimensions = glm::uvec2(textureDesc.Dimensions),
+                                         .LayerCount = textureDesc.LayerCount,
+                                         .MipCount   = texture.GetMipCount()};
+        }
+
+        // NOTE: Mips are packed one after another, each mip holds all layers.
+        NODISCARD static std::vector<vk::BufferImageCopy> GetTextureSnapshotCopyRegions(const GfxTexture& texture,
+                                                                                        u64& outSnapshotSizeBytes) noexcept
+        {
+            const auto& textureDesc = texture.GetDescription();
+            RDNT_ASSERT(!GfxTexture::IsDepthFormat(textureDesc.Format), "Texture snapshots support color formats only!");
+
+            const u64 texelSizeBytes = vk::blockSize(textureDesc.Format);
+            outSnapshotSizeBytes     = 0;
+
+            std::vector<vk::BufferImageCopy> copyRegions(texture.GetMipCount());
+            glm::uvec2 mipDimensions{textureDesc.Dimensions};
+            for (u32 mipLevel{}; mipLevel < copyRegions.size(); ++mipLevel)
+            {
+                copyRegions[mipLevel] = vk::BufferImageCopy()
+                                            .setBufferOffset(outSnapshotSizeBytes)
+                                            .setImageSubresource(vk::ImageSubresourceLayers()
+                                                                     .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                                                     .setBaseArrayLayer(0)
+                                                                     .setLayerCount(textureDesc.LayerCount)
+                                                                     .setMipLevel(mipLevel))
+                                            .setImageExtent(vk::Extent3D(mipDimensions.x, mipDimensions.y, 1));
+
+                outSnapshotSizeBytes += static_cast<u64>(mipDimensions.x) * mipDimensions.y * textureDesc.LayerCount * texelSizeBytes;
+                mipDimensions = glm::max(mipDimensions / 2u, glm::uvec2(1));
+            }
+
+            return copyRegions;
+        }
+
+        NODISCARD bool LoadTextureSnapshot(const std::string& cachePath, const u64 cacheKey, GfxTexture& texture) noexcept
+        {
+            if (!std::filesystem::exists(cachePath)) return false;
+
+            const auto rawData = CoreUtils::LoadData<u8>(cachePath);
+            if (rawData.size() < sizeof(TextureSnapshotHeader)) return false;
+
+            auto snapshotHeader = TextureSnapshotHeader{};
+            std::memcpy(&snapshotHeader, rawData.data(), sizeof(snapshotHeader));
+            if (snapshotHeader != MakeTextureSnapshotHeader(cacheKey, texture)) return false;
+
+            u64 snapshotSizeBytes{0};
+            const auto copyRegions = GetTextureSnapshotCopyRegions(texture, snapshotSizeBytes);
+            if (rawData.size() != sizeof(snapshotHeader) + snapshotSizeBytes) return false;
+
+            auto& gfxContext   = GfxContext::Get();
+            auto stagingBuffer = MakeUnique<GfxBuffer>(gfxContext.GetDevice(),
+                                                       GfxBufferDescription(snapshotSizeBytes, /* placeholder */ 1,
+                                                                            vk::BufferUsageFlagBits::eTransferSrc,
+                                                                            EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
+            stagingBuffer->SetData(rawData.data() + sizeof(snapshotHeader), snapshotSizeBytes);
+
+            const auto subresourceRange = vk::ImageSubresourceRange()
+                                              .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                              .setBaseArrayLayer(0)
+                                              .setLayerCount(texture.GetDescription().LayerCount)
+                                              .setBaseMipLevel(0)
+                                              .setLevelCount(texture.GetMipCount());
+
+            auto executionContext = gfxContext.CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
+            executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+            executionContext.CommandBuffer.pipelineBarrier2(
+                vk::DependencyInfo().setImageMemoryBarriers(vk::ImageMemoryBarrier2()
+                                                                .setImage(texture)
+                                                                .setSubresourceRange(subresourceRange)
+                                                                .setOldLayout(vk::ImageLayout::eUndefined)
+                                                                .setSrcAccessMask(vk::AccessFlagBits2::eNone)
+                                                                .setSrcStageMask(vk::PipelineStageFlagBits2::eNone)
+                                                                .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
+                                                                .setDstAccessMask(vk::AccessFlagBits2::eTransferWrite)
+                                                                .setDstStageMask(vk::PipelineStageFlagBits2::eCopy)));
+
+            executionContext.CommandBuffer.copyBufferToImage(*stagingBuffer, texture, vk::ImageLayout::eTransferDstOptimal, copyRegions);
+
+            executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
+                vk::ImageMemoryBarrier2()
+                    .setImage(texture)
+                    .setSubresourceRange(subresourceRange)
+                    .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
+                    .setSrcAccessMask(vk::AccessFlagBits2::eTransferWrite)
+                    .setSrcStageMask(vk::PipelineStageFlagBits2::eCopy)
+                    .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                    .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
+                    .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader | vk::PipelineStageFlagBits2::eComputeShader)));
+
+            executionContext.CommandBuffer.end();
+            gfxContext.SubmitImmediateExecuteContext(executionContext);
+
+            return true;
+        }
+
+        void SaveTextureSnapshot(const std::string& cachePath, const u64 cacheKey, GfxTexture& texture) noexcept
+        {
+            u64 snapshotSizeBytes{0};
+            const auto copyRegions = GetTextureSnapshotCopyRegions(texture, snapshotSizeBytes);
+
+            auto& gfxContext    = GfxContext::Get();
+            auto readbackBuffer = MakeUnique<GfxBuffer>(gfxContext.GetDevice(),
+                                                        GfxBufferDescription(snapshotSizeBytes, /* placeholder */ 1,
+                                                                             vk::BufferUsageFlagBits::eTransferDst,
+                                                                             EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
+
+            const auto subresourceRange = vk::ImageSubresourceRange()
+                                              .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                              .setBaseArrayLayer(0)
+                                              .setLayerCount(texture.GetDescription().LayerCount)
+                                              .setBaseMipLevel(0)
+                                              .setLevelCount(texture.GetMipCount());
+
+            auto executionContext = gfxContext.CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
+            executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+            executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
+                vk::ImageMemoryBarrier2()
+                    .setImage(texture)
+                    .setSubresourceRange(subresourceRange)
+                    .setOldLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                    .setSrcAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
+                    .setSrcStageMask(vk::PipelineStageFlagBits2::eFragmentShader | vk::PipelineStageFlagBits2::eComputeShader)
+                    .setNewLayout(vk::ImageLayout::eTransferSrcOptimal)
+                    .setDstAccessMask(vk::AccessFlagBits2::eTransferRead)
+                    .setDstStageMask(vk::PipelineStageFlagBits2::eCopy)));
+
+            executionContext.CommandBuffer.copyImageToBuffer(texture, vk::ImageLayout::eTransferSrcOptimal, *readbackBuffer, copyRegions);
+
+            executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
+                vk::ImageMemoryBarrier2()
+                    .setImage(texture)
+                    .setSubresourceRange(subresourceRange)
+                    .setOldLayout(vk::ImageLayout::eTransferSrcOptimal)
+                    .setSrcAccessMask(vk::AccessFlagBits2::eTransferRead)
+                    .setSrcStageMask(vk::PipelineStageFlagBits2::eCopy)
+                    .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                    .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
+                    .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader | vk::PipelineStageFlagBits2::eComputeShader)));
+
+            executionContext.CommandBuffer.end();
+            gfxContext.SubmitImmediateExecuteContext(executionContext);
+
+            const auto snapshotHeader = MakeTextureSnapshotHeader(cacheKey, texture);
+            std::vector<u8> rawData(sizeof(snapshotHeader) + snapshotSizeBytes);
+            std::memcpy(rawData.data(), &snapshotHeader, sizeof(snapshotHeader));
+            std::memcpy(rawData.data() + sizeof(snapshotHeader), readbackBuffer->GetMapped(), snapshotSizeBytes);
+
+            const auto cacheDirectory = std::filesystem::path(cachePath).parent_path();
+            if (!cacheDirectory.empty()) std::filesystem::create_directories(cacheDirectory);
+            CoreUtils::SaveData(cachePath, rawData);
+        }
+
     }  // namespace GfxTextureUtils
 
     void GfxTexture::Invalidate() noexcept
@@ -536,6 +719,14 @@ namespace Radiant
         const bool bCreateMips = m_Description.CreateFlags & EResourceCreateBits::RESOURCE_CREATE_CREATE_MIPS_BIT;
         RDNT_ASSERT(bCreateMips, "bCreateMips is not specified!");
 
+        const bool bExposeMips = m_Description.CreateFlags & EResourceCreateBits::RESOURCE_CREATE_EXPOSE_MIPS_BIT;
+        if (bExposeMips && (m_Description.UsageFlags & vk::ImageUsageFlagBits::eStorage) && m_Description.LayerCount == 1 &&
+            !IsDepthFormat(m_Description.Format) && GetMipCount() > 1)
+        {
+            GenerateMipMapsSinglePass(cmd);
+            return;
+        }
+
         const auto formatProps = m_Device->GetPhysicalDevice().getFormatProperties(m_Description.Format);
         RDNT_ASSERT(formatProps.optimalTilingFeatures & (vk::FormatFeatureFlagBits::eSampledImageFilterLinear |
                                                          vk::FormatFeatureFlagBits::eBlitSrc | vk::FormatFeatureFlagBits::eBlitDst),
@@ -618,6 +809,57 @@ namespace Radiant
         cmd.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(imageMemoryBarrier));
     }
 
+    void GfxTexture::GenerateMipMapsSinglePass(const vk::CommandBuffer& cmd) const noexcept
+    {
+        const auto mipLevelCount = GetMipCount();
+        const auto baseMipRange =
+            vk::ImageSubresourceRange().setAspectMask(vk::ImageAspectFlagBits::eColor).setLayerCount(1).setBaseMipLevel(0).setLevelCount(1);
+        const auto restMipsRange = vk::ImageSubresourceRange(baseMipRange).setBaseMipLevel(1).setLevelCount(mipLevelCount - 1);
+
+        // NOTE: Contents of mips past the base one are garbage anyway, so no need to wait for transfers touching them.
+        const std::array<vk::ImageMemoryBarrier2, 2> preDownsampleBarriers = {
+            vk::ImageMemoryBarrier2()
+                .setImage(*m_Image)
+                .setSubresourceRange(baseMipRange)
+                .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
+                .setSrcAccessMask(vk::AccessFlagBits2::eTransferWrite)
+                .setSrcStageMask(vk::PipelineStageFlagBits2::eAllTransfer)
+                .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
+                .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader | vk::PipelineStageFlagBits2::eComputeShader),
+            vk::ImageMemoryBarrier2()
+                .setImage(*m_Image)
+                .setSubresourceRange(restMipsRange)
+                .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
+                .setSrcAccessMask(vk::AccessFlagBits2::eNone)
+                .setSrcStageMask(vk::PipelineStageFlagBits2::eNone)
+                .setNewLayout(vk::ImageLayout::eGeneral)
+                .setDstAccessMask(vk::AccessFlagBits2::eShaderStorageRead | vk::AccessFlagBits2::eShaderStorageWrite)
+                .setDstStageMask(vk::PipelineStageFlagBits2::eComputeShader)};
+        cmd.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(preDownsampleBarriers));
+
+        GfxDownsampleDescription downsampleDesc = {.SrcDimensions = glm::uvec2(m_Description.Dimensions),
+                                                   .SrcTextureID  = GetBindlessTextureID()};
+        for (u32 mipLevel{1}; mipLevel < mipLevelCount; ++mipLevel)
+            downsampleDesc.DstMipTextureIDs.emplace_back(GetBindlessRWImageID(mipLevel));
+
+        // NOTE: Command buffer may be an immediate one, so it gets its own descriptor binding and pipeline state cache.
+        m_Device->BindBindlessResources(cmd, vk::PipelineBindPoint::eCompute);
+        GfxPipelineStateCache pipelineStateCache{};
+        GfxContext::Get().GetDownsampler()->Dispatch(cmd, pipelineStateCache, downsampleDesc);
+
+        cmd.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
+            vk::ImageMemoryBarrier2()
+                .setImage(*m_Image)
+                .setSubresourceRange(restMipsRange)
+                .setOldLayout(vk::ImageLayout::eGeneral)
+                .setSrcAccessMask(vk::AccessFlagBits2::eShaderStorageWrite)
+                .setSrcStageMask(vk::PipelineStageFlagBits2::eComputeShader)
+                .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
+                .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader | vk::PipelineStageFlagBits2::eComputeShader)));
+    }
+
     bool GfxTexture::Resize(const glm::uvec3& dimensions) noexcept
     {
         if (m_Description.Dimensions == dimensions) return false;
@@ -627,6 +869,48 @@ namespace Radiant
         return true;
     }
 
+    void GfxTexture::SwapImage(GfxTexture& other) noexcept
+    {
+        RDNT_ASSERT(m_Image.has_value() && other.m_Image.has_value(), "Image is invalid!");
+        RDNT_ASSERT(m_MipChain.size() == other.m_MipChain.size(), "Mip chains should match!");
+        RDNT_ASSERT(!(m_Description.CreateFlags & EResourceCreateBits::RESOURCE_CREATE_RENDER_GRAPH_MEMORY_CONTROLLED_BIT) &&
+                        !(other.m_Description.CreateFlags & EResourceCreateBits::RESOURCE_CREATE_RENDER_GRAPH_MEMORY_CONTROLLED_BIT),
+                    "RenderGraph memory controlled images can't be swapped!");
+        RDNT_ASSERT(m_Description.Format == other.m_Description.Format && m_Description.LayerCount == other.m_Description.LayerCount,
+                    "Only dimensions and mip count can differ!");
+
+        std::swap(m_Image, other.m_Image);
+        std::swap(m_Allocation, other.m_Allocation);
+        std::swap(m_Description.Dimensions, other.m_Description.Dimensions);
+        std::swap(m_Description.MipNum, other.m_Description.MipNum);
+
+        const auto sampler = m_Description.SamplerCreateInfo.has_value() ? m_Device->GetSampler(*m_Description.SamplerCreateInfo).first
+                                                                         : m_Device->GetDefaultSampler().first;
+        for (u32 mipLevel{}; mipLevel < m_MipChain.size(); ++mipLevel)
+        {
+            // NOTE: Bindless IDs stay where they are, only views are exchanged.
+            auto& mipInfo = m_MipChain[mipLevel];
+            std::swap(mipInfo.ImageView, other.m_MipChain[mipLevel].ImageView);
+
+            if (mipInfo.BindlessTextureID.has_value())
+                m_Device->UpdateBindlessThing(vk::DescriptorImageInfo()
+                                                  .setImageView(mipInfo.ImageView)
+                                                  .setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                                                  .setSampler(sampler),
+                                              *mipInfo.BindlessTextureID, Shaders::s_BINDLESS_COMBINED_IMAGE_SAMPLER_BINDING);
+
+            if (mipInfo.BindlessSampledImageID.has_value())
+                m_Device->UpdateBindlessThing(
+                    vk::DescriptorImageInfo().setImageView(mipInfo.ImageView).setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal),
+                    *mipInfo.BindlessSampledImageID, Shaders::s_BINDLESS_SAMPLED_IMAGE_BINDING);
+
+            if (mipInfo.BindlessImageID.has_value())
+                m_Device->UpdateBindlessThing(
+                    vk::DescriptorImageInfo().setImageView(mipInfo.ImageView).setImageLayout(vk::ImageLayout::eGeneral),
+                    *mipInfo.BindlessImageID, Shaders::s_BINDLESS_STORAGE_IMAGE_BINDING);
+        }
+    }
+
     void GfxTexture::Destroy() noexcept
     {
         if (!m_Image.has_value()) return;
@@ -7,10 +7,12 @@
 #include <vk_mem_alloc.h>
 
 #include <nvtt/nvtt.h>
+#include <span>
 
 namespace Radiant
 {
 
+    class GfxTexture;
     namespace GfxTextureUtils
     {
 
@@ -27,6 +29,10 @@ namespace Radiant
             };
 
             void PushTextureIntoBatchList(const std::string& texturePath, const vk::Format format) noexcept;
+            // NOTE: For encoded in-memory images(png/jpg), textureName is used as a cache key.
+            // rawImageData should outlive CompressAndCache().
+            void PushTextureIntoBatchList(const std::string& textureName, const std::span<const u8> rawImageData,
+                                          const vk::Format format) noexcept;
             void CompressAndCache() noexcept;
 
             NODISCARD static std::vector<TextureCompressor::TextureInfo> LoadTextureCache(const std::string& texturePath,
@@ -36,7 +42,12 @@ namespace Radiant
                 const nvtt::Quality compressionQuality = nvtt::Quality::Quality_Fastest) noexcept;
 
           private:
-            UnorderedMap<vk::Format, std::vector<std::string>> m_TexturesToLoad{};
+            struct TextureSource
+            {
+                std::string Path{s_DEFAULT_STRING};
+                std::span<const u8> RawData{};  // Empty if texture should be loaded from Path.
+            };
+            UnorderedMap<vk::Format, std::vector<TextureSource>> m_TexturesToLoad{};
 
             // NOTE: MipCount, vk::Format will be added as needed.
             struct TextureHeader
@@ -91,6 +102,12 @@ namespace Radiant
 
         u32 GetMipLevelCount(const u32 width, const u32 height) noexcept;
 
+        // NOTE: Raw dumps of every mip and layer of uncompressed texture, used to skip heavy GPU precomputations on later runs.
+        // Snapshot is valid only if cacheKey and texture description match. Texture should have TransferSrc(save) or TransferDst(load)
+        // usage and is left in ShaderReadOnlyOptimal layout. Both submit immediately and wait.
+        NODISCARD bool LoadTextureSnapshot(const std::string& cachePath, const u64 cacheKey, GfxTexture& texture) noexcept;
+        void SaveTextureSnapshot(const std::string& cachePath, const u64 cacheKey, GfxTexture& texture) noexcept;
+
     }  // namespace GfxTextureUtils
 
     struct GfxTextureDescription
@@ -184,9 +201,15 @@ namespace Radiant
             return false;
         }
 
+        // NOTE: Expects all mips in TransferDstOptimal, leaves them in ShaderReadOnlyOptimal. Storage capable 2D textures with exposed
+        // mips are reduced on compute(see GfxDownsampler), others(sRGB, cubemaps) fall back to blit chain.
         void GenerateMipMaps(const vk::CommandBuffer& cmd) const noexcept;
         bool Resize(const glm::uvec3& dimensions) noexcept;
 
+        // NOTE: Texture streaming: takes image(with different dimensions/mip count) from other, hands ours over to other and rewrites
+        // our bindless descriptors in-place, so IDs referenced by materials stay intact. Destroying other releases the old image.
+        void SwapImage(GfxTexture& other) noexcept;
+
         FORCEINLINE u32 GetMipChainSize() const noexcept { return m_MipChain.size(); }
         NODISCARD FORCEINLINE u32 GetBindlessRWImageID(const u32 mipLevel = 0) const noexcept
         {
@@ -240,6 +263,7 @@ namespace Radiant
 
         constexpr GfxTexture() noexcept = delete;
         void CreateMipChainAndSubmitToBindlessPool() noexcept;
+        void GenerateMipMapsSinglePass(const vk::CommandBuffer& cmd) const noexcept;
         void Destroy() noexcept;
     };
 
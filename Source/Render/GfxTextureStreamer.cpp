@@ -0,0 +1,217 @@
+#include "GfxTextureStreamer.hpp"
+
+#include <Core/Application.hpp>
+#include <Render/GfxContext.hpp>
+#include <Render/GfxDevice.hpp>
+
+namespace Radiant
+{
+
+    void GfxTextureStreamer::Init() noexcept
+    {
+        constexpr u64 feedbackBufferSizeBytes = sizeof(u32) * Shaders::s_MAX_BINDLESS_COMBINED_IMAGE_SAMPLERS;
+        for (u8 frame{}; frame < s_BufferedFrameCount; ++frame)
+        {
+            m_FeedbackBuffers[frame] = MakeUnique<GfxBuffer>(
+                m_Device, GfxBufferDescription(feedbackBufferSizeBytes, sizeof(u32), vk::BufferUsageFlagBits::eStorageBuffer,
+                                               EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT |
+                                                   EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_ADDRESSABLE_BIT));
+            m_Device->SetDebugName("TextureStreamingFeedbackBuffer_" + std::to_string(frame), (const vk::Buffer&)*m_FeedbackBuffers[frame]);
+
+            std::memset(m_FeedbackBuffers[frame]->GetMapped(), 0, feedbackBufferSizeBytes);
+            m_FeedbackBufferBDAs[frame] = m_FeedbackBuffers[frame]->GetBDA();
+        }
+    }
+
+    Shared<GfxTexture> GfxTextureStreamer::CreateStreamedTexture(const std::string& debugName,
+                                                                 std::vector<GfxTextureUtils::TextureCompressor::TextureInfo>&& mips,
+                                                                 const vk::Format format,
+                                                                 const std::optional<vk::SamplerCreateInfo>& samplerCI) noexcept
+    {
+        RDNT_ASSERT(!mips.empty(), "No mips to stream!");
+
+        u8 tailBaseMip{0};
+        while (tailBaseMip + 1u < mips.size() &&
+               glm::max(mips[tailBaseMip].Dimensions.x, mips[tailBaseMip].Dimensions.y) > s_TailMaxDimension)
+            ++tailBaseMip;
+
+        auto streamedTexture               = MakeShared<StreamedTexture>();
+        streamedTexture->Mips              = std::move(mips);
+        streamedTexture->DebugName         = debugName;
+        streamedTexture->SamplerCreateInfo = samplerCI;
+        streamedTexture->Format            = format;
+
+        // NOTE: The texture is created with tail mips, so its bindless ID is already stable, then image is swapped on demand.
+        Shared<GfxTexture> texture = CreateTextureFromMips(*streamedTexture, tailBaseMip);
+        streamedTexture->Texture   = texture;
+
+        std::vector<u64> mipSizesBytes(streamedTexture->Mips.size());
+        for (u64 mipLevel{}; mipLevel < mipSizesBytes.size(); ++mipLevel)
+            mipSizesBytes[mipLevel] = streamedTexture->Mips[mipLevel].Data.size() * sizeof(streamedTexture->Mips[mipLevel].Data[0]);
+
+        const auto textureID = texture->GetBindlessTextureID();
+        {
+            std::scoped_lock lock(m_Mtx);  // Synchronizing access from parallel texture loading.
+
+            // NOTE: Bindless ID could be reused after previous owner was released, but not yet forgotten by Update().
+            m_ResidencyManager.UnregisterTexture(textureID);
+            m_ResidencyManager.RegisterTexture(textureID, mipSizesBytes, tailBaseMip);
+            m_StreamedTextures[textureID] = std::move(streamedTexture);
+        }
+
+        return texture;
+    }
+
+    GfxTextureStreamer::~GfxTextureStreamer() noexcept
+    {
+        // NOTE: Upload jobs use device, so they have to finish before it's gone.
+        for (auto& pendingStreamIn : m_PendingStreamIns)
+            if (pendingStreamIn.NewTextureFuture.valid()) pendingStreamIn.NewTextureFuture.wait();
+    }
+
+    void GfxTextureStreamer::Update(const u32 frameIndex, const u64 globalFrameNumber) noexcept
+    {
+        RDNT_ASSERT(frameIndex < s_BufferedFrameCount, "Invalid frame index!");
+
+        std::scoped_lock lock(m_Mtx);
+        m_CurrentFrameIndex = frameIndex;
+
+        ApplyFinishedStreamIns();
+
+        // NOTE: Textures could be released by their owners, forget about them.
+        std::vector<u32> expiredTextureIDs{};
+        for (const auto& [textureID, streamedTexture] : m_StreamedTextures)
+            if (streamedTexture->Texture.expired()) expiredTextureIDs.emplace_back(textureID);
+
+        for (const auto textureID : expiredTextureIDs)
+        {
+            m_ResidencyManager.UnregisterTexture(textureID);
+            m_StreamedTextures.erase(textureID);
+        }
+
+        auto* feedback = static_cast<u32*>(m_FeedbackBuffers[frameIndex]->GetMapped());
+        m_ResidencyManager.ProcessFeedback(std::span<const u32>(feedback, Shaders::s_MAX_BINDLESS_COMBINED_IMAGE_SAMPLERS),
+                                           globalFrameNumber);
+        std::memset(feedback, 0, sizeof(u32) * Shaders::s_MAX_BINDLESS_COMBINED_IMAGE_SAMPLERS);
+
+        for (const auto& request : m_ResidencyManager.Update(s_MaxStreamInSizeBytesPerFrame))
+        {
+            const auto it = m_StreamedTextures.find(request.TextureID);
+            if (it == m_StreamedTextures.end()) continue;
+
+            auto newTextureFuture = Application::Get().GetThreadPool()->Submit(
+                [this, streamedTexture = it->second, baseMip = request.NewBaseMip]() noexcept
+                { return CreateTextureFromMips(*streamedTexture, baseMip); });
+            m_PendingStreamIns.emplace_back(request.TextureID, it->second, std::move(newTextureFuture));
+        }
+    }
+
+    void GfxTextureStreamer::ApplyFinishedStreamIns() noexcept
+    {
+        // NOTE: Texture with unfinished older job keeps its newer ones waiting, otherwise quick eviction could be overwritten by slow
+        // stream-in submitted before it.
+        UnorderedSet<u32> blockedTextureIDs{};
+        for (auto it = m_PendingStreamIns.begin(); it != m_PendingStreamIns.end();)
+        {
+            const bool bReady = it->NewTextureFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            if (!bReady || blockedTextureIDs.contains(it->TextureID))
+            {
+                blockedTextureIDs.emplace(it->TextureID);
+                ++it;
+                continue;
+            }
+
+            // NOTE: Old image ends up inside newTexture, which pushes it into deferred deletion queue, so frames in flight are fine.
+            // Swap happens on frame thread, since it rewrites bindless descriptors.
+            auto newTexture = it->NewTextureFuture.get();
+            if (auto texture = it->Source->Texture.lock(); texture) texture->SwapImage(*newTexture);
+            it = m_PendingStreamIns.erase(it);
+        }
+    }
+
+    Unique<GfxTexture> GfxTextureStreamer::CreateTextureFromMips(const StreamedTexture& streamedTexture, const u8 baseMip) const noexcept
+    {
+        RDNT_ASSERT(baseMip < streamedTexture.Mips.size(), "Base mip is out of range!");
+
+        const auto& baseMipInfo = streamedTexture.Mips[baseMip];
+        const auto mipCount     = static_cast<u8>(streamedTexture.Mips.size() - baseMip);
+        auto texture            = MakeUnique<GfxTexture>(
+            m_Device, GfxTextureDescription(vk::ImageType::e2D, glm::uvec3(baseMipInfo.Dimensions, 1), streamedTexture.Format,
+                                            vk::ImageUsageFlagBits::eTransferDst, streamedTexture.SamplerCreateInfo, 1,
+                                            vk::SampleCountFlagBits::e1,
+                                            EResourceCreateBits::RESOURCE_CREATE_DONT_TOUCH_SAMPLED_IMAGES_BIT |
+                                                EResourceCreateBits::RESOURCE_CREATE_CREATE_MIPS_BIT,
+                                            mipCount));
+        m_Device->SetDebugName(streamedTexture.DebugName, (const vk::Image&)*texture);
+
+        u64 stagingBufferSizeBytes{0};
+        for (u32 mipLevel{baseMip}; mipLevel < streamedTexture.Mips.size(); ++mipLevel)
+            stagingBufferSizeBytes += streamedTexture.Mips[mipLevel].Data.size();
+
+        auto stagingBuffer = MakeUnique<GfxBuffer>(m_Device, GfxBufferDescription(stagingBufferSizeBytes, /* placeholder */ 1,
+                                                                                  vk::BufferUsageFlagBits::eTransferSrc,
+                                                                                  EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
+
+        auto executionContext = GfxContext::Get().CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
+        executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+        executionContext.CommandBuffer.pipelineBarrier2(
+            vk::DependencyInfo().setImageMemoryBarriers(vk::ImageMemoryBarrier2()
+                                                            .setImage(*texture)
+                                                            .setSubresourceRange(vk::ImageSubresourceRange()
+                                                                                     .setBaseArrayLayer(0)
+                                                                                     .setBaseMipLevel(0)
+                                                                                     .setLevelCount(mipCount)
+                                                                                     .setLayerCount(1)
+                                                                                     .setAspectMask(vk::ImageAspectFlagBits::eColor))
+                                                            .setOldLayout(vk::ImageLayout::eUndefined)
+                                                            .setSrcAccessMask(vk::AccessFlagBits2::eNone)
+                                                            .setSrcStageMask(vk::PipelineStageFlagBits2::eNone)
+                                                            .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
+                                                            .setDstAccessMask(vk::AccessFlagBits2::eTransferWrite)
+                                                            .setDstStageMask(vk::PipelineStageFlagBits2::eAllTransfer)));
+
+        auto* stagingData = static_cast<u8*>(stagingBuffer->GetMapped());
+        u64 stagingBufferOffset{0};
+        for (u32 mipLevel{baseMip}; mipLevel < streamedTexture.Mips.size(); ++mipLevel)
+        {
+            const auto& mip = streamedTexture.Mips[mipLevel];
+            std::memcpy(stagingData + stagingBufferOffset, mip.Data.data(), mip.Data.size());
+
+            executionContext.CommandBuffer.copyBufferToImage(
+                *stagingBuffer, *texture, vk::ImageLayout::eTransferDstOptimal,
+                vk::BufferImageCopy()
+                    .setBufferOffset(stagingBufferOffset)
+                    .setImageSubresource(vk::ImageSubresourceLayers()
+                                             .setLayerCount(1)
+                                             .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                             .setBaseArrayLayer(0)
+                                             .setMipLevel(mipLevel - baseMip))
+                    .setImageExtent(vk::Extent3D(mip.Dimensions.x, mip.Dimensions.y, 1)));
+            stagingBufferOffset += mip.Data.size();
+        }
+
+        executionContext.CommandBuffer.pipelineBarrier2(
+            vk::DependencyInfo().setImageMemoryBarriers(vk::ImageMemoryBarrier2()
+                                                            .setImage(*texture)
+                                                            .setSubresourceRange(vk::ImageSubresourceRange()
+                                                                                     .setBaseArrayLayer(0)
+                                                                                     .setBaseMipLevel(0)
+                                                                                     .setLevelCount(mipCount)
+                                                                                     .setLayerCount(1)
+                                                                                     .setAspectMask(vk::ImageAspectFlagBits::eColor))
+                                                            .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
+                                                            .setSrcAccessMask(vk::AccessFlagBits2::eTransferWrite)
+                                                            .setSrcStageMask(vk::PipelineStageFlagBits2::eCopy)
+                                                            .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                                                            .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
+                                                            .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader |
+                                                                             vk::PipelineStageFlagBits2::eComputeShader)));
+
+        executionContext.CommandBuffer.end();
+        GfxContext::Get().SubmitImmediateExecuteContext(executionContext);
+
+        return texture;
+    }
+
+}  // namespace Radiant
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+#include <Render/GfxTexture.hpp>
+#include <Render/GfxBuffer.hpp>
+#include <Render/TextureResidencyManager.hpp>
+
+namespace Radiant
+{
+
+    struct GfxTextureStreamingStatistics
+    {
+        u64 ResidentSizeBytes{0};
+        u64 BudgetSizeBytes{0};
+        u64 StreamedTextureCount{0};
+    };
+
+    class GfxDevice;
+    class GfxTextureStreamer final : private Uncopyable, private Unmovable
+    {
+      public:
+        GfxTextureStreamer(const Unique<GfxDevice>& device) noexcept : m_Device(device), m_ResidencyManager(s_BudgetSizeBytes) { Init(); }
+        ~GfxTextureStreamer() noexcept;
+
+        // NOTE: Creates texture with tail mips only(<= s_TailMaxDimension), higher mips are streamed on demand from system memory.
+        NODISCARD Shared<GfxTexture> CreateStreamedTexture(const std::string& debugName,
+                                                           std::vector<GfxTextureUtils::TextureCompressor::TextureInfo>&& mips,
+                                                           const vk::Format format,
+                                                           const std::optional<vk::SamplerCreateInfo>& samplerCI) noexcept;
+
+        // NOTE: Called right after frame fence was waited, so feedback of this frame slot is complete, no GPU stall. Stream-ins are
+        // uploaded on thread pool, finished ones are swapped in here, so frame thread never waits for uploads.
+        void Update(const u32 frameIndex, const u64 globalFrameNumber) noexcept;
+
+        NODISCARD FORCEINLINE auto GetFeedbackBufferBDA() const noexcept { return m_FeedbackBufferBDAs[m_CurrentFrameIndex]; }
+        NODISCARD GfxTextureStreamingStatistics GetStatistics() const noexcept
+        {
+            std::scoped_lock lock(m_Mtx);
+            return GfxTextureStreamingStatistics{.ResidentSizeBytes    = m_ResidencyManager.GetResidentSizeBytes(),
+                                                 .BudgetSizeBytes      = m_ResidencyManager.GetBudgetSizeBytes(),
+                                                 .StreamedTextureCount = m_ResidencyManager.GetTextureCount()};
+        }
+
+      private:
+        static constexpr u64 s_BudgetSizeBytes              = 1024ull * 1024 * 1024;
+        static constexpr u64 s_MaxStreamInSizeBytesPerFrame = 32ull * 1024 * 1024;  // Keeps upload jobs in flight bounded.
+        static constexpr u32 s_TailMaxDimension             = 128;
+
+        const Unique<GfxDevice>& m_Device;
+        mutable std::mutex m_Mtx{};
+        TextureResidencyManager m_ResidencyManager;
+
+        std::array<Unique<GfxBuffer>, s_BufferedFrameCount> m_FeedbackBuffers{};
+        std::array<u64, s_BufferedFrameCount> m_FeedbackBufferBDAs{};
+        u32 m_CurrentFrameIndex{0};
+
+        struct StreamedTexture
+        {
+            WeakPtr<GfxTexture> Texture{};
+            std::vector<GfxTextureUtils::TextureCompressor::TextureInfo> Mips{};
+            std::string DebugName{s_DEFAULT_STRING};
+            std::optional<vk::SamplerCreateInfo> SamplerCreateInfo{std::nullopt};
+            vk::Format Format{vk::Format::eUndefined};
+        };
+        UnorderedMap<u32, Shared<StreamedTexture>> m_StreamedTextures{};  // Key is bindless combined image sampler ID.
+
+        struct PendingStreamIn
+        {
+            u32 TextureID{0};
+            Shared<StreamedTexture> Source{nullptr};  // Keeps mips alive for the upload job.
+            std::future<Unique<GfxTexture>> NewTextureFuture{};
+        };
+        std::vector<PendingStreamIn> m_PendingStreamIns{};  // Submission order, so residency changes of one texture apply in order.
+
+        constexpr GfxTextureStreamer() noexcept = delete;
+        void Init() noexcept;
+        void ApplyFinishedStreamIns() noexcept;
+        NODISCARD Unique<GfxTexture> CreateTextureFromMips(const StreamedTexture& streamedTexture, const u8 baseMip) const noexcept;
+    };
+
+}  // namespace Radiant
@@ -0,0 +1,67 @@
+#include "OffsetAllocator.hpp"
+
+namespace Radiant
+{
+
+    std::optional<OffsetAllocator::Allocation> OffsetAllocator::Allocate(const u64 size) noexcept
+    {
+        if (size == 0) return Allocation{};
+
+        // Smallest free block that fits, leftovers stay in place as a free block.
+        const auto it = m_FreeBlocksBySize.lower_bound({size, 0});
+        if (it == m_FreeBlocksBySize.end()) return std::nullopt;
+
+        const auto [blockSize, blockOffset] = *it;
+        RemoveFreeBlock(m_FreeBlocksByOffset.find(blockOffset));
+        if (blockSize > size) InsertFreeBlock(blockOffset + size, blockSize - size);
+
+        m_UsedSize += size;
+        return Allocation{.Offset = blockOffset, .Size = size};
+    }
+
+    void OffsetAllocator::Free(const Allocation& allocation) noexcept
+    {
+        if (allocation.Size == 0) return;
+
+        RDNT_ASSERT(allocation.Offset + allocation.Size <= m_Capacity && allocation.Size <= m_UsedSize, "Freeing foreign allocation!");
+        u64 offset = allocation.Offset;
+        u64 size   = allocation.Size;
+
+        auto nextIt = m_FreeBlocksByOffset.lower_bound(offset);
+        RDNT_ASSERT(nextIt == m_FreeBlocksByOffset.end() || offset + size <= nextIt->first, "Double free or overlapping allocation!");
+        if (nextIt != m_FreeBlocksByOffset.end() && nextIt->first == offset + size)
+        {
+            size += nextIt->second;
+            RemoveFreeBlock(nextIt);
+        }
+
+        auto prevIt = m_FreeBlocksByOffset.lower_bound(offset);
+        if (prevIt != m_FreeBlocksByOffset.begin())
+        {
+            --prevIt;
+            RDNT_ASSERT(prevIt->first + prevIt->second <= offset, "Double free or overlapping allocation!");
+            if (prevIt->first + prevIt->second == offset)
+            {
+                offset = prevIt->first;
+                size += prevIt->second;
+                RemoveFreeBlock(prevIt);
+            }
+        }
+
+        InsertFreeBlock(offset, size);
+        m_UsedSize -= allocation.Size;
+    }
+
+    void OffsetAllocator::InsertFreeBlock(const u64 offset, const u64 size) noexcept
+    {
+        m_FreeBlocksByOffset.emplace(offset, size);
+        m_FreeBlocksBySize.emplace(size, offset);
+    }
+
+    void OffsetAllocator::RemoveFreeBlock(const std::map<u64, u64>::iterator it) noexcept
+    {
+        m_FreeBlocksBySize.erase({it->second, it->first});
+        m_FreeBlocksByOffset.erase(it);
+    }
+
+}  // namespace Radiant
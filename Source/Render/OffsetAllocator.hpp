@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Core/Core.hpp>
+#include <map>
+#include <set>
+
+namespace Radiant
+{
+
+    // NOTE: CPU-only part of geometry pool, knows nothing about GPU, so it can be fed with simulated load/unload churn.
+    // Offsets and sizes are in elements(vertices/indices), best fit is picked out of free blocks, freed blocks are coalesced with
+    // their neighbours right away, so fragmentation is bounded by live allocations only. Not thread-safe.
+    class OffsetAllocator final : private Uncopyable, private Unmovable
+    {
+      public:
+        explicit OffsetAllocator(const u64 capacity) noexcept : m_Capacity(capacity)
+        {
+            if (m_Capacity > 0) InsertFreeBlock(0, m_Capacity);
+        }
+        ~OffsetAllocator() noexcept = default;
+
+        struct Allocation
+        {
+            u64 Offset{0};
+            u64 Size{0};
+        };
+
+        NODISCARD std::optional<Allocation> Allocate(const u64 size) noexcept;
+        void Free(const Allocation& allocation) noexcept;
+
+        NODISCARD FORCEINLINE auto GetCapacity() const noexcept { return m_Capacity; }
+        NODISCARD FORCEINLINE auto GetUsedSize() const noexcept { return m_UsedSize; }
+        NODISCARD FORCEINLINE auto GetFreeBlockCount() const noexcept { return m_FreeBlocksByOffset.size(); }
+        NODISCARD FORCEINLINE u64 GetLargestFreeBlockSize() const noexcept
+        {
+            return m_FreeBlocksBySize.empty() ? 0 : m_FreeBlocksBySize.crbegin()->first;
+        }
+
+      private:
+        std::map<u64, u64> m_FreeBlocksByOffset{};             // Offset -> size, neighbours are looked up here on free.
+        std::set<std::pair<u64, u64>> m_FreeBlocksBySize{};  // (size, offset), best fit lookup.
+        u64 m_Capacity{0};
+        u64 m_UsedSize{0};
+
+        constexpr OffsetAllocator() noexcept = delete;
+        void InsertFreeBlock(const u64 offset, const u64 size) noexcept;
+        void RemoveFreeBlock(const std::map<u64, u64>::iterator it) noexcept;
+    };
+
+}  // namespace Radiant
@@ -925,12 +925,8 @@ namespace Radiant
 
         frameData.GeneralCommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
 
-        const auto& pipelineLayout    = m_GfxContext->GetDevice()->GetBindlessPipelineLayout();
-        const auto& bindlessResources = m_GfxContext->GetDevice()->GetCurrentFrameBindlessResources();
-        frameData.GeneralCommandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, pipelineLayout, 0,
-                                                          bindlessResources.DescriptorSet, {});
-        frameData.GeneralCommandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, pipelineLayout, 0,
-                                                          bindlessResources.DescriptorSet, {});
+        m_GfxContext->GetDevice()->BindBindlessResources(frameData.GeneralCommandBuffer, vk::PipelineBindPoint::eGraphics);
+        m_GfxContext->GetDevice()->BindBindlessResources(frameData.GeneralCommandBuffer, vk::PipelineBindPoint::eCompute);
 
         // NOTE: Firstly reserve enough space for timestamps
         if (frameData.TimestampsCapacity < m_Passes.size() * 2)
@@ -951,6 +947,7 @@ namespace Radiant
         }
 
         frameData.GeneralCommandBuffer.end();
+        m_GfxContext->GetDevice()->FlushBindlessWrites();  // Registrations made by passes while recording.
 
         const auto& presentQueue = m_GfxContext->GetDevice()->GetGeneralQueue().Handle;
         presentQueue.submit2(vk::SubmitInfo2()
@@ -0,0 +1,100 @@
+#include "AlanWake2HZB.hpp"
+
+namespace Radiant
+{
+
+    namespace AW2
+    {
+
+        HZBReference::HZBReference(const std::vector<f32>& depth, const glm::uvec2& dimensions) noexcept
+        {
+            RDNT_ASSERT(dimensions.x > 0 && dimensions.y > 0 && depth.size() == static_cast<u64>(dimensions.x) * dimensions.y,
+                        "Depth size doesn't match dimensions!");
+
+            // NOTE: Same mip count as GfxTextureUtils::GetMipLevelCount(), mip 0 is a copy of depth buffer.
+            const auto mipCount = static_cast<u32>(std::floor(std::log2(std::max(dimensions.x, dimensions.y)))) + 1;
+            m_Mips.resize(mipCount);
+            m_MipDimensions.resize(mipCount);
+
+            m_Mips[0]          = depth;
+            m_MipDimensions[0] = dimensions;
+            for (u32 mipLevel{1}; mipLevel < mipCount; ++mipLevel)
+            {
+                const auto& srcDimensions = m_MipDimensions[mipLevel - 1];
+                const auto dstDimensions  = glm::max(dimensions >> mipLevel, glm::uvec2(1));
+                m_MipDimensions[mipLevel] = dstDimensions;
+
+                const auto& srcMip = m_Mips[mipLevel - 1];
+                auto& dstMip       = m_Mips[mipLevel];
+                dstMip.resize(static_cast<u64>(dstDimensions.x) * dstDimensions.y);
+                // NOTE: Same footprint as ReduceFootprint() from mip_building.slang, last texel reduced out of odd sized mip also covers
+                // the odd row/column, so it's never dropped.
+                const auto GetFootprintEndFunc = [](const u32 dstCoord, const u32 srcSize) noexcept
+                { return (srcSize & 1) != 0 && dstCoord * 2 + 3 == srcSize ? srcSize : std::min(dstCoord * 2 + 2, srcSize); };
+                for (u32 y{}; y < dstDimensions.y; ++y)
+                {
+                    const u32 yEnd = GetFootprintEndFunc(y, srcDimensions.y);
+                    for (u32 x{}; x < dstDimensions.x; ++x)
+                    {
+                        const u32 xEnd = GetFootprintEndFunc(x, srcDimensions.x);
+
+                        // Farthest depth of the footprint(reversed z).
+                        f32 farthestDepth = std::numeric_limits<f32>::max();
+                        for (u32 srcY{y * 2}; srcY < yEnd; ++srcY)
+                        {
+                            for (u32 srcX{x * 2}; srcX < xEnd; ++srcX)
+                                farthestDepth = std::min(farthestDepth, srcMip[srcY * srcDimensions.x + srcX]);
+                        }
+                        dstMip[y * dstDimensions.x + x] = farthestDepth;
+                    }
+                }
+            }
+        }
+
+        f32 HZBReference::Load(const glm::uvec2& texel, const u32 mipLevel) const noexcept
+        {
+            RDNT_ASSERT(mipLevel < GetMipCount(), "Mip level out of range!");
+            const auto& mipDimensions = m_MipDimensions[mipLevel];
+            RDNT_ASSERT(texel.x < mipDimensions.x && texel.y < mipDimensions.y, "Texel out of range!");
+
+            return m_Mips[mipLevel][texel.y * mipDimensions.x + texel.x];
+        }
+
+        bool HZBReference::IsSphereOccluded(const Sphere& worldSphere, const glm::mat4& viewProjectionMatrix) const noexcept
+        {
+            glm::vec2 uvMin{1.0f};
+            glm::vec2 uvMax{0.0f};
+            f32 closestDepth{0.0f};
+            for (u32 i{}; i < 8; ++i)
+            {
+                const glm::vec3 cornerOffset = {(i & 1) != 0 ? 1.0f : -1.0f, (i & 2) != 0 ? 1.0f : -1.0f, (i & 4) != 0 ? 1.0f : -1.0f};
+                const glm::vec4 corner       = glm::vec4(worldSphere.Origin + cornerOffset * worldSphere.Radius, 1.0f);
+                const auto clipPos           = viewProjectionMatrix * corner;
+
+                // Box crosses near plane, can't be projected.
+                if (clipPos.w <= Shaders::s_KINDA_SMALL_NUMBER) return false;
+
+                const auto ndc = glm::vec3(clipPos) / clipPos.w;
+                uvMin          = glm::min(uvMin, glm::vec2(ndc) * 0.5f + 0.5f);
+                uvMax          = glm::max(uvMax, glm::vec2(ndc) * 0.5f + 0.5f);
+                closestDepth   = glm::max(closestDepth, ndc.z);
+            }
+            uvMin = glm::clamp(uvMin, 0.0f, 1.0f);
+            uvMax = glm::clamp(uvMax, 0.0f, 1.0f);
+
+            const auto rectSize = (uvMax - uvMin) * glm::vec2(m_MipDimensions[0]);
+            const auto mipLevel = static_cast<u32>(glm::ceil(glm::log2(glm::max(glm::max(rectSize.x, rectSize.y), 1.0f))));
+            if (mipLevel >= GetMipCount()) return false;
+
+            const auto& mipDimensions = m_MipDimensions[mipLevel];
+            const auto texelMin       = glm::min(glm::uvec2(uvMin * glm::vec2(mipDimensions)), mipDimensions - 1u);
+            const auto texelMax       = glm::min(glm::uvec2(uvMax * glm::vec2(mipDimensions)), mipDimensions - 1u);
+
+            const f32 hzbDepth = glm::min(glm::min(Load(texelMin, mipLevel), Load({texelMax.x, texelMin.y}, mipLevel)),
+                                          glm::min(Load({texelMin.x, texelMax.y}, mipLevel), Load(texelMax, mipLevel)));
+            return closestDepth < hzbDepth;
+        }
+
+    }  // namespace AW2
+
+}  // namespace Radiant
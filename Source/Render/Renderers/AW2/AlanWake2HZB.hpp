@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+
+namespace Radiant
+{
+
+    namespace AW2
+    {
+
+        // NOTE: CPU reference of meshlet occlusion culling(HZBPass + IsSphereOccluded() from meshlet_culling.slang). Builds the same min
+        // reduced(reversed z) pyramid out of depth buffer readback and runs the same sphere test, so culling decisions can be checked
+        // without GPU. Keep it in sync with shaders!
+        class HZBReference final
+        {
+          public:
+            HZBReference(const std::vector<f32>& depth, const glm::uvec2& dimensions) noexcept;
+            ~HZBReference() noexcept = default;
+
+            NODISCARD bool IsSphereOccluded(const Sphere& worldSphere, const glm::mat4& viewProjectionMatrix) const noexcept;
+
+            NODISCARD f32 Load(const glm::uvec2& texel, const u32 mipLevel) const noexcept;
+            NODISCARD FORCEINLINE u32 GetMipCount() const noexcept { return static_cast<u32>(m_Mips.size()); }
+            NODISCARD FORCEINLINE const auto& GetMipDimensions(const u32 mipLevel) const noexcept { return m_MipDimensions[mipLevel]; }
+
+          private:
+            std::vector<std::vector<f32>> m_Mips;
+            std::vector<glm::uvec2> m_MipDimensions;
+        };
+
+    }  // namespace AW2
+
+}  // namespace Radiant
@@ -0,0 +1,176 @@
+#include "AlanWake2Mesh.hpp"
+
+#include <Render/GfxContext.hpp>
+#include <Render/GfxBuffer.hpp>
+
+#include <fastgltf/glm_element_traits.hpp>
+#include <fastgltf/types.hpp>
+#include <fastgltf/core.hpp>
+#include <fastgltf/tools.hpp>
+
+namespace Radiant
+{
+
+    namespace AW2
+    {
+
+        Mesh::Mesh(const Unique<GfxContext>& gfxContext, const std::filesystem::path& meshFilePath) noexcept
+        {
+            constexpr auto gltfLoadOptions = fastgltf::Options::DontRequireValidAssetMember | fastgltf::Options::LoadGLBBuffers |
+                                             fastgltf::Options::LoadExternalBuffers | fastgltf::Options::GenerateMeshIndices;
+
+            auto gltfFile = fastgltf::MappedGltfFile::FromPath(meshFilePath);
+            RDNT_ASSERT(gltfFile.error() == fastgltf::Error::None, "fastgltf: failed to open glTF file: {}",
+                        fastgltf::getErrorMessage(gltfFile.error()));
+
+            fastgltf::Parser parser{};
+            auto asset = parser.loadGltf(gltfFile.get(), meshFilePath.parent_path(), gltfLoadOptions);
+            RDNT_ASSERT(asset.error() == fastgltf::Error::None, "fastgltf: failed to load glTF file: {}",
+                        fastgltf::getErrorMessage(asset.error()));
+
+            LOG_INFO("Loading AW2 scene: {}", meshFilePath.string());
+            const auto meshletBuildBeginTime = Timer::Now();
+
+            auto executionContext = gfxContext->CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
+            executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+            // NOTE: Staging buffers have to outlive the submit.
+            std::vector<Unique<GfxBuffer>> stagingBuffers;
+            const auto UploadFunc = [&](const void* data, const u64 dataSizeBytes, const u64 elementSize,
+                                        const vk::BufferUsageFlags bufferUsage) noexcept -> Unique<GfxBuffer>
+            {
+                auto& stagingBuffer = stagingBuffers.emplace_back(MakeUnique<GfxBuffer>(
+                    gfxContext->GetDevice(), GfxBufferDescription(dataSizeBytes, elementSize, vk::BufferUsageFlagBits::eTransferSrc,
+                                                                  EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT)));
+                stagingBuffer->SetData(data, dataSizeBytes);
+
+                auto buffer = MakeUnique<GfxBuffer>(
+                    gfxContext->GetDevice(),
+                    GfxBufferDescription(dataSizeBytes, elementSize, bufferUsage,
+                                         EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+                executionContext.CommandBuffer.copyBuffer(*stagingBuffer, *buffer, vk::BufferCopy().setSize(dataSizeBytes));
+                return buffer;
+            };
+            const auto UploadArrayFunc = [&](const auto& array) noexcept -> const Unique<GfxBuffer>&
+            {
+                return m_GeometryStreamBuffers.emplace_back(
+                    UploadFunc(array.data(), array.size() * sizeof(array[0]), sizeof(array[0]), vk::BufferUsageFlagBits::eStorageBuffer));
+            };
+
+            // Use the same vectors for all meshes so that the memory doesn't reallocate as often.
+            std::vector<u32> indices;
+            std::vector<VertexPosition> vertexPositions;
+            std::vector<VertexAttribute> vertexAttributes;
+            m_Geometries.reserve(asset->meshes.size());
+            for (u64 meshIndex{}; meshIndex < asset->meshes.size(); ++meshIndex)
+            {
+                indices.clear();
+                vertexPositions.clear();
+                vertexAttributes.clear();
+
+                for (const auto& primitive : asset->meshes[meshIndex].primitives)
+                {
+                    if (primitive.type != fastgltf::PrimitiveType::Triangles) continue;
+
+                    const auto* positionIt = primitive.findAttribute("POSITION");
+                    RDNT_ASSERT(positionIt != primitive.attributes.end(),
+                                "fastgltf: A mesh primitive is required to hold the POSITION attribute.");
+
+                    const auto initialVertexIndex = static_cast<u32>(vertexPositions.size());
+                    const auto& posAccessor       = asset->accessors[positionIt->accessorIndex];
+                    vertexPositions.resize(vertexPositions.size() + posAccessor.count);
+                    vertexAttributes.resize(vertexAttributes.size() + posAccessor.count);
+                    fastgltf::iterateAccessorWithIndex<glm::vec3>(asset.get(), posAccessor,
+                                                                  [&](const glm::vec3& v, const u64 index)
+                                                                  { vertexPositions[initialVertexIndex + index].Position = v; });
+
+                    fastgltf::iterateAccessor<u32>(asset.get(), asset->accessors[*primitive.indicesAccessor],
+                                                   [&](const u32 idx) { indices.emplace_back(initialVertexIndex + idx); });
+
+                    if (const auto* normalsAttribute = primitive.findAttribute("NORMAL"); normalsAttribute != primitive.attributes.end())
+                    {
+                        fastgltf::iterateAccessorWithIndex<glm::vec3>(asset.get(), asset->accessors[normalsAttribute->accessorIndex],
+                                                                      [&](const glm::vec3& n, const u64 index) {
+                                                                          vertexAttributes[initialVertexIndex + index].Normal =
+                                                                              glm::packHalf(Shaders::EncodeOct(n));
+                                                                      });
+                    }
+
+                    if (const auto* uvAttribute = primitive.findAttribute("TEXCOORD_0"); uvAttribute != primitive.attributes.end())
+                    {
+                        fastgltf::iterateAccessorWithIndex<glm::vec2>(asset.get(), asset->accessors[uvAttribute->accessorIndex],
+                                                                      [&](const glm::vec2& uv, const u64 index) {
+                                                                          vertexAttributes[initialVertexIndex + index].UV =
+                                                                              glm::packHalf(uv);
+                                                                      });
+                    }
+                }
+                if (indices.empty())
+                {
+                    LOG_WARN("AW2: Mesh [{}] has no triangles, skipping it!", meshIndex);
+                    m_Geometries.emplace_back();  // Keep geometry IDs matching glTF mesh indices.
+                    continue;
+                }
+
+                const auto meshletCachePath = std::string(MeshletBuilder::s_MeshletCacheDir) + meshFilePath.stem().string() + "_" +
+                                              std::to_string(meshIndex) + ".bin";
+                const u64 meshletCacheKey = MeshletBuilder::MakeMeshletCacheKey(vertexPositions, indices);
+
+                auto meshletGeometry = MeshletBuilder::LoadMeshletCache(meshletCachePath, meshletCacheKey);
+                if (!meshletGeometry.has_value())
+                {
+                    meshletGeometry = MeshletBuilder::BuildMeshlets(vertexPositions, indices);
+                    MeshletBuilder::SaveMeshletCache(meshletCachePath, meshletCacheKey, *meshletGeometry);
+                }
+
+                const auto& meshlets            = *meshletGeometry;
+                auto& geometry                  = m_Geometries.emplace_back();
+                geometry.VertexPositions        = (const VertexPosition*)UploadArrayFunc(vertexPositions)->GetBDA();
+                geometry.VertexAttributes       = (const VertexAttribute*)UploadArrayFunc(vertexAttributes)->GetBDA();
+                geometry.Meshlets               = (const Shaders::MeshletMainData*)UploadArrayFunc(meshlets.Meshlets)->GetBDA();
+                geometry.MeshletCullData        = (const Shaders::MeshletCullData*)UploadArrayFunc(meshlets.MeshletCullData)->GetBDA();
+                geometry.MeshletVertexIndices   = (const u32*)UploadArrayFunc(meshlets.MeshletVertexIndices)->GetBDA();
+                geometry.MeshletTriangleIndices = (const u32*)UploadArrayFunc(meshlets.MeshletTriangleIndices)->GetBDA();
+                geometry.MeshletCount           = static_cast<u32>(meshlets.Meshlets.size());
+            }
+
+            // NOTE: Instances are baked with world transforms, scene is static for now.
+            fastgltf::iterateSceneNodes(asset.get(), asset->defaultScene.value_or(0), fastgltf::math::fmat4x4(),
+                                        [&](fastgltf::Node& node, const fastgltf::math::fmat4x4& worldTransform)
+                                        {
+                                            if (!node.meshIndex.has_value()) return;
+
+                                            glm::mat4 trs{1.0f};
+                                            std::memcpy(&trs, worldTransform.data(), sizeof(trs));
+
+                                            glm::quat q{1.0f, 0.0f, 0.0f, 0.0f};
+                                            glm::vec3 decomposePlaceholder0{1.0f};
+                                            glm::vec4 decomposePlaceholder1{1.0f};
+                                            auto& instance = m_Instances.emplace_back();
+                                            glm::decompose(trs, instance.Scale, q, instance.Translation, decomposePlaceholder0,
+                                                           decomposePlaceholder1);
+                                            instance.Orientation = glm::vec4(q.w, q.x, q.y, q.z);
+                                            instance.GeometryID  = static_cast<u32>(*node.meshIndex);
+                                        });
+            RDNT_ASSERT(!m_Instances.empty(), "AW2: Scene has no mesh instances!");
+
+            m_GeometryBuffer = UploadFunc(m_Geometries.data(), m_Geometries.size() * sizeof(m_Geometries[0]), sizeof(m_Geometries[0]),
+                                          vk::BufferUsageFlagBits::eStorageBuffer);
+            m_InstanceBuffer = UploadFunc(m_Instances.data(), m_Instances.size() * sizeof(m_Instances[0]), sizeof(m_Instances[0]),
+                                          vk::BufferUsageFlagBits::eStorageBuffer);
+
+            executionContext.CommandBuffer.end();
+            gfxContext->SubmitImmediateExecuteContext(executionContext);
+
+            u64 totalMeshletCount{0};
+            for (const auto& geometry : m_Geometries)
+                totalMeshletCount += geometry.MeshletCount;
+
+            LOG_INFO("Loaded ({}) geometries, ({}) meshlets, ({}) instances in [{:.3f}] ms", m_Geometries.size(), totalMeshletCount,
+                     m_Instances.size(),
+                     std::chrono::duration<f32, std::chrono::milliseconds::period>(Timer::Now() - meshletBuildBeginTime).count());
+        }
+
+    }  // namespace AW2
+
+}  // namespace Radiant
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "AlanWake2MeshletBuilder.hpp"
+
+namespace Radiant
+{
+
+    class GfxBuffer;
+    class GfxContext;
+
+    namespace AW2
+    {
+
+        // NOTE: Every glTF mesh becomes single geometry(all primitives merged), every node referencing mesh becomes an instance.
+        class Mesh final : private Uncopyable, private Unmovable
+        {
+          public:
+            Mesh(const Unique<GfxContext>& gfxContext, const std::filesystem::path& meshFilePath) noexcept;
+            ~Mesh() noexcept = default;
+
+            NODISCARD FORCEINLINE const auto& GetGeometries() const noexcept { return m_Geometries; }
+            NODISCARD FORCEINLINE const auto& GetInstances() const noexcept { return m_Instances; }
+            NODISCARD FORCEINLINE const auto& GetGeometryBuffer() const noexcept { return m_GeometryBuffer; }
+            NODISCARD FORCEINLINE const auto& GetInstanceBuffer() const noexcept { return m_InstanceBuffer; }
+
+          private:
+            std::vector<Shaders::MeshGeometryData> m_Geometries;
+            std::vector<Shaders::MeshInstanceData> m_Instances;
+            std::vector<Unique<GfxBuffer>> m_GeometryStreamBuffers;  // Vertices and meshlets referenced by BDA from m_GeometryBuffer.
+            Unique<GfxBuffer> m_GeometryBuffer{nullptr};
+            Unique<GfxBuffer> m_InstanceBuffer{nullptr};
+
+            constexpr Mesh() noexcept = delete;
+        };
+
+    }  // namespace AW2
+
+}  // namespace Radiant
@@ -0,0 +1,148 @@
+#include "AlanWake2MeshletBuilder.hpp"
+
+#include <meshoptimizer.h>
+
+namespace Radiant
+{
+
+    namespace AW2
+    {
+
+        namespace MeshletBuilder
+        {
+            static constexpr u32 s_MeshletCacheVersion = 1;
+
+            struct MeshletCacheHeader
+            {
+                u64 CacheKey{0};
+                u64 MeshletCount{0};
+                u64 MeshletVertexIndexCount{0};
+                u64 MeshletTriangleCount{0};
+            };
+
+            static_assert(sizeof(Shaders::MeshletCullData) == sizeof(meshopt_Bounds),
+                          "MeshletCullData should mirror meshopt_Bounds, it's copied as is!");
+
+            MeshletGeometry BuildMeshlets(const std::vector<VertexPosition>& vertexPositions, const std::vector<u32>& indices) noexcept
+            {
+                RDNT_ASSERT(!vertexPositions.empty() && !indices.empty(), "Can't build meshlets out of empty geometry!");
+
+                const u64 maxMeshletCount =
+                    meshopt_buildMeshletsBound(indices.size(), Shaders::s_MaxMeshletVertexCount, Shaders::s_MaxMeshletTriangleCount);
+                std::vector<meshopt_Meshlet> meshlets(maxMeshletCount);
+                std::vector<u32> meshletVertices(maxMeshletCount * Shaders::s_MaxMeshletVertexCount);
+                std::vector<u8> meshletTriangles(maxMeshletCount * Shaders::s_MaxMeshletTriangleCount * 3);
+
+                const u64 meshletCount = meshopt_buildMeshlets(
+                    meshlets.data(), meshletVertices.data(), meshletTriangles.data(), indices.data(), indices.size(),
+                    &vertexPositions[0].Position.x, vertexPositions.size(), sizeof(vertexPositions[0]), Shaders::s_MaxMeshletVertexCount,
+                    Shaders::s_MaxMeshletTriangleCount, Shaders::s_MeshletCullConeWeight);
+
+                MeshletGeometry meshletGeometry = {};
+                meshletGeometry.Meshlets.reserve(meshletCount);
+                meshletGeometry.MeshletCullData.reserve(meshletCount);
+                for (u64 meshletIndex{}; meshletIndex < meshletCount; ++meshletIndex)
+                {
+                    const auto& meshlet       = meshlets[meshletIndex];
+                    auto* meshletVertexData   = &meshletVertices[meshlet.vertex_offset];
+                    auto* meshletTriangleData = &meshletTriangles[meshlet.triangle_offset];
+
+                    // NOTE: Reorders triangles and vertices inside meshlet for better locality during rasterization.
+                    meshopt_optimizeMeshlet(meshletVertexData, meshletTriangleData, meshlet.triangle_count, meshlet.vertex_count);
+
+                    const auto bounds =
+                        meshopt_computeMeshletBounds(meshletVertexData, meshletTriangleData, meshlet.triangle_count,
+                                                     &vertexPositions[0].Position.x, vertexPositions.size(), sizeof(vertexPositions[0]));
+                    std::memcpy(&meshletGeometry.MeshletCullData.emplace_back(), &bounds, sizeof(bounds));
+
+                    meshletGeometry.Meshlets.emplace_back(static_cast<u32>(meshletGeometry.MeshletVertexIndices.size()),
+                                                          static_cast<u32>(meshletGeometry.MeshletTriangleIndices.size()),
+                                                          meshlet.vertex_count, meshlet.triangle_count);
+
+                    meshletGeometry.MeshletVertexIndices.insert(meshletGeometry.MeshletVertexIndices.end(), meshletVertexData,
+                                                                meshletVertexData + meshlet.vertex_count);
+                    for (u32 triangleIndex{}; triangleIndex < meshlet.triangle_count; ++triangleIndex)
+                    {
+                        const auto* triangle = &meshletTriangleData[triangleIndex * 3];
+                        meshletGeometry.MeshletTriangleIndices.emplace_back(static_cast<u32>(triangle[0]) |
+                                                                            static_cast<u32>(triangle[1]) << 8 |
+                                                                            static_cast<u32>(triangle[2]) << 16);
+                    }
+                }
+
+                return meshletGeometry;
+            }
+
+            u64 MakeMeshletCacheKey(const std::vector<VertexPosition>& vertexPositions, const std::vector<u32>& indices) noexcept
+            {
+                const std::array<u64, 6> keyData = {
+                    s_MeshletCacheVersion,
+                    Shaders::s_MaxMeshletVertexCount,
+                    Shaders::s_MaxMeshletTriangleCount,
+                    static_cast<u64>(Shaders::s_MeshletCullConeWeight * 1000.0f),
+                    ankerl::unordered_dense::detail::wyhash::hash(vertexPositions.data(),
+                                                                  vertexPositions.size() * sizeof(vertexPositions[0])),
+                    ankerl::unordered_dense::detail::wyhash::hash(indices.data(), indices.size() * sizeof(indices[0]))};
+                return ankerl::unordered_dense::detail::wyhash::hash(keyData.data(), sizeof(keyData));
+            }
+
+            std::optional<MeshletGeometry> LoadMeshletCache(const std::string& cachePath, const u64 cacheKey) noexcept
+            {
+                if (!std::filesystem::exists(cachePath)) return std::nullopt;
+
+                const auto rawData = CoreUtils::LoadData<u8>(cachePath);
+                if (rawData.size() < sizeof(MeshletCacheHeader)) return std::nullopt;
+
+                MeshletCacheHeader header = {};
+                std::memcpy(&header, rawData.data(), sizeof(header));
+                if (header.CacheKey != cacheKey) return std::nullopt;
+
+                const u64 expectedSize = sizeof(header) +
+                                         header.MeshletCount * (sizeof(Shaders::MeshletMainData) + sizeof(Shaders::MeshletCullData)) +
+                                         (header.MeshletVertexIndexCount + header.MeshletTriangleCount) * sizeof(u32);
+                if (rawData.size() != expectedSize) return std::nullopt;
+
+                MeshletGeometry meshletGeometry = {};
+                u64 offset{sizeof(header)};
+                const auto ReadArrayFunc = [&](auto& outArray, const u64 count) noexcept
+                {
+                    outArray.resize(count);
+                    std::memcpy(outArray.data(), rawData.data() + offset, count * sizeof(outArray[0]));
+                    offset += count * sizeof(outArray[0]);
+                };
+                ReadArrayFunc(meshletGeometry.Meshlets, header.MeshletCount);
+                ReadArrayFunc(meshletGeometry.MeshletCullData, header.MeshletCount);
+                ReadArrayFunc(meshletGeometry.MeshletVertexIndices, header.MeshletVertexIndexCount);
+                ReadArrayFunc(meshletGeometry.MeshletTriangleIndices, header.MeshletTriangleCount);
+
+                return meshletGeometry;
+            }
+
+            void SaveMeshletCache(const std::string& cachePath, const u64 cacheKey, const MeshletGeometry& meshletGeometry) noexcept
+            {
+                const MeshletCacheHeader header = {.CacheKey                = cacheKey,
+                                                   .MeshletCount            = meshletGeometry.Meshlets.size(),
+                                                   .MeshletVertexIndexCount = meshletGeometry.MeshletVertexIndices.size(),
+                                                   .MeshletTriangleCount    = meshletGeometry.MeshletTriangleIndices.size()};
+
+                std::vector<u8> rawData(reinterpret_cast<const u8*>(&header), reinterpret_cast<const u8*>(&header) + sizeof(header));
+                const auto WriteArrayFunc = [&](const auto& array) noexcept
+                {
+                    const auto* arrayData = reinterpret_cast<const u8*>(array.data());
+                    rawData.insert(rawData.end(), arrayData, arrayData + array.size() * sizeof(array[0]));
+                };
+                WriteArrayFunc(meshletGeometry.Meshlets);
+                WriteArrayFunc(meshletGeometry.MeshletCullData);
+                WriteArrayFunc(meshletGeometry.MeshletVertexIndices);
+                WriteArrayFunc(meshletGeometry.MeshletTriangleIndices);
+
+                const auto cacheDirectory = std::filesystem::path(cachePath).parent_path();
+                if (!cacheDirectory.empty()) std::filesystem::create_directories(cacheDirectory);
+                CoreUtils::SaveData(cachePath, rawData);
+            }
+
+        }  // namespace MeshletBuilder
+
+    }  // namespace AW2
+
+}  // namespace Radiant
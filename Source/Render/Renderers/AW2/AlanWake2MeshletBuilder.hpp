@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+#include <aw2/aw2_defines.hpp>
+
+namespace Radiant
+{
+
+    namespace AW2
+    {
+
+        // NOTE: CPU side meshlets of a single geometry, doesn't touch GPU at all, so it can be built and cached headless.
+        struct MeshletGeometry final
+        {
+            std::vector<Shaders::MeshletMainData> Meshlets;
+            std::vector<Shaders::MeshletCullData> MeshletCullData;
+            std::vector<u32> MeshletVertexIndices;
+            std::vector<u32> MeshletTriangleIndices;  // 3 meshlet local vertices packed as u8 per triangle.
+        };
+
+        namespace MeshletBuilder
+        {
+            static constexpr const char* s_MeshletCacheDir = "meshlet_cache/";
+
+            NODISCARD MeshletGeometry BuildMeshlets(const std::vector<VertexPosition>& vertexPositions,
+                                                    const std::vector<u32>& indices) noexcept;
+
+            // NOTE: Key covers input geometry and meshlet limits, so changing any of them rebuilds meshlets.
+            NODISCARD u64 MakeMeshletCacheKey(const std::vector<VertexPosition>& vertexPositions, const std::vector<u32>& indices) noexcept;
+            NODISCARD std::optional<MeshletGeometry> LoadMeshletCache(const std::string& cachePath, const u64 cacheKey) noexcept;
+            void SaveMeshletCache(const std::string& cachePath, const u64 cacheKey, const MeshletGeometry& meshletGeometry) noexcept;
+
+        }  // namespace MeshletBuilder
+
+    }  // namespace AW2
+
+}  // namespace Radiant
@@ -6,57 +6,142 @@ namespace Radiant
     namespace ResourceNames
     {
         const std::string CameraBuffer{"Resource_CameraBuffer"};
+        const std::string CullingDataBuffer{"Resource_CullingDataBuffer"};
         const std::string GBufferAlbedo{"Resource_LBuffer"};
+        const std::string GBufferAlbedoLate{"Resource_LBuffer_Late"};
 
         const std::string PrevFrameDepthBuffer{"Resource_DepthBufferLastFrame"};
         const std::string DepthBuffer{"Resource_DepthBuffer"};
+        const std::string DepthBufferLate{"Resource_DepthBuffer_Late"};
         const std::string HiZBuffer{"Resource_HiZBuffer"};
+
+        const std::string MeshletLateDrawBuffer{"Resource_MeshletLateDrawBuffer"};
     }  // namespace ResourceNames
 
     namespace AW2
     {
 
+        static bool s_bEnableOcclusionCulling{true};
+
         AlanWake2Renderer::AlanWake2Renderer() noexcept
         {
             m_MainCamera = MakeShared<Camera>(70.0f, static_cast<f32>(m_ViewportExtent.width) / static_cast<f32>(m_ViewportExtent.height),
                                               1000.0f, 0.0001f);
 
-            {
-                const GfxPipelineDescription pipelineDesc = {
-                    .DebugName       = "Hierarchical Z Buffer Build",
-                    .PipelineOptions = GfxComputePipelineOptions{},
-                    .Shader =
-                        MakeShared<GfxShader>(m_GfxContext->GetDevice(), GfxShaderDescription{.Path = "../Assets/Shaders/aw2/hzb.slang"})};
-                m_HZBPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
-            }
+            m_Mesh = MakeUnique<Mesh>(m_GfxContext, "../Assets/Models/sponza/scene.gltf");
 
             {
-                auto triMsShader                     = MakeShared<GfxShader>(m_GfxContext->GetDevice(),
-                                                         GfxShaderDescription{.Path = "../Assets/Shaders/aw2/triangle_mesh_shader.slang"});
+                // NOTE: Without mesh shaders(e.g. lavapipe) the same meshlets are drawn through vertex pulling.
+                const std::string shaderPath = s_bRequireMeshShading ? "../Assets/Shaders/aw2/meshlet_mesh_shading.slang"
+                                                                     : "../Assets/Shaders/aw2/meshlet_vertex_pulling.slang";
+                auto meshletShader = MakeShared<GfxShader>(m_GfxContext->GetDevice(), GfxShaderDescription{.Path = shaderPath});
                 const GfxGraphicsPipelineOptions gpo = {
                     .RenderingFormats{vk::Format::eR8G8B8A8Srgb, vk::Format::eD32Sfloat},
-                    //   .DynamicStates{vk::DynamicState::eCullMode},
+                    .CullMode{vk::CullModeFlagBits::eBack},
                     .FrontFace{vk::FrontFace::eCounterClockwise},
                     .PolygonMode{vk::PolygonMode::eFill},
+                    .bMeshShading{s_bRequireMeshShading},
                     .bDepthTest{true},
                     .bDepthWrite{true},
                     .DepthCompareOp{vk::CompareOp::eGreaterOrEqual},
                 };
                 const GfxPipelineDescription pipelineDesc = {
-                    .DebugName = "triangle_mesh_shader", .PipelineOptions = gpo, .Shader = triMsShader};
-                m_MSTriPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                    .DebugName = "MeshletPipeline", .PipelineOptions = gpo, .Shader = meshletShader};
+                m_MeshletPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+            }
+
+            {
+                auto cullingShader = MakeShared<GfxShader>(
+                    m_GfxContext->GetDevice(), GfxShaderDescription{.Path = "../Assets/Shaders/aw2/meshlet_occlusion_culling.slang"});
+                const GfxPipelineDescription pipelineDesc = {
+                    .DebugName = "MeshletOcclusionCulling", .PipelineOptions = GfxComputePipelineOptions{}, .Shader = cullingShader};
+                m_MeshletOcclusionCullingPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+            }
+
+            {
+                const auto& geometries = m_Mesh->GetGeometries();
+                const auto& instances  = m_Mesh->GetInstances();
+
+                u32 meshletBitCount{0};
+                m_MeshletBitOffsets.resize(instances.size());
+                for (u32 instanceIndex{}; instanceIndex < instances.size(); ++instanceIndex)
+                {
+                    m_MeshletBitOffsets[instanceIndex] = meshletBitCount;
+                    meshletBitCount += Math::AlignUp(geometries[instances[instanceIndex].GeometryID].MeshletCount, 32u);
+                }
+                m_MeshletBitWordCount = std::max(meshletBitCount / 32, 1u);
+
+                // NOTE: Nothing is visible at the start, so first frame draws everything in the late phase against empty HZB.
+                m_MeshletVisibilityBuffer = MakeUnique<GfxBuffer>(
+                    m_GfxContext->GetDevice(), GfxBufferDescription(m_MeshletBitWordCount * sizeof(u32), sizeof(u32),
+                                                                    vk::BufferUsageFlagBits::eStorageBuffer,
+                                                                    EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
+                std::memset(m_MeshletVisibilityBuffer->GetMapped(), 0, m_MeshletBitWordCount * sizeof(u32));
+                m_GfxContext->GetDevice()->SetDebugName("MeshletVisibilityBuffer", (const vk::Buffer&)*m_MeshletVisibilityBuffer);
             }
         }
 
         void AlanWake2Renderer::RenderFrame() noexcept
         {
+            struct MeshletPushConstantBlock
+            {
+                const Shaders::CameraData* CameraData;
+                const Shaders::CullingData* CullingData;
+                const Shaders::MeshGeometryData* GeometryData;
+                const Shaders::MeshInstanceData* InstanceData;
+                const u32* MeshletBits;
+                u32 InstanceIndex;
+                u32 MeshletBitOffset;
+                u32 bLatePhase;
+            };
 
-            struct MSTestPassData
+            // NOTE: Both phases issue the same draws, shaders pick meshlets out of MeshletBits.
+            const auto DrawMeshletsFunc = [&](const vk::CommandBuffer& cmd, const Unique<GfxBuffer>& cameraUBO,
+                                              const Unique<GfxBuffer>& cullingDataUBO, const Unique<GfxBuffer>& meshletBitsBuffer,
+                                              const bool bLatePhase)
+            {
+                auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
+                pipelineStateCache.Bind(cmd, m_MeshletPipeline.get());
+
+                MeshletPushConstantBlock pc = {};
+                pc.CameraData               = (const Shaders::CameraData*)cameraUBO->GetBDA();
+                pc.CullingData              = (const Shaders::CullingData*)cullingDataUBO->GetBDA();
+                pc.GeometryData             = (const Shaders::MeshGeometryData*)m_Mesh->GetGeometryBuffer()->GetBDA();
+                pc.InstanceData             = (const Shaders::MeshInstanceData*)m_Mesh->GetInstanceBuffer()->GetBDA();
+                pc.MeshletBits              = (const u32*)meshletBitsBuffer->GetBDA();
+                pc.bLatePhase               = bLatePhase ? 1 : 0;
+
+                const auto& geometries = m_Mesh->GetGeometries();
+                const auto& instances  = m_Mesh->GetInstances();
+                for (u32 instanceIndex{}; instanceIndex < instances.size(); ++instanceIndex)
+                {
+                    const u32 meshletCount = geometries[instances[instanceIndex].GeometryID].MeshletCount;
+                    if (meshletCount == 0) continue;
+
+                    pc.InstanceIndex    = instanceIndex;
+                    pc.MeshletBitOffset = m_MeshletBitOffsets[instanceIndex];
+                    cmd.pushConstants<MeshletPushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
+                                                                vk::ShaderStageFlagBits::eAll, 0, pc);
+
+                    if constexpr (s_bRequireMeshShading)
+                        cmd.drawMeshTasksEXT((meshletCount + MESHLET_WG_SIZE - 1) / MESHLET_WG_SIZE, 1, 1);
+                    else
+                        cmd.draw(Shaders::s_MaxMeshletTriangleCount * 3, meshletCount, 0, 0);
+                }
+            };
+
+            // NOTE: Two phase occlusion culling:
+            // 1. Early phase draws meshlets visible last frame.
+            // 2. HZB is built out of early phase depth.
+            // 3. Every meshlet is tested against HZB, persistent visibility is refreshed, newly visible meshlets are marked.
+            // 4. Late phase draws marked meshlets on top of early phase.
+            struct MainPassData
             {
                 RGResourceID CameraBuffer;
-            } msTestPassData = {};
+                RGResourceID CullingDataBuffer;
+            } earlyMainPassData = {};
             m_RenderGraph->AddPass(
-                "MeshShaderTestPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
+                "EarlyMainPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
                 [&](RenderGraphResourceScheduler& scheduler)
                 {
                     scheduler.CreateTexture(
@@ -87,9 +172,16 @@ namespace Radiant
                                            GfxBufferDescription(sizeof(Shaders::CameraData), sizeof(Shaders::CameraData),
                                                                 vk::BufferUsageFlagBits::eUniformBuffer,
                                                                 EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
-                    msTestPassData.CameraBuffer =
+                    earlyMainPassData.CameraBuffer =
                         scheduler.WriteBuffer(ResourceNames::CameraBuffer, EResourceStateBits::RESOURCE_STATE_UNIFORM_BUFFER_BIT);
 
+                    scheduler.CreateBuffer(ResourceNames::CullingDataBuffer,
+                                           GfxBufferDescription(sizeof(Shaders::CullingData), sizeof(Shaders::CullingData),
+                                                                vk::BufferUsageFlagBits::eUniformBuffer,
+                                                                EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
+                    earlyMainPassData.CullingDataBuffer =
+                        scheduler.WriteBuffer(ResourceNames::CullingDataBuffer, EResourceStateBits::RESOURCE_STATE_UNIFORM_BUFFER_BIT);
+
                     scheduler.SetViewportScissors(vk::Viewport()
                                                       .setMinDepth(0.0f)
                                                       .setMaxDepth(1.0f)
@@ -99,131 +191,202 @@ namespace Radiant
                 },
                 [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
                 {
-                    auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
-                    pipelineStateCache.Bind(cmd, m_MSTriPipeline.get());
-
-                    auto& cameraUBO             = scheduler.GetBuffer(msTestPassData.CameraBuffer);
+                    auto& cameraUBO             = scheduler.GetBuffer(earlyMainPassData.CameraBuffer);
                     const auto cameraShaderData = GetShaderMainCameraData();
                     cameraUBO->SetData(&cameraShaderData, sizeof(cameraShaderData));
 
-                    struct PushConstantBlock
+                    auto& cullingDataUBO = scheduler.GetBuffer(earlyMainPassData.CullingDataBuffer);
+                    Shaders::CullingData cullingData{};
+                    const auto frustumPlanes = Math::ExtractFrustumPlanes(m_MainCamera->GetViewProjectionMatrix());
+                    for (u32 i{}; i < frustumPlanes.size(); ++i)
                     {
-                        const Shaders::CameraData* CameraData;
-                    } pc          = {};
-                    pc.CameraData = (const Shaders::CameraData*)cameraUBO->GetBDA();
-                    cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
-                                                         vk::ShaderStageFlagBits::eAll, 0, pc);
-                    cmd.drawMeshTasksEXT(1, 1, 1);
+                        cullingData.FrustumPlanes[i].Normal   = glm::vec3(frustumPlanes[i]);
+                        cullingData.FrustumPlanes[i].Distance = frustumPlanes[i].w;
+                    }
+                    cullingDataUBO->SetData(&cullingData, sizeof(cullingData));
+
+                    DrawMeshletsFunc(cmd, cameraUBO, cullingDataUBO, m_MeshletVisibilityBuffer, false);
                 });
 
-#if 1
             struct HZBPassData
             {
                 RGResourceID DepthTexture;
                 RGResourceID HZBTexture;
-            };
-            std::array<HZBPassData, HZB_MIP_COUNT> hzbPassDatas{};
+            } hzbPassData = {};
             const auto realHzbMipCount = GfxTextureUtils::GetMipLevelCount(m_ViewportExtent.width, m_ViewportExtent.height);
             RDNT_ASSERT(realHzbMipCount <= HZB_MIP_COUNT, "Reached HZB mip count limit, extend it!");
 
-            for (u32 mipLevel{}; mipLevel < realHzbMipCount; ++mipLevel)
+            // NOTE: Chain is built by GfxDownsampler(one dispatch per run of even sized mips): mip 0 is a copy of depth buffer, the rest
+            // is min reduced(reversed z), so every texel holds the farthest depth of its footprint. AlanWake2HZB.cpp mirrors it on CPU.
+            m_RenderGraph->AddPass(
+                "HZBPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
+                [&](RenderGraphResourceScheduler& scheduler)
+                {
+                    scheduler.CreateTexture(ResourceNames::HiZBuffer,
+                                            GfxTextureDescription(
+                                                vk::ImageType::e2D, glm::uvec3(m_ViewportExtent.width, m_ViewportExtent.height, 1.0f),
+                                                vk::Format::eR32Sfloat, vk::ImageUsageFlagBits::eStorage,
+                                                vk::SamplerCreateInfo()
+                                                    .setAddressModeU(vk::SamplerAddressMode::eClampToBorder)
+                                                    .setAddressModeV(vk::SamplerAddressMode::eClampToBorder)
+                                                    .setAddressModeW(vk::SamplerAddressMode::eClampToBorder)
+                                                    .setMagFilter(vk::Filter::eNearest)
+                                                    .setMinFilter(vk::Filter::eNearest)
+                                                    .setBorderColor(vk::BorderColor::eFloatOpaqueBlack),
+                                                1, vk::SampleCountFlagBits::e1,
+                                                EResourceCreateBits::RESOURCE_CREATE_EXPOSE_MIPS_BIT |
+                                                    EResourceCreateBits::RESOURCE_CREATE_CREATE_MIPS_BIT,
+                                                realHzbMipCount));
+
+                    hzbPassData.DepthTexture = scheduler.ReadTexture(ResourceNames::DepthBuffer, MipSet::FirstMip(),
+                                                                     EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+                    hzbPassData.HZBTexture   = scheduler.WriteTexture(ResourceNames::HiZBuffer, MipSet::AllMips(),
+                                                                      EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+                },
+                [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
+                {
+                    auto& depthTexture = scheduler.GetTexture(hzbPassData.DepthTexture);
+                    auto& hzbTexture   = scheduler.GetTexture(hzbPassData.HZBTexture);
+
+                    GfxDownsampleDescription downsampleDesc = {
+                        .SrcDimensions    = glm::uvec2(depthTexture->GetDescription().Dimensions),
+                        .SrcTextureID     = depthTexture->GetBindlessTextureID(),
+                        .DstMip0TextureID = hzbTexture->GetBindlessRWImageID(0),
+                        .Reduction        = EDownsampleReduction::DOWNSAMPLE_REDUCTION_MIN};
+                    for (u32 mipLevel{1}; mipLevel < realHzbMipCount; ++mipLevel)
+                        downsampleDesc.DstMipTextureIDs.emplace_back(hzbTexture->GetBindlessRWImageID(mipLevel));
+
+                    m_GfxContext->GetDownsampler()->Dispatch(cmd, m_GfxContext->GetPipelineStateCache(), downsampleDesc);
+                });
+
+            struct MeshletOcclusionCullingPassData
             {
-                const auto passName = "HZBPass" + std::to_string(mipLevel);
+                RGResourceID CameraBuffer;
+                RGResourceID CullingDataBuffer;
+                RGResourceID HZBTexture;
+                RGResourceID MeshletLateDrawBuffer;
+            } mocPassData = {};
+            m_RenderGraph->AddPass(
+                "MeshletOcclusionCullingPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
+                [&](RenderGraphResourceScheduler& scheduler)
+                {
+                    scheduler.CreateBuffer(ResourceNames::MeshletLateDrawBuffer,
+                                           GfxBufferDescription(m_MeshletBitWordCount * sizeof(u32), sizeof(u32),
+                                                                vk::BufferUsageFlagBits::eStorageBuffer,
+                                                                EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+                    mocPassData.MeshletLateDrawBuffer =
+                        scheduler.WriteBuffer(ResourceNames::MeshletLateDrawBuffer,
+                                              EResourceStateBits::RESOURCE_STATE_STORAGE_BUFFER_BIT |
+                                                  EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+                    scheduler.ClearOnExecute(ResourceNames::MeshletLateDrawBuffer, 0, m_MeshletBitWordCount * sizeof(u32));
 
-                m_RenderGraph->AddPass(
-                    passName, ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
-                    [&](RenderGraphResourceScheduler& scheduler)
+                    mocPassData.CameraBuffer =
+                        scheduler.ReadBuffer(ResourceNames::CameraBuffer, EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+                    mocPassData.CullingDataBuffer = scheduler.ReadBuffer(ResourceNames::CullingDataBuffer,
+                                                                         EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+                    mocPassData.HZBTexture        = scheduler.ReadTexture(ResourceNames::HiZBuffer, MipSet::AllMips(),
+                                                                          EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+                },
+                [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
+                {
+                    // NOTE: Persistent visibility lives outside of render graph and render graph doesn't know about task shader stage,
+                    // so hazards against early phase(this and next frame) and late phase are resolved here.
+                    constexpr auto drawStageMask =
+                        s_bRequireMeshShading ? vk::PipelineStageFlagBits2::eTaskShaderEXT : vk::PipelineStageFlagBits2::eVertexShader;
+                    cmd.pipelineBarrier2(vk::DependencyInfo().setMemoryBarriers(
+                        vk::MemoryBarrier2()
+                            .setSrcStageMask(drawStageMask)
+                            .setSrcAccessMask(vk::AccessFlagBits2::eShaderRead)
+                            .setDstStageMask(vk::PipelineStageFlagBits2::eComputeShader)
+                            .setDstAccessMask(vk::AccessFlagBits2::eShaderRead | vk::AccessFlagBits2::eShaderWrite)));
+
+                    auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
+                    pipelineStateCache.Bind(cmd, m_MeshletOcclusionCullingPipeline.get());
+
+                    auto& hzbTexture = scheduler.GetTexture(mocPassData.HZBTexture);
+                    struct PushConstantBlock
                     {
-                        if (mipLevel == 0)
-                        {
-                            scheduler.CreateTexture(
-                                ResourceNames::HiZBuffer,
-                                GfxTextureDescription(
-                                    vk::ImageType::e2D, glm::uvec3(m_ViewportExtent.width, m_ViewportExtent.height, 1.0f),
-                                    vk::Format::eR32Sfloat, vk::ImageUsageFlagBits::eStorage,
-                                    vk::SamplerCreateInfo()
-                                        .setAddressModeU(vk::SamplerAddressMode::eClampToBorder)
-                                        .setAddressModeV(vk::SamplerAddressMode::eClampToBorder)
-                                        .setAddressModeW(vk::SamplerAddressMode::eClampToBorder)
-                                        .setMagFilter(vk::Filter::eNearest)
-                                        .setMinFilter(vk::Filter::eNearest)
-                                        .setBorderColor(vk::BorderColor::eFloatOpaqueBlack),
-                                    1, vk::SampleCountFlagBits::e1,
-                                    EResourceCreateBits::RESOURCE_CREATE_EXPOSE_MIPS_BIT |
-                                        EResourceCreateBits::RESOURCE_CREATE_CREATE_MIPS_BIT |
-                                        EResourceCreateBits::RESOURCE_CREATE_FORCE_NO_RESOURCE_MEMORY_ALIASING_BIT,  // TODO: remove no rma
-                                                                                                                     // when you finally add
-                                                                                                                     // pass that uses hzb!
-                                    realHzbMipCount));
-
-                            hzbPassDatas[mipLevel].DepthTexture =
-                                scheduler.ReadTexture(ResourceNames::DepthBuffer, MipSet::FirstMip(),
-                                                      EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
-                        }
-
-                        if (mipLevel > 0)
-                        {
-                            scheduler.ReadTexture(ResourceNames::HiZBuffer, MipSet::Explicit(mipLevel - 1),
-                                                  EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
-                        }
-                        hzbPassDatas[mipLevel].HZBTexture =
-                            scheduler.WriteTexture(ResourceNames::HiZBuffer, MipSet::Explicit(mipLevel),
-                                                   EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
-                    },
-                    [&, mipLevel](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
+                        const Shaders::CameraData* CameraData;
+                        const Shaders::CullingData* CullingData;
+                        const Shaders::MeshGeometryData* GeometryData;
+                        const Shaders::MeshInstanceData* InstanceData;
+                        u32* MeshletVisibilityBits;
+                        u32* MeshletLateDrawBits;
+                        glm::uvec2 HZBDimensions;
+                        u32 HZBTextureID;
+                        u32 HZBMipCount;
+                        u32 InstanceIndex;
+                        u32 MeshletBitOffset;
+                        u32 bOcclusionCulling;
+                    } pc                     = {};
+                    pc.CameraData            = (const Shaders::CameraData*)scheduler.GetBuffer(mocPassData.CameraBuffer)->GetBDA();
+                    pc.CullingData           = (const Shaders::CullingData*)scheduler.GetBuffer(mocPassData.CullingDataBuffer)->GetBDA();
+                    pc.GeometryData          = (const Shaders::MeshGeometryData*)m_Mesh->GetGeometryBuffer()->GetBDA();
+                    pc.InstanceData          = (const Shaders::MeshInstanceData*)m_Mesh->GetInstanceBuffer()->GetBDA();
+                    pc.MeshletVisibilityBits = (u32*)m_MeshletVisibilityBuffer->GetBDA();
+                    pc.MeshletLateDrawBits   = (u32*)scheduler.GetBuffer(mocPassData.MeshletLateDrawBuffer)->GetBDA();
+                    pc.HZBDimensions         = glm::uvec2(hzbTexture->GetDescription().Dimensions);
+                    pc.HZBTextureID          = hzbTexture->GetBindlessTextureID();
+                    pc.HZBMipCount           = realHzbMipCount;
+                    pc.bOcclusionCulling     = s_bEnableOcclusionCulling ? 1 : 0;
+
+                    const auto& geometries = m_Mesh->GetGeometries();
+                    const auto& instances  = m_Mesh->GetInstances();
+                    for (u32 instanceIndex{}; instanceIndex < instances.size(); ++instanceIndex)
                     {
-                        auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
-                        pipelineStateCache.Bind(cmd, m_HZBPipeline.get());
-
-                        struct PushConstantBlock
-                        {
-                            u32 SrcTextureID{};
-                            u32 DstTextureID{};
-                            u32 SamplerID{};
-                            glm::vec2 SrcTextureSizeRcp{1.0f};
-                        } pc = {};
-
-                        constexpr auto samplerReductionMode =
-                            vk::SamplerReductionModeCreateInfo().setReductionMode(vk::SamplerReductionMode::eMax);
-                        pc.SamplerID = m_GfxContext->GetDevice()
-                                           ->GetSampler(vk::SamplerCreateInfo()
-                                                            .setAddressModeU(vk::SamplerAddressMode::eClampToEdge)
-                                                            .setAddressModeV(vk::SamplerAddressMode::eClampToEdge)
-                                                            .setAddressModeW(vk::SamplerAddressMode::eClampToEdge)
-                                                            .setMagFilter(vk::Filter::eLinear)
-                                                            .setMinFilter(vk::Filter::eLinear)
-                                                            .setPNext(&samplerReductionMode))
-                                           .second;
-
-                        auto& hzbTexture = scheduler.GetTexture(hzbPassDatas[mipLevel].HZBTexture);
-
-                        const glm::uvec2 dimensions =
-                            glm::max(glm::vec2(hzbTexture->GetDescription().Dimensions.x, hzbTexture->GetDescription().Dimensions.y) *
-                                         (f32)glm::pow(0.5f, mipLevel),
-                                     glm::vec2(1.0f));
-
-                        if (mipLevel == 0)
-                        {
-                            auto& depthTexture = scheduler.GetTexture(hzbPassDatas[mipLevel].DepthTexture);
-                            pc.SrcTextureID    = depthTexture->GetBindlessSampledImageID();
-                            pc.SrcTextureSizeRcp =
-                                1.0f / glm::vec2(depthTexture->GetDescription().Dimensions.x, depthTexture->GetDescription().Dimensions.y);
-                        }
-                        else
-                        {
-                            pc.SrcTextureID      = hzbTexture->GetBindlessSampledImageID(mipLevel - 1);
-                            pc.SrcTextureSizeRcp = 1.0f / (glm::vec2&)(2u * dimensions);
-                        }
-
-                        pc.DstTextureID = hzbTexture->GetBindlessRWImageID(mipLevel);
+                        const u32 meshletCount = geometries[instances[instanceIndex].GeometryID].MeshletCount;
+                        if (meshletCount == 0) continue;
+
+                        pc.InstanceIndex    = instanceIndex;
+                        pc.MeshletBitOffset = m_MeshletBitOffsets[instanceIndex];
                         cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                              vk::ShaderStageFlagBits::eAll, 0, pc);
-                        cmd.dispatch(glm::ceil(dimensions.x / (f32)HZB_WG_SIZE), glm::ceil(dimensions.y / (f32)HZB_WG_SIZE), 1);
-                    });
-            }
-#endif
+                        cmd.dispatch((meshletCount + MESHLET_WG_SIZE - 1) / MESHLET_WG_SIZE, 1, 1);
+                    }
+
+                    cmd.pipelineBarrier2(vk::DependencyInfo().setMemoryBarriers(
+                        vk::MemoryBarrier2()
+                            .setSrcStageMask(vk::PipelineStageFlagBits2::eComputeShader)
+                            .setSrcAccessMask(vk::AccessFlagBits2::eShaderWrite)
+                            .setDstStageMask(drawStageMask)
+                            .setDstAccessMask(vk::AccessFlagBits2::eShaderRead)));
+                });
+
+            MainPassData lateMainPassData = {};
+            RGResourceID meshletLateDrawBufferID{};
+            m_RenderGraph->AddPass(
+                "LateMainPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
+                [&](RenderGraphResourceScheduler& scheduler)
+                {
+                    scheduler.WriteRenderTarget(ResourceNames::GBufferAlbedo, MipSet::FirstMip(), vk::AttachmentLoadOp::eLoad,
+                                                vk::AttachmentStoreOp::eStore, {}, 0, ResourceNames::GBufferAlbedoLate);
+                    scheduler.WriteDepthStencil(ResourceNames::DepthBuffer, MipSet::FirstMip(), vk::AttachmentLoadOp::eLoad,
+                                                vk::AttachmentStoreOp::eStore, {}, vk::AttachmentLoadOp::eNoneKHR,
+                                                vk::AttachmentStoreOp::eNone, 0, ResourceNames::DepthBufferLate);
+
+                    lateMainPassData.CameraBuffer =
+                        scheduler.ReadBuffer(ResourceNames::CameraBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+                    lateMainPassData.CullingDataBuffer = scheduler.ReadBuffer(
+                        ResourceNames::CullingDataBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+                    meshletLateDrawBufferID = scheduler.ReadBuffer(ResourceNames::MeshletLateDrawBuffer,
+                                                                   EResourceStateBits::RESOURCE_STATE_STORAGE_BUFFER_BIT |
+                                                                       EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+
+                    scheduler.SetViewportScissors(vk::Viewport()
+                                                      .setMinDepth(0.0f)
+                                                      .setMaxDepth(1.0f)
+                                                      .setWidth(m_ViewportExtent.width)
+                                                      .setHeight(m_ViewportExtent.height),
+                                                  vk::Rect2D().setExtent(m_ViewportExtent));
+                },
+                [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
+                {
+                    DrawMeshletsFunc(cmd, scheduler.GetBuffer(lateMainPassData.CameraBuffer),
+                                     scheduler.GetBuffer(lateMainPassData.CullingDataBuffer), scheduler.GetBuffer(meshletLateDrawBufferID),
+                                     true);
+                });
 
-            m_UIRenderer->RenderFrame(m_ViewportExtent, m_RenderGraph, ResourceNames::GBufferAlbedo,
+            m_UIRenderer->RenderFrame(m_ViewportExtent, m_RenderGraph, ResourceNames::GBufferAlbedoLate,
                                       [&]()
                                       {
                                           if (ImGui::Begin("Application Info"))
@@ -235,6 +398,8 @@ namespace Radiant
                                               ImGui::Separator();
                                               ImGui::Text("Renderer: %s", m_GfxContext->GetDevice()->GetGPUProperties().deviceName);
                                               ImGui::Separator();
+
+                                              ImGui::Checkbox("Meshlet Occlusion Culling", &s_bEnableOcclusionCulling);
                                           }
                                           ImGui::End();
                                       });
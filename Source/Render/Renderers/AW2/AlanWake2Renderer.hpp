@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Render/Renderers/Renderer.hpp>
+#include "AlanWake2Mesh.hpp"
 
 namespace Radiant
 {
@@ -17,8 +18,14 @@ namespace Radiant
             void RenderFrame() noexcept final override;
 
           private:
-            Unique<GfxPipeline> m_MSTriPipeline{nullptr};
-            Unique<GfxPipeline> m_HZBPipeline{nullptr};
+            Unique<GfxPipeline> m_MeshletPipeline{nullptr};
+            Unique<GfxPipeline> m_MeshletOcclusionCullingPipeline{nullptr};
+            Unique<Mesh> m_Mesh{nullptr};
+
+            // NOTE: Bit per meshlet of every instance, persists across frames, so it lives outside of render graph.
+            Unique<GfxBuffer> m_MeshletVisibilityBuffer{nullptr};
+            std::vector<u32> m_MeshletBitOffsets;  // Per instance, 32 aligned.
+            u32 m_MeshletBitWordCount{0};
         };
 
     }  // namespace AW2
@@ -17,6 +17,7 @@ namespace Radiant
 
         const std::string LightBuffer{"Resource_Light_Buffer"};
         const std::string CameraBuffer{"Resource_Camera_Buffer"};
+        const std::string ObjectInstanceBuffer{"Resource_Object_Instance_Buffer"};
         const std::string MainPassShaderDataBuffer{"Resource_MainPassShaderDataBuffer"};
 
         const std::string GBufferDepth{"Resource_DepthBuffer"};
@@ -34,12 +35,62 @@ namespace Radiant
         const std::string LightClusterListBuffer{
             "Resource_Light_Cluster_List_Buffer"};  // Light cluster list filled with light indices after cluster assignment stage
 
+        const std::string GPUDrivenCullDataBuffer{"Resource_GPUDriven_Cull_Data_Buffer"};
+        const std::string GPUDrivenDrawCommandsBuffer{"Resource_GPUDriven_Draw_Commands_Buffer"};
+        const std::string GPUDrivenDrawCountBuffer{"Resource_GPUDriven_Draw_Count_Buffer"};
+
     }  // namespace ResourceNames
 
     static bool s_bAsyncComputeSSAO{false};
     static bool s_bEnableSSAO{true};
     static bool s_bSSAOComputeBased{true};
+
+    static const std::string s_SSAOComputePassName{"SSAOPassCompute"};
+    // NOTE: Workgroup sizes kernel autotuner picks from, the first one matches shader defaults, none can exceed them.
+    static const auto s_SSAOKernelVariants = []() noexcept
+    {
+        std::vector<GfxKernelVariant> variants{};
+        for (const auto& workGroupSize : {glm::uvec2(16, 16), glm::uvec2(8, 8), glm::uvec2(16, 8), glm::uvec2(8, 16)})
+        {
+            variants.emplace_back(std::format("{}x{}", workGroupSize.x, workGroupSize.y),
+                                  GfxSpecializationConstants{{SSAO_WG_SIZE_X_CONSTANT_ID, workGroupSize.x},
+                                                             {SSAO_WG_SIZE_Y_CONSTANT_ID, workGroupSize.y}});
+        }
+        return variants;
+    }();
     static bool s_bBloomComputeBased{false};
+    // NOTE: Timed on the first(largest) mip, the rest of the chain goes with the same variant. Tuning waits for compute bloom to be on.
+    static const std::string s_BloomDownsampleComputePassName{"BloomDownsample0"};
+    static const auto s_BloomDownsampleKernelVariants = []() noexcept
+    {
+        std::vector<GfxKernelVariant> variants{};
+        for (const auto& workGroupSize : {glm::uvec2(16, 16), glm::uvec2(8, 8), glm::uvec2(16, 8), glm::uvec2(8, 16)})
+        {
+            variants.emplace_back(std::format("{}x{}", workGroupSize.x, workGroupSize.y),
+                                  GfxSpecializationConstants{{BLOOM_DOWNSAMPLE_WG_SIZE_X_CONSTANT_ID, workGroupSize.x},
+                                                             {BLOOM_DOWNSAMPLE_WG_SIZE_Y_CONSTANT_ID, workGroupSize.y}});
+        }
+        return variants;
+    }();
+
+    static const std::string s_LightClustersAssignmentPassName{"LightClustersAssignmentPass"};
+    // NOTE: Light cluster count is a power of two, so every variant covers it with whole workgroups. Active cluster detection returns
+    // whole waves early, which is fine for barriers only as long as workgroup fits in a single wave.
+    static const auto s_LightClustersAssignmentKernelVariants = []() noexcept
+    {
+        std::vector<GfxKernelVariant> variants{};
+#if LIGHT_CLUSTERS_DETECT_ACTIVE
+        for (const u32 workGroupSize : {32u, 16u})
+#else
+        for (const u32 workGroupSize : {32u, 16u, 64u, 128u})
+#endif
+        {
+            variants.emplace_back(std::to_string(workGroupSize),
+                                  GfxSpecializationConstants{{LIGHT_CLUSTERS_ASSIGNMENT_WG_SIZE_CONSTANT_ID, workGroupSize}});
+        }
+        return variants;
+    }();
+    static_assert(LIGHT_CLUSTERS_COUNT % 128 == 0, "Light cluster assignment variants don't cover clusters with whole workgroups!");
     static bool s_bUpdateLights{true};
     static glm::vec3 s_SunColor{1.0f};
 
@@ -56,9 +107,28 @@ namespace Radiant
 
     static u64 s_DrawCallCount{0};
 
+    static bool s_bEnableMeshLODs{true};
+    static f32 s_LODErrorThresholdPixels{1.0f};  // Max on-screen deviation LOD is allowed to have.
+    static i32 s_ShadowLODBias{1};               // Shadow casters are drawn coarser than main view.
+
+    static bool s_bGPUDrivenRendering{true};  // Culling, LOD selection and draw submission happen on GPU.
+
+    static bool s_bEnableBVHCulling{true};
+    static f64 s_MainViewCullTimeMs{0.0};
+    static f64 s_MainViewSortTimeMs{0.0};
+    static std::array<f64, SHADOW_MAP_CASCADE_COUNT> s_CascadeCullTimesMs{};
+
     static constexpr glm::vec3 s_MinPointLightPos{-15, -4, -5};
     static constexpr glm::vec3 s_MaxPointLightPos{15, 14, 5};
 
+    static void DrawGPUDrivenBucket(const vk::CommandBuffer& cmd, const Unique<GfxBuffer>& drawCommandsBuffer,
+                                    const Unique<GfxBuffer>& drawCountBuffer, const u32 drawBucket, const u32 maxDrawCount) noexcept
+    {
+        cmd.drawIndexedIndirectCount(*drawCommandsBuffer, drawBucket * maxDrawCount * sizeof(Shaders::DrawIndexedIndirectCommand),
+                                     *drawCountBuffer, drawBucket * sizeof(u32), maxDrawCount,
+                                     sizeof(Shaders::DrawIndexedIndirectCommand));
+    }
+
     CombinedRenderer::CombinedRenderer() noexcept
     {
         m_MainCamera = MakeShared<Camera>(70.0f, static_cast<f32>(m_ViewportExtent.width) / static_cast<f32>(m_ViewportExtent.height),
@@ -95,13 +165,21 @@ namespace Radiant
         thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
             [&]() noexcept
             {
-                const GfxPipelineDescription pipelineDesc = {
-                    .DebugName       = "LightClustersAssignment",
-                    .PipelineOptions = GfxComputePipelineOptions{},
-                    .Shader          = MakeShared<GfxShader>(
-                        m_GfxContext->GetDevice(),
-                        GfxShaderDescription{.Path = "../Assets/Shaders/clustered_shading/light_clusters_assignment.slang"})};
-                m_LightClustersAssignmentPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                const auto lightClustersAssignmentShader = MakeShared<GfxShader>(
+                    m_GfxContext->GetDevice(),
+                    GfxShaderDescription{.Path = "../Assets/Shaders/clustered_shading/light_clusters_assignment.slang"});
+
+                m_LightClustersAssignmentPipelines.resize(s_LightClustersAssignmentKernelVariants.size());
+                for (const auto variantIndex : m_GfxContext->GetKernelAutotuner()->RegisterKernel(s_LightClustersAssignmentPassName,
+                                                                                                  s_LightClustersAssignmentKernelVariants))
+                {
+                    const auto& variant                       = s_LightClustersAssignmentKernelVariants[variantIndex];
+                    const GfxPipelineDescription pipelineDesc = {
+                        .DebugName       = "LightClustersAssignment[" + variant.Name + "]",
+                        .PipelineOptions = GfxComputePipelineOptions{.SpecializationConstants = variant.SpecializationConstants},
+                        .Shader          = lightClustersAssignmentShader};
+                    m_LightClustersAssignmentPipelines[variantIndex] = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                }
             }));
 
         thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
@@ -188,104 +266,83 @@ namespace Radiant
                 m_MainLightingPassPipeline                = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
             }));
 
+        // GPU-driven pipelines, same states as CPU ones, but shaders fetch per instance data themselves.
         thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
             [&]() noexcept
             {
-                {
-                    const GfxPipelineDescription pipelineDesc = {
-                        .DebugName       = "BrdfLutGen",
-                        .PipelineOptions = GfxGraphicsPipelineOptions{.RenderingFormats{vk::Format::eR16G16Unorm},
-                                                                      //  .CullMode{vk::CullModeFlagBits::eBack},
-                                                                      .FrontFace{vk::FrontFace::eCounterClockwise},
-                                                                      .PrimitiveTopology{vk::PrimitiveTopology::eTriangleList},
-                                                                      .PolygonMode{vk::PolygonMode::eFill}},
-                        .Shader =
-                            MakeShared<GfxShader>(m_GfxContext->GetDevice(),
-                                                  GfxShaderDescription{.Path = "../Assets/Shaders/ibl_utils/generate_brdf_lut.slang"})};
-                    auto brdfLutGenPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
-
-                    auto executionContext = m_GfxContext->CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
-                    executionContext.CommandBuffer.begin(
-                        vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
-
-#if RDNT_DEBUG
-                    executionContext.CommandBuffer.beginDebugUtilsLabelEXT(
-                        vk::DebugUtilsLabelEXT().setPLabelName("BRDFLutGen").setColor({1.0f, 1.0f, 1.0f, 1.0f}));
-#endif
+                const GfxPipelineDescription pipelineDesc = {
+                    .DebugName       = "BuildDrawCommands",
+                    .PipelineOptions = GfxComputePipelineOptions{},
+                    .Shader          = MakeShared<GfxShader>(
+                        m_GfxContext->GetDevice(), GfxShaderDescription{.Path = "../Assets/Shaders/gpu_driven/build_draw_commands.slang"})};
+                m_BuildDrawCommandsPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+            }));
 
-                    constexpr glm::uvec2 brdfLutDimensions{512, 512};
-                    m_BrdfLutTexture = MakeUnique<GfxTexture>(
-                        m_GfxContext->GetDevice(),
-                        GfxTextureDescription(
-                            vk::ImageType::e2D, glm::uvec3(brdfLutDimensions.x, brdfLutDimensions.y, 1),
-                            /* Idk which format is better Sfloat or Unorm, but I think Unorm fits well since its range is [0, 1]*/
-                            vk::Format::eR16G16Unorm, vk::ImageUsageFlagBits::eColorAttachment,
-                            vk::SamplerCreateInfo()
-                                .setAddressModeU(vk::SamplerAddressMode::eClampToEdge)
-                                .setAddressModeV(vk::SamplerAddressMode::eClampToEdge)
-                                .setAddressModeW(vk::SamplerAddressMode::eClampToEdge)
-                                .setMagFilter(vk::Filter::eLinear)
-                                .setMinFilter(vk::Filter::eLinear)
-                                .setBorderColor(vk::BorderColor::eFloatOpaqueWhite)));
-                    m_GfxContext->GetDevice()->SetDebugName("BRDF_LUT", (const vk::Image&)*m_BrdfLutTexture);
-
-                    executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
-                        vk::ImageMemoryBarrier2()
-                            .setImage(*m_BrdfLutTexture)
-                            .setSubresourceRange(vk::ImageSubresourceRange()
-                                                     .setBaseArrayLayer(0)
-                                                     .setLayerCount(1)
-                                                     .setBaseMipLevel(0)
-                                                     .setLevelCount(1)
-                                                     .setAspectMask(vk::ImageAspectFlagBits::eColor))
-                            .setOldLayout(vk::ImageLayout::eUndefined)
-                            .setNewLayout(vk::ImageLayout::eColorAttachmentOptimal)
-                            .setSrcAccessMask(vk::AccessFlagBits2::eNone)
-                            .setSrcStageMask(vk::PipelineStageFlagBits2::eNone)
-                            .setDstAccessMask(vk::AccessFlagBits2::eColorAttachmentWrite)
-                            .setDstStageMask(vk::PipelineStageFlagBits2::eColorAttachmentOutput)));
-
-                    executionContext.CommandBuffer.beginRendering(
-                        vk::RenderingInfo()
-                            .setLayerCount(1)
-                            .setColorAttachments((vk::RenderingAttachmentInfo&)m_BrdfLutTexture->GetRenderingAttachmentInfo(
-                                vk::ImageLayout::eColorAttachmentOptimal,
-                                vk::ClearValue().setColor(vk::ClearColorValue().setFloat32({0.0f, 0.0f, 0.0f, 1.0f})),
-                                vk::AttachmentLoadOp::eClear, vk::AttachmentStoreOp::eStore))
-                            .setRenderArea(
-                                vk::Rect2D().setExtent(vk::Extent2D().setWidth(brdfLutDimensions.x).setHeight(brdfLutDimensions.y))));
-
-                    executionContext.CommandBuffer.setViewportWithCount(
-                        vk::Viewport().setMinDepth(0.0f).setMaxDepth(1.0f).setWidth(brdfLutDimensions.x).setHeight(brdfLutDimensions.y));
-                    executionContext.CommandBuffer.setScissorWithCount(
-                        vk::Rect2D().setExtent(vk::Extent2D().setWidth(brdfLutDimensions.x).setHeight(brdfLutDimensions.y)));
-                    executionContext.CommandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *brdfLutGenPipeline);
-
-                    executionContext.CommandBuffer.draw(3, 1, 0, 0);
-
-                    executionContext.CommandBuffer.endRendering();
-                    executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
-                        vk::ImageMemoryBarrier2()
-                            .setImage(*m_BrdfLutTexture)
-                            .setSubresourceRange(vk::ImageSubresourceRange()
-                                                     .setBaseArrayLayer(0)
-                                                     .setLayerCount(1)
-                                                     .setBaseMipLevel(0)
-                                                     .setLevelCount(1)
-                                                     .setAspectMask(vk::ImageAspectFlagBits::eColor))
-                            .setOldLayout(vk::ImageLayout::eColorAttachmentOptimal)
-                            .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
-                            .setSrcAccessMask(vk::AccessFlagBits2::eColorAttachmentWrite)
-                            .setSrcStageMask(vk::PipelineStageFlagBits2::eColorAttachmentOutput)
-                            .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
-                            .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader)));
-
-#if RDNT_DEBUG
-                    executionContext.CommandBuffer.endDebugUtilsLabelEXT();
-#endif
-                    executionContext.CommandBuffer.end();
-                    m_GfxContext->SubmitImmediateExecuteContext(executionContext);
-                }
+        thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
+            [&]() noexcept
+            {
+                auto depthPrePassShader =
+                    MakeShared<GfxShader>(m_GfxContext->GetDevice(),
+                                          GfxShaderDescription{.Path = "../Assets/Shaders/gpu_driven/depth_pre_pass_gpu_driven.slang"});
+                const GfxGraphicsPipelineOptions gpo = {
+                    .RenderingFormats{vk::Format::eD32Sfloat},
+                    .DynamicStates{vk::DynamicState::eCullMode, vk::DynamicState::ePrimitiveTopology},
+                    .FrontFace{vk::FrontFace::eCounterClockwise},
+                    .PolygonMode{vk::PolygonMode::eFill},
+                    .bDepthTest{true},
+                    .bDepthWrite{true},
+                    .DepthCompareOp{vk::CompareOp::eGreaterOrEqual},
+                };
+                const GfxPipelineDescription pipelineDesc = {
+                    .DebugName = "depth_pre_pass_gpu_driven", .PipelineOptions = gpo, .Shader = depthPrePassShader};
+                m_DepthPrePassGPUDrivenPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+            }));
+
+        thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
+            [&]() noexcept
+            {
+                const GfxPipelineDescription pipelineDesc = {
+                    .DebugName       = "CSMPassGPUDriven",
+                    .PipelineOptions = GfxGraphicsPipelineOptions{.RenderingFormats{vk::Format::eD32Sfloat},
+                                                                  .DynamicStates{vk::DynamicState::ePrimitiveTopology},
+                                                                  .CullMode{vk::CullModeFlagBits::eFront},
+                                                                  .FrontFace{vk::FrontFace::eCounterClockwise},
+                                                                  .PolygonMode{vk::PolygonMode::eFill},
+                                                                  .bDepthClamp{true},
+                                                                  .bDepthTest{true},
+                                                                  .bDepthWrite{true},
+                                                                  .DepthCompareOp{vk::CompareOp::eGreaterOrEqual}},
+                    .Shader          = MakeShared<GfxShader>(
+                        m_GfxContext->GetDevice(), GfxShaderDescription{.Path = "../Assets/Shaders/gpu_driven/csm_pass_gpu_driven.slang"})};
+                m_CSMGPUDrivenPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+            }));
+
+        thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
+            [&]() noexcept
+            {
+                auto pbrShader = MakeShared<GfxShader>(
+                    m_GfxContext->GetDevice(),
+                    GfxShaderDescription{.Path = "../Assets/Shaders/gpu_driven/main_pass_bc_compressed_gpu_driven.slang"});
+                const GfxGraphicsPipelineOptions gpo = {
+                    .RenderingFormats{vk::Format::eR16G16B16A16Sfloat, vk::Format::eD32Sfloat},
+                    .DynamicStates{vk::DynamicState::eCullMode, vk::DynamicState::ePrimitiveTopology, vk::DynamicState::eDepthCompareOp},
+                    .CullMode{vk::CullModeFlagBits::eBack},
+                    .FrontFace{vk::FrontFace::eCounterClockwise},
+                    .PrimitiveTopology{vk::PrimitiveTopology::eTriangleList},
+                    .PolygonMode{vk::PolygonMode::eFill},
+                    .bDepthTest{true},
+                    .bDepthWrite{false},
+                    .DepthCompareOp{vk::CompareOp::eEqual},
+                    .BlendModes{GfxGraphicsPipelineOptions::EBlendMode::BLEND_MODE_ALPHA}};
+                const GfxPipelineDescription pipelineDesc = {
+                    .DebugName = "MainPassPBRGPUDriven", .PipelineOptions = gpo, .Shader = pbrShader};
+                m_MainLightingPassGPUDrivenPipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+            }));
+
+        thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
+            [&]() noexcept
+            {
+                m_BrdfLutTexture = GenerateBRDFLut();
                 {
                     auto [irradianceCubemap, prefilteredCubemap] = GenerateIBLMaps("../Assets/env_maps/the_sky_is_on_fire_4k.hdr");
                     m_IrradianceCubemapTexture                   = std::move(irradianceCubemap);
@@ -360,9 +417,17 @@ namespace Radiant
                 auto ssaoShader =
                     MakeShared<GfxShader>(m_GfxContext->GetDevice(), GfxShaderDescription{.Path = "../Assets/Shaders/ssao/ssao_cs.slang"});
 
-                const GfxPipelineDescription pipelineDesc = {
-                    .DebugName = "SSAO_Compute", .PipelineOptions = GfxComputePipelineOptions{}, .Shader = ssaoShader};
-                m_SSAOPipelineCompute = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                m_SSAOPipelinesCompute.resize(s_SSAOKernelVariants.size());
+                for (const auto variantIndex :
+                     m_GfxContext->GetKernelAutotuner()->RegisterKernel(s_SSAOComputePassName, s_SSAOKernelVariants))
+                {
+                    const auto& variant                       = s_SSAOKernelVariants[variantIndex];
+                    const GfxPipelineDescription pipelineDesc = {
+                        .DebugName       = "SSAO_Compute[" + variant.Name + "]",
+                        .PipelineOptions = GfxComputePipelineOptions{.SpecializationConstants = variant.SpecializationConstants},
+                        .Shader          = ssaoShader};
+                    m_SSAOPipelinesCompute[variantIndex] = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                }
             }));
 
         thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
@@ -428,12 +493,20 @@ namespace Radiant
         thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
             [&]() noexcept
             {
-                const GfxPipelineDescription pipelineDesc = {
-                    .DebugName       = "BloomDownsampleCompute",
-                    .PipelineOptions = GfxComputePipelineOptions{},
-                    .Shader          = MakeShared<GfxShader>(
-                        m_GfxContext->GetDevice(), GfxShaderDescription{.Path = "../Assets/Shaders/bloom/bloom_downsample_compute.slang"})};
-                m_BloomDownsamplePipelineCompute = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                const auto bloomDownsampleShader = MakeShared<GfxShader>(
+                    m_GfxContext->GetDevice(), GfxShaderDescription{.Path = "../Assets/Shaders/bloom/bloom_downsample_compute.slang"});
+
+                m_BloomDownsamplePipelinesCompute.resize(s_BloomDownsampleKernelVariants.size());
+                for (const auto variantIndex :
+                     m_GfxContext->GetKernelAutotuner()->RegisterKernel(s_BloomDownsampleComputePassName, s_BloomDownsampleKernelVariants))
+                {
+                    const auto& variant                       = s_BloomDownsampleKernelVariants[variantIndex];
+                    const GfxPipelineDescription pipelineDesc = {
+                        .DebugName       = "BloomDownsampleCompute[" + variant.Name + "]",
+                        .PipelineOptions = GfxComputePipelineOptions{.SpecializationConstants = variant.SpecializationConstants},
+                        .Shader          = bloomDownsampleShader};
+                    m_BloomDownsamplePipelinesCompute[variantIndex] = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                }
             }));
 
         thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
@@ -468,6 +541,12 @@ namespace Radiant
 
                 m_Scene->LoadMesh(m_GfxContext, "../Assets/Models/sponza/scene.gltf");
                 m_Scene->IterateObjects(m_DrawContext);
+                UpdateObjectInstances(s_MeshScale, s_MeshTranslation, s_MeshRotation);
+                BuildGPUInstances();
+
+                UpdateObjectWorldBounds();
+                m_SceneBVH.Build(m_ObjectWorldBounds);
+                BuildDrawSortStateKeys();
             }));
 
         const auto rendererPrepareBeginTime = Timer::Now();
@@ -480,61 +559,150 @@ namespace Radiant
 
     void CombinedRenderer::RenderFrame() noexcept
     {
-        auto& mainWindow = Application::Get().GetMainWindow();
-
         s_DrawCallCount = 0;
 
-        static bool bHotReloadQueued{false};
-        if (bHotReloadQueued && mainWindow->IsKeyReleased(GLFW_KEY_V))  // Check state frame before and current
+        // NOTE: Instance buffer and BVH are persistent, the only thing that moves instances is global mesh transform tweaked through
+        // ImGui, so rebuilding instances after device wait and refitting BVH is fine.
         {
-            // m_LightClustersBuildPipeline->HotReload();
-            // m_LightClustersDetectActivePipeline->HotReload();
-            // m_LightClustersAssignmentPipeline->HotReload();
-
-            // m_DepthPrePassPipeline->HotReload();
-            m_MainLightingPassPipeline->HotReload();
-            m_FinalPassPipeline->HotReload();
+            static auto s_GPUInstancesMeshTransform = std::make_tuple(s_MeshScale, s_MeshTranslation, s_MeshRotation);
+            const auto meshTransform                = std::make_tuple(s_MeshScale, s_MeshTranslation, s_MeshRotation);
+            if (meshTransform != s_GPUInstancesMeshTransform)
+            {
+                m_GfxContext->GetDevice()->WaitIdle();
+                UpdateObjectInstances(s_MeshScale, s_MeshTranslation, s_MeshRotation);
+                BuildGPUInstances();
+                s_GPUInstancesMeshTransform = meshTransform;
 
-            // m_DepthBoundsComputePipeline->HotReload();
-            // m_ShadowsSetupPipeline->HotReload();
-            // m_CSMPipeline->HotReload();
+                UpdateObjectWorldBounds();
+                m_SceneBVH.Refit(m_ObjectWorldBounds);
+            }
+        }
+        const bool bGPUDriven = s_bGPUDrivenRendering && !m_GPUInstances.empty();
+        // NOTE: GPU-driven path leaves points, lines and blended surfaces(they need back to front order) to CPU path.
+        const bool bCPUDraws = !bGPUDriven || m_CPUDrawnObjectCount > 0;
+
+        // NOTE: Render objects are never reordered, so BVH built over them stays valid, views get lists of indices instead.
+        // CSM cascades are only known on CPU when they're set up on CPU, otherwise every object is drawn into every cascade.
+        std::optional<Shaders::CascadedShadowMapsData> cpuCSMData{std::nullopt};
+        if (!s_bComputeTightBounds)
+        {
+            cpuCSMData = UpdateCSMData(glm::radians(m_MainCamera->GetZoom()), m_MainCamera->GetAspectRatio(), s_CascadeMinDistance,
+                                       s_CascadeMaxDistance, m_MainCamera->GetViewMatrix(), glm::normalize(m_LightData->Sun.Direction));
+        }
 
-            // m_SSSPipeline->HotReload();
+        if (bCPUDraws)
+        {
+            const auto objectCount = static_cast<u32>(m_DrawContext.RenderObjects.size());
+            m_MainViewVisibleObjects.clear();
+            for (auto& cascadeVisibleObjects : m_CascadeVisibleObjects)
+                cascadeVisibleObjects.clear();
 
-            m_SSAOPipelineGraphics->HotReload();
-            m_SSAOPipelineCompute->HotReload();
-            m_SSAOBoxBlurPipelineGraphics->HotReload();
-            m_SSAOBoxBlurPipelineCompute->HotReload();
+            Timer cullTimer = {};
+            if (s_bEnableBVHCulling)
+            {
+                m_SceneBVH.Cull(Math::ExtractFrustumPlanes(m_MainCamera->GetViewProjectionMatrix()), m_MainViewVisibleObjects);
+            }
+            else
+            {
+                m_MainViewVisibleObjects.resize(objectCount);
+                std::iota(m_MainViewVisibleObjects.begin(), m_MainViewVisibleObjects.end(), 0);
+            }
+            s_MainViewCullTimeMs = cullTimer.GetElapsedMilliseconds();
 
-            // m_BloomDownsamplePipelineGraphics->HotReload();
-            // m_BloomUpsampleBlurPipelineGraphics->HotReload();
-            // m_BloomDownsamplePipelineCompute->HotReload();
-            // m_BloomUpsampleBlurPipelineCompute->HotReload();
+            for (u32 cascadeIndex{}; cascadeIndex < SHADOW_MAP_CASCADE_COUNT; ++cascadeIndex)
+            {
+                cullTimer.Reset();
+                auto& cascadeVisibleObjects = m_CascadeVisibleObjects[cascadeIndex];
+                if (s_bEnableBVHCulling && cpuCSMData.has_value())
+                {
+                    // NOTE: Depth clamp flattens casters in front of cascade onto its near plane, so only side planes cull.
+                    const auto cascadePlanes = Math::ExtractFrustumPlanes(cpuCSMData->ViewProjectionMatrix[cascadeIndex]);
+                    m_SceneBVH.Cull(std::span<const glm::vec4>(cascadePlanes).first(4), cascadeVisibleObjects);
+                }
+                else
+                {
+                    cascadeVisibleObjects.resize(objectCount);
+                    std::iota(cascadeVisibleObjects.begin(), cascadeVisibleObjects.end(), 0);
+                }
+                s_CascadeCullTimesMs[cascadeIndex] = cullTimer.GetElapsedMilliseconds();
+            }
 
-            // m_EnvMapSkyboxPipeline->HotReload();
-        }
-        bHotReloadQueued = mainWindow->IsKeyPressed(GLFW_KEY_V);
+            if (bGPUDriven)
+            {
+                const auto IsGPUDrivenObjectFunc = [&](const u32 objectIndex) { return m_ObjectGPUDrivenFlags[objectIndex] != 0; };
+                std::erase_if(m_MainViewVisibleObjects, IsGPUDrivenObjectFunc);
+                for (auto& cascadeVisibleObjects : m_CascadeVisibleObjects)
+                    std::erase_if(cascadeVisibleObjects, IsGPUDrivenObjectFunc);
+            }
 
-        // Sort transparent objects back to front.
-        std::sort(std::execution::par, m_DrawContext.RenderObjects.begin(), m_DrawContext.RenderObjects.end(),
-                  [&](const RenderObject& lhs, const RenderObject& rhs)
-                  {
-                      if (lhs.AlphaMode == rhs.AlphaMode && lhs.AlphaMode != EAlphaMode::ALPHA_MODE_OPAQUE)
-                      {
-                          const f32 lhsDistToCam = glm::length(m_MainCamera->GetPosition() - glm::vec3(lhs.TRS[3]));
-                          const f32 rhsDistToCam = glm::length(m_MainCamera->GetPosition() - glm::vec3(rhs.TRS[3]));
-                          return lhsDistToCam > rhsDistToCam;
-                      }
+            m_ObjectCascadeMasks.assign(objectCount, 0);
+            for (u32 cascadeIndex{}; cascadeIndex < SHADOW_MAP_CASCADE_COUNT; ++cascadeIndex)
+            {
+                for (const u32 objectIndex : m_CascadeVisibleObjects[cascadeIndex])
+                    m_ObjectCascadeMasks[objectIndex] |= 1u << cascadeIndex;
+            }
 
-                      if (lhs.AlphaMode == rhs.AlphaMode) return lhs.IndexBuffer < rhs.IndexBuffer;
+            // NOTE: Opaque and masked objects are grouped by state and go front to back inside it, blended ones go back to front.
+            Timer sortTimer            = {};
+            const auto& cameraPosition = m_MainCamera->GetPosition();
+            m_MainViewSortItems.resize(m_MainViewVisibleObjects.size());
+            std::transform(std::execution::par, m_MainViewVisibleObjects.cbegin(), m_MainViewVisibleObjects.cend(),
+                           m_MainViewSortItems.begin(),
+                           [&](const u32 objectIndex)
+                           {
+                               const auto& ro  = m_DrawContext.RenderObjects[objectIndex];
+                               const f32 depth = glm::distance(cameraPosition, m_ObjectWorldBounds[objectIndex].Origin);
+                               const u64 key   = MakeDrawSortKey(ro.AlphaMode, m_DrawSortStateKeys[objectIndex], depth);
+                               return CoreUtils::RadixSortItem{.Key = key, .Value = objectIndex};
+                           });
+            CoreUtils::RadixSort(m_MainViewSortItems, m_MainViewSortScratchItems);
+
+            for (u32 i{}; i < m_MainViewSortItems.size(); ++i)
+                m_MainViewVisibleObjects[i] = m_MainViewSortItems[i].Value;
+            s_MainViewSortTimeMs = sortTimer.GetElapsedMilliseconds();
+        }
 
-                      return lhs.AlphaMode < rhs.AlphaMode;
-                  });
+        // NOTE: LOD is picked once per frame out of main view, so depth prepass and main pass(equal depth test) stay in sync, shadow
+        // passes reuse it with bias. Picked LOD is the coarsest one whose object space error projects under the pixel threshold.
+        if (bCPUDraws)
+        {
+            const glm::mat4 meshRotation = glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
+                                           glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
+                                           glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+            const f32 projectionScale  = m_MainCamera->GetProjectionMatrix()[1][1] * 0.5f * static_cast<f32>(m_ViewportExtent.height);
+            const auto& cameraPosition = m_MainCamera->GetPosition();
+            std::for_each(std::execution::par, m_DrawContext.RenderObjects.begin(), m_DrawContext.RenderObjects.end(),
+                          [&](RenderObject& ro)
+                          {
+                              ro.LODIndex = 0;
+                              if (!s_bEnableMeshLODs) return;
+                              if (bGPUDriven && m_ObjectGPUDrivenFlags[&ro - m_DrawContext.RenderObjects.data()] != 0) return;
+
+                              const glm::mat4 modelMatrix = ro.TRS * meshRotation;
+                              const glm::vec3 axisScale{glm::length(glm::vec3(modelMatrix[0])), glm::length(glm::vec3(modelMatrix[1])),
+                                                        glm::length(glm::vec3(modelMatrix[2]))};
+                              const f32 maxScale = glm::max(glm::max(axisScale.x, axisScale.y), axisScale.z) * s_MeshScale;
+
+                              const glm::vec3 center =
+                                  glm::vec3(modelMatrix * glm::vec4(ro.Bounds.Origin * s_MeshScale, 1.0f)) + s_MeshTranslation;
+                              const f32 distance = glm::max(glm::distance(center, cameraPosition) - ro.Bounds.Radius * maxScale,
+                                                            Shaders::s_KINDA_SMALL_NUMBER);
+
+                              for (u32 lodIndex{1}; lodIndex < ro.LODs.size(); ++lodIndex)
+                              {
+                                  const f32 projectedError = ro.LODs[lodIndex].Error * maxScale / distance * projectionScale;
+                                  if (projectedError > s_LODErrorThresholdPixels) break;
+
+                                  ro.LODIndex = lodIndex;
+                              }
+                          });
+        }
 
         struct FramePreparePassData
         {
             RGResourceID CameraBuffer;
             RGResourceID LightBuffer;
+            RGResourceID ObjectInstanceBuffer;
         } fpPassData = {};
         m_RenderGraph->AddPass(
             "FramePreparePass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
@@ -553,6 +721,17 @@ namespace Radiant
                                                             EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
                 fpPassData.LightBuffer =
                     scheduler.WriteBuffer(ResourceNames::LightBuffer, EResourceStateBits::RESOURCE_STATE_UNIFORM_BUFFER_BIT);
+
+                if (bCPUDraws)
+                {
+                    const u64 objectCount = glm::max(m_DrawContext.RenderObjects.size(), static_cast<size_t>(1));
+                    scheduler.CreateBuffer(ResourceNames::ObjectInstanceBuffer,
+                                           GfxBufferDescription(objectCount * sizeof(ObjectInstanceData), sizeof(ObjectInstanceData),
+                                                                vk::BufferUsageFlagBits::eStorageBuffer,
+                                                                EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
+                    fpPassData.ObjectInstanceBuffer =
+                        scheduler.WriteBuffer(ResourceNames::ObjectInstanceBuffer, EResourceStateBits::RESOURCE_STATE_STORAGE_BUFFER_BIT);
+                }
             },
             [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
             {
@@ -571,11 +750,105 @@ namespace Radiant
 
                 auto& lightUBO = scheduler.GetBuffer(fpPassData.LightBuffer);
                 lightUBO->SetData(m_LightData.get(), sizeof(Shaders::LightData));
+
+                if (bCPUDraws) UploadObjectInstances(scheduler.GetBuffer(fpPassData.ObjectInstanceBuffer));
             });
 
+        // NOTE: Every instance gets a slot in every bucket, so compute never runs out of space and buckets don't need prefix sums.
+        const auto instanceCount = static_cast<u32>(m_GPUInstances.size());
+        struct BuildDrawCommandsPassData
+        {
+            RGResourceID CullDataBuffer;
+            RGResourceID DrawCommandsBuffer;
+            RGResourceID DrawCountBuffer;
+        } bdcPassData = {};
+        if (bGPUDriven)
+        {
+            m_RenderGraph->AddPass(
+                "BuildDrawCommandsPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
+                [&](RenderGraphResourceScheduler& scheduler)
+                {
+                    scheduler.CreateBuffer(ResourceNames::GPUDrivenCullDataBuffer,
+                                           GfxBufferDescription(sizeof(Shaders::GPUDrivenCullData), sizeof(Shaders::GPUDrivenCullData),
+                                                                vk::BufferUsageFlagBits::eUniformBuffer,
+                                                                EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
+                    bdcPassData.CullDataBuffer =
+                        scheduler.WriteBuffer(ResourceNames::GPUDrivenCullDataBuffer,
+                                              EResourceStateBits::RESOURCE_STATE_UNIFORM_BUFFER_BIT |
+                                                  EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+
+                    const u64 drawCommandsBufferSize =
+                        GPU_DRIVEN_TOTAL_DRAW_BUCKET_COUNT * instanceCount * sizeof(Shaders::DrawIndexedIndirectCommand);
+                    scheduler.CreateBuffer(ResourceNames::GPUDrivenDrawCommandsBuffer,
+                                           GfxBufferDescription(drawCommandsBufferSize, sizeof(Shaders::DrawIndexedIndirectCommand),
+                                                                vk::BufferUsageFlagBits::eStorageBuffer |
+                                                                    vk::BufferUsageFlagBits::eIndirectBuffer,
+                                                                EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+                    bdcPassData.DrawCommandsBuffer =
+                        scheduler.WriteBuffer(ResourceNames::GPUDrivenDrawCommandsBuffer,
+                                              EResourceStateBits::RESOURCE_STATE_STORAGE_BUFFER_BIT |
+                                                  EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+
+                    scheduler.CreateBuffer(ResourceNames::GPUDrivenDrawCountBuffer,
+                                           GfxBufferDescription(GPU_DRIVEN_TOTAL_DRAW_BUCKET_COUNT * sizeof(u32), sizeof(u32),
+                                                                vk::BufferUsageFlagBits::eStorageBuffer |
+                                                                    vk::BufferUsageFlagBits::eIndirectBuffer,
+                                                                EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT));
+                    bdcPassData.DrawCountBuffer =
+                        scheduler.WriteBuffer(ResourceNames::GPUDrivenDrawCountBuffer,
+                                              EResourceStateBits::RESOURCE_STATE_STORAGE_BUFFER_BIT |
+                                                  EResourceStateBits::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE_BIT);
+                    scheduler.ClearOnExecute(ResourceNames::GPUDrivenDrawCountBuffer, 0, GPU_DRIVEN_TOTAL_DRAW_BUCKET_COUNT * sizeof(u32));
+                },
+                [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
+                {
+                    auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
+                    pipelineStateCache.Bind(cmd, m_BuildDrawCommandsPipeline.get());
+
+                    Shaders::GPUDrivenCullData cullData = {};
+                    const auto frustumPlanes            = Math::ExtractFrustumPlanes(m_MainCamera->GetViewProjectionMatrix());
+                    for (u32 i{}; i < frustumPlanes.size(); ++i)
+                    {
+                        cullData.FrustumPlanes[i].Normal   = glm::vec3(frustumPlanes[i]);
+                        cullData.FrustumPlanes[i].Distance = frustumPlanes[i].w;
+                    }
+                    cullData.CameraPosition = m_MainCamera->GetPosition();
+                    cullData.ProjectionScale =
+                        m_MainCamera->GetProjectionMatrix()[1][1] * 0.5f * static_cast<f32>(m_ViewportExtent.height);
+                    cullData.LODErrorThreshold = s_LODErrorThresholdPixels;
+                    cullData.ShadowLODBias     = static_cast<u32>(s_ShadowLODBias);
+                    cullData.InstanceCount     = instanceCount;
+                    cullData.MaxDrawsPerBucket = instanceCount;
+                    cullData.bEnableLODs       = s_bEnableMeshLODs ? 1 : 0;
+
+                    auto& cullDataUBO = scheduler.GetBuffer(bdcPassData.CullDataBuffer);
+                    cullDataUBO->SetData(&cullData, sizeof(cullData));
+
+                    struct PushConstantBlock
+                    {
+                        const Shaders::GPUInstanceData* Instances{nullptr};
+                        const Shaders::GPUDrivenCullData* CullData{nullptr};
+                        Shaders::DrawIndexedIndirectCommand* DrawCommands{nullptr};
+                        u32* DrawCounts{nullptr};
+                    } pc = {};
+
+                    pc.Instances    = (const Shaders::GPUInstanceData*)m_GPUInstanceBuffer->GetBDA();
+                    pc.CullData     = (const Shaders::GPUDrivenCullData*)cullDataUBO->GetBDA();
+                    pc.DrawCommands = (Shaders::DrawIndexedIndirectCommand*)scheduler.GetBuffer(bdcPassData.DrawCommandsBuffer)->GetBDA();
+                    pc.DrawCounts   = (u32*)scheduler.GetBuffer(bdcPassData.DrawCountBuffer)->GetBDA();
+
+                    cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
+                                                         vk::ShaderStageFlagBits::eAll, 0, pc);
+                    cmd.dispatch(glm::ceil(instanceCount / (f32)GPU_DRIVEN_BUILD_DRAWS_WG_SIZE), 1, 1);
+                });
+        }
+
         struct DepthPrePassData
         {
             RGResourceID CameraBuffer;
+            RGResourceID ObjectInstanceBuffer;
+            RGResourceID DrawCommandsBuffer;
+            RGResourceID DrawCountBuffer;
         } depthPrePassData = {};
         m_RenderGraph->AddPass(
             "DepthPrePass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
@@ -598,6 +871,20 @@ namespace Radiant
                 depthPrePassData.CameraBuffer =
                     scheduler.ReadBuffer(ResourceNames::CameraBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
 
+                if (bGPUDriven)
+                {
+                    depthPrePassData.DrawCommandsBuffer = scheduler.ReadBuffer(ResourceNames::GPUDrivenDrawCommandsBuffer,
+                                                                               EResourceStateBits::RESOURCE_STATE_INDIRECT_ARGUMENT_BIT);
+                    depthPrePassData.DrawCountBuffer = scheduler.ReadBuffer(ResourceNames::GPUDrivenDrawCountBuffer,
+                                                                            EResourceStateBits::RESOURCE_STATE_INDIRECT_ARGUMENT_BIT);
+                }
+
+                if (bCPUDraws)
+                {
+                    depthPrePassData.ObjectInstanceBuffer = scheduler.ReadBuffer(
+                        ResourceNames::ObjectInstanceBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+                }
+
                 scheduler.SetViewportScissors(
                     vk::Viewport().setMinDepth(0.0f).setMaxDepth(1.0f).setWidth(m_ViewportExtent.width).setHeight(m_ViewportExtent.height),
                     vk::Rect2D().setExtent(m_ViewportExtent));
@@ -605,34 +892,54 @@ namespace Radiant
             [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
             {
                 auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
+                if (bGPUDriven)
+                {
+                    pipelineStateCache.Bind(cmd, m_DepthPrePassGPUDrivenPipeline.get());
+
+                    struct PushConstantBlock
+                    {
+                        const Shaders::GPUInstanceData* Instances{nullptr};
+                        glm::mat4 ViewProjectionMatrix{1.f};
+                        const DepthOnlyVertexPosition* VtxPositions{nullptr};
+                    } pc = {};
+
+                    pc.Instances            = (const Shaders::GPUInstanceData*)m_GPUInstanceBuffer->GetBDA();
+                    pc.ViewProjectionMatrix = m_MainCamera->GetViewProjectionMatrix();
+                    pc.VtxPositions         = (const DepthOnlyVertexPosition*)m_GPUDrivenDepthOnlyVertexPositionBuffer->GetBDA();
+
+                    cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
+                                                         vk::ShaderStageFlagBits::eAll, 0, pc);
+                    pipelineStateCache.Set(cmd, vk::PrimitiveTopology::eTriangleList);
+                    pipelineStateCache.Bind(cmd, m_GPUDrivenIndexBuffer.get(), 0, vk::IndexType::eUint32);
+
+                    auto& drawCommandsBuffer = scheduler.GetBuffer(depthPrePassData.DrawCommandsBuffer);
+                    auto& drawCountBuffer    = scheduler.GetBuffer(depthPrePassData.DrawCountBuffer);
+                    for (u32 cullModeIndex{}; cullModeIndex < GPU_DRIVEN_CULL_MODE_COUNT; ++cullModeIndex)
+                    {
+                        pipelineStateCache.Set(cmd, cullModeIndex == 0 ? vk::CullModeFlagBits::eBack : vk::CullModeFlagBits::eNone);
+                        DrawGPUDrivenBucket(cmd, drawCommandsBuffer, drawCountBuffer, cullModeIndex, instanceCount);
+                    }
+                    if (!bCPUDraws) return;
+                }
+
                 pipelineStateCache.Bind(cmd, m_DepthPrePassPipeline.get());
 
-                auto& cameraUBO = scheduler.GetBuffer(depthPrePassData.CameraBuffer);
-                for (const auto& ro : m_DrawContext.RenderObjects)
+                auto& cameraUBO            = scheduler.GetBuffer(depthPrePassData.CameraBuffer);
+                auto& objectInstanceBuffer = scheduler.GetBuffer(depthPrePassData.ObjectInstanceBuffer);
+                for (const u32 objectIndex : m_MainViewVisibleObjects)
                 {
+                    const auto& ro = m_DrawContext.RenderObjects[objectIndex];
                     if (ro.AlphaMode != EAlphaMode::ALPHA_MODE_OPAQUE) continue;
 
                     struct PushConstantBlock
                     {
-                        glm::vec3 scale{1.f};
-                        glm::vec3 translation{0.0f};
-                        float4 orientation{1};
+                        const ObjectInstanceData* Instances{nullptr};
                         glm::mat4 ViewProjectionMatrix{1.f};
-                        const VertexPosition* VtxPositions{nullptr};
+                        const DepthOnlyVertexPosition* VtxPositions{nullptr};
                     } pc = {};
 
-                    glm::quat q{1.0f, 0.0f, 0.0f, 0.0f};
-                    glm::vec3 decomposePlaceholder0{1.0f};
-                    glm::vec4 decomposePlaceholder1{1.0f};
-                    glm::decompose(ro.TRS * glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f)),
-                                   pc.scale, q, pc.translation, decomposePlaceholder0, decomposePlaceholder1);
-                    pc.translation += s_MeshTranslation;
-                    pc.scale *= s_MeshScale;
-                    pc.orientation = glm::vec4(q.w, q.x, q.y, q.z);
-
-                    pc.VtxPositions         = (const VertexPosition*)ro.VertexPositionBuffer->GetBDA();
+                    pc.Instances            = (const ObjectInstanceData*)objectInstanceBuffer->GetBDA();
+                    pc.VtxPositions         = (const DepthOnlyVertexPosition*)ro.DepthOnlyVertexPositionBuffer->GetBDA() + ro.VertexOffset;
                     pc.ViewProjectionMatrix = m_MainCamera->GetViewProjectionMatrix();
 
                     pipelineStateCache.Set(cmd, ro.CullMode);
@@ -641,7 +948,8 @@ namespace Radiant
                     cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                          vk::ShaderStageFlagBits::eAll, 0, pc);
                     pipelineStateCache.Bind(cmd, ro.IndexBuffer.get(), 0, ro.IndexType);
-                    cmd.drawIndexed(ro.IndexCount, 1, ro.FirstIndex, 0, 0);
+                    const auto& lod = ro.GetLOD();
+                    cmd.drawIndexed(lod.IndexCount, 1, lod.FirstIndex, 0, objectIndex);
                 }
             });
         struct ShadowsDepthReductionPassData
@@ -758,6 +1066,9 @@ namespace Radiant
         struct CascadedShadowMapsPassData
         {
             RGResourceID CSMDataBuffer;
+            RGResourceID ObjectInstanceBuffer;
+            RGResourceID DrawCommandsBuffer;
+            RGResourceID DrawCountBuffer;
         };
         std::array<CascadedShadowMapsPassData, SHADOW_MAP_CASCADE_COUNT> cmsPassDatas{};
 
@@ -807,6 +1118,20 @@ namespace Radiant
                                                 vk::AttachmentLoadOp::eNoneKHR, vk::AttachmentStoreOp::eNone, cascadeIndex);
                 }
 
+                if (bGPUDriven)
+                {
+                    cmsPassDatas[0].DrawCommandsBuffer = scheduler.ReadBuffer(ResourceNames::GPUDrivenDrawCommandsBuffer,
+                                                                              EResourceStateBits::RESOURCE_STATE_INDIRECT_ARGUMENT_BIT);
+                    cmsPassDatas[0].DrawCountBuffer = scheduler.ReadBuffer(ResourceNames::GPUDrivenDrawCountBuffer,
+                                                                           EResourceStateBits::RESOURCE_STATE_INDIRECT_ARGUMENT_BIT);
+                }
+
+                if (bCPUDraws)
+                {
+                    cmsPassDatas[0].ObjectInstanceBuffer = scheduler.ReadBuffer(
+                        ResourceNames::ObjectInstanceBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+                }
+
                 scheduler.SetViewportScissors(
                     vk::Viewport().setMinDepth(0.0f).setMaxDepth(1.0f).setWidth(SHADOW_MAP_CASCADE_SIZE).setHeight(SHADOW_MAP_CASCADE_SIZE),
                     vk::Rect2D().setExtent(vk::Extent2D().setWidth(SHADOW_MAP_CASCADE_SIZE).setHeight(SHADOW_MAP_CASCADE_SIZE)));
@@ -816,50 +1141,64 @@ namespace Radiant
                 if (!m_LightData->Sun.bCastShadows) return;
 
                 auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
-                pipelineStateCache.Bind(cmd, m_CSMPipeline.get());
+                pipelineStateCache.Bind(cmd, bGPUDriven ? m_CSMGPUDrivenPipeline.get() : m_CSMPipeline.get());
 
                 auto& csmDataBuffer = scheduler.GetBuffer(cmsPassDatas[0].CSMDataBuffer);
 
                 if (!s_bComputeTightBounds)
                 {
-                    const auto csmShaderData =
-                        UpdateCSMData(glm::radians(m_MainCamera->GetZoom()), m_MainCamera->GetAspectRatio(), s_CascadeMinDistance,
-                                      s_CascadeMaxDistance, m_MainCamera->GetViewMatrix(), glm::normalize(m_LightData->Sun.Direction));
+                    csmDataBuffer->SetData(&*cpuCSMData, sizeof(*cpuCSMData));  // NOTE: will be used further in main pass
+                }
+
+                if (bGPUDriven)
+                {
+                    struct PushConstantBlock
+                    {
+                        const Shaders::GPUInstanceData* Instances{nullptr};
+                        const Shaders::CascadedShadowMapsData* CSMData{nullptr};
+                        const DepthOnlyVertexPosition* VtxPositions{nullptr};
+                    } pc = {};
+
+                    pc.Instances    = (const Shaders::GPUInstanceData*)m_GPUInstanceBuffer->GetBDA();
+                    pc.CSMData      = (const Shaders::CascadedShadowMapsData*)csmDataBuffer->GetBDA();
+                    pc.VtxPositions = (const DepthOnlyVertexPosition*)m_GPUDrivenDepthOnlyVertexPositionBuffer->GetBDA();
 
-                    csmDataBuffer->SetData(&csmShaderData, sizeof(csmShaderData));  // NOTE: will be used further in main pass
+                    cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
+                                                         vk::ShaderStageFlagBits::eAll, 0, pc);
+                    pipelineStateCache.Set(cmd, vk::PrimitiveTopology::eTriangleList);
+                    pipelineStateCache.Bind(cmd, m_GPUDrivenIndexBuffer.get(), 0, vk::IndexType::eUint32);
+                    DrawGPUDrivenBucket(cmd, scheduler.GetBuffer(cmsPassDatas[0].DrawCommandsBuffer),
+                                        scheduler.GetBuffer(cmsPassDatas[0].DrawCountBuffer), GPU_DRIVEN_SHADOW_DRAW_BUCKET, instanceCount);
+                    if (!bCPUDraws) return;
+
+                    pipelineStateCache.Bind(cmd, m_CSMPipeline.get());
                 }
 
-                for (const auto& ro : m_DrawContext.RenderObjects)
+                auto& objectInstanceBuffer = scheduler.GetBuffer(cmsPassDatas[0].ObjectInstanceBuffer);
+                for (u32 objectIndex{}; objectIndex < m_DrawContext.RenderObjects.size(); ++objectIndex)
                 {
-                    if (ro.AlphaMode != EAlphaMode::ALPHA_MODE_OPAQUE) continue;
+                    const auto& ro = m_DrawContext.RenderObjects[objectIndex];
+                    if (ro.AlphaMode != EAlphaMode::ALPHA_MODE_OPAQUE || m_ObjectCascadeMasks[objectIndex] == 0) continue;
 
                     struct PushConstantBlock
                     {
-                        glm::vec3 scale{1.0f};
-                        glm::vec3 translation{0.0f};
-                        float4 orientation{1.0f};
+                        const ObjectInstanceData* Instances{nullptr};
                         const Shaders::CascadedShadowMapsData* CSMData{nullptr};
-                        const VertexPosition* VtxPositions{nullptr};
+                        const DepthOnlyVertexPosition* VtxPositions{nullptr};
+                        u32 CascadeMask{0};
                     } pc = {};
-                    glm::quat q{1.0f, 0.0f, 0.0f, 0.0f};
-                    glm::vec3 decomposePlaceholder0{1.0f};
-                    glm::vec4 decomposePlaceholder1{1.0f};
-                    glm::decompose(ro.TRS * glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f)),
-                                   pc.scale, q, pc.translation, decomposePlaceholder0, decomposePlaceholder1);
-                    pc.scale *= s_MeshScale;
-                    pc.translation += s_MeshTranslation;
-                    pc.orientation = glm::vec4(q.w, q.x, q.y, q.z);
 
+                    pc.Instances    = (const ObjectInstanceData*)objectInstanceBuffer->GetBDA();
                     pc.CSMData      = (const Shaders::CascadedShadowMapsData*)csmDataBuffer->GetBDA();
-                    pc.VtxPositions = (const VertexPosition*)ro.VertexPositionBuffer->GetBDA();
+                    pc.VtxPositions = (const DepthOnlyVertexPosition*)ro.DepthOnlyVertexPositionBuffer->GetBDA() + ro.VertexOffset;
+                    pc.CascadeMask  = m_ObjectCascadeMasks[objectIndex];
 
                     pipelineStateCache.Set(cmd, ro.PrimitiveTopology);
                     cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                          vk::ShaderStageFlagBits::eAll, 0, pc);
                     pipelineStateCache.Bind(cmd, ro.IndexBuffer.get(), 0, ro.IndexType);
-                    cmd.drawIndexed(ro.IndexCount, 1, ro.FirstIndex, 0, 0);
+                    const auto& lod = ro.GetLOD(static_cast<u32>(s_ShadowLODBias));
+                    cmd.drawIndexed(lod.IndexCount, 1, lod.FirstIndex, 0, objectIndex);
                 }
             });
 
@@ -974,7 +1313,7 @@ namespace Radiant
             RGResourceID LightClusterDetectActiveBuffer;
         } lcaPassData = {};
         m_RenderGraph->AddPass(
-            "LightClustersAssignmentPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
+            s_LightClustersAssignmentPassName, ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
             [&](RenderGraphResourceScheduler& scheduler)
             {
                 scheduler.CreateBuffer(ResourceNames::LightClusterListBuffer,
@@ -1002,7 +1341,11 @@ namespace Radiant
             [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
             {
                 auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
-                pipelineStateCache.Bind(cmd, m_LightClustersAssignmentPipeline.get());
+                const auto variantIndex  = m_GfxContext->GetKernelAutotuner()->GetVariantIndex(s_LightClustersAssignmentPassName);
+                pipelineStateCache.Bind(cmd, m_LightClustersAssignmentPipelines[variantIndex].get());
+                const u32 workGroupSize = GfxShaderUtils::GetSpecializationConstant(
+                    s_LightClustersAssignmentKernelVariants[variantIndex].SpecializationConstants,
+                    LIGHT_CLUSTERS_ASSIGNMENT_WG_SIZE_CONSTANT_ID, LIGHT_CLUSTERS_ASSIGNMENT_WG_SIZE);
 
                 struct PushConstantBlock
                 {
@@ -1040,14 +1383,14 @@ namespace Radiant
 
                     cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                          vk::ShaderStageFlagBits::eAll, 0, pc);
-                    cmd.dispatch(glm::ceil(LIGHT_CLUSTERS_COUNT / (f32)LIGHT_CLUSTERS_ASSIGNMENT_WG_SIZE), 1, 1);
+                    cmd.dispatch(glm::ceil(LIGHT_CLUSTERS_COUNT / (f32)workGroupSize), 1, 1);
 
                     pc.PointLightBatchOffset += pointLightBatchCount;
                 }
 #else
                 cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(), vk::ShaderStageFlagBits::eAll,
                                                      0, pc);
-                cmd.dispatch(glm::ceil(LIGHT_CLUSTERS_COUNT / (f32)LIGHT_CLUSTERS_ASSIGNMENT_WG_SIZE), 1, 1);
+                cmd.dispatch(glm::ceil(LIGHT_CLUSTERS_COUNT / (f32)workGroupSize), 1, 1);
 #endif
             });
 
@@ -1126,7 +1469,7 @@ namespace Radiant
                 const u8 ssaoBlurCommandQueueIndex = ssaoCommandQueueIndex;
 
                 m_RenderGraph->AddPass(
-                    "SSAOPassCompute", passType,
+                    s_SSAOComputePassName, passType,
                     [&](RenderGraphResourceScheduler& scheduler)
                     {
                         scheduler.CreateTexture(ResourceNames::SSAOTexture,
@@ -1151,7 +1494,8 @@ namespace Radiant
                     [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
                     {
                         auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
-                        pipelineStateCache.Bind(cmd, m_SSAOPipelineCompute.get());
+                        const auto variantIndex  = m_GfxContext->GetKernelAutotuner()->GetVariantIndex(s_SSAOComputePassName);
+                        pipelineStateCache.Bind(cmd, m_SSAOPipelinesCompute[variantIndex].get());
 
                         struct PushConstantBlock
                         {
@@ -1163,8 +1507,13 @@ namespace Radiant
 #endif
                         } pc = {};
 
-                        const uint3 workGroupNum = uint3(glm::ceil(m_ViewportExtent.width / (f32)SSAO_WG_SIZE_X),
-                                                         glm::ceil(m_ViewportExtent.height / (f32)SSAO_WG_SIZE_Y), 1);
+                        const auto& specializationConstants = s_SSAOKernelVariants[variantIndex].SpecializationConstants;
+                        const auto workGroupSize            = glm::uvec2(
+                            GfxShaderUtils::GetSpecializationConstant(specializationConstants, SSAO_WG_SIZE_X_CONSTANT_ID, SSAO_WG_SIZE_X),
+                            GfxShaderUtils::GetSpecializationConstant(specializationConstants, SSAO_WG_SIZE_Y_CONSTANT_ID, SSAO_WG_SIZE_Y));
+
+                        const uint3 workGroupNum = uint3(glm::ceil(m_ViewportExtent.width / (f32)workGroupSize.x),
+                                                         glm::ceil(m_ViewportExtent.height / (f32)workGroupSize.y), 1);
 
 #if USE_THREAD_GROUP_TILING_X
                         pc.WorkGroupNum = workGroupNum;
@@ -1337,6 +1686,7 @@ namespace Radiant
             u32 SSSTextureID{0};
             float2 ScaleBias{0.0f, 0.0f};  // For clustered shading, x - scale, y - bias
             const Shaders::CascadedShadowMapsData* CSMData{nullptr};
+            u32* TextureStreamingFeedback{nullptr};
             u32 CSMShadowMapTextureArray{0};
         };
 
@@ -1352,6 +1702,9 @@ namespace Radiant
             RGResourceID CSMShadowMapTextureArray;
             RGResourceID CSMDataBuffer;
             RGResourceID MainPassShaderDataBuffer;
+            RGResourceID ObjectInstanceBuffer;
+            RGResourceID DrawCommandsBuffer;
+            RGResourceID DrawCountBuffer;
         } mainPassData = {};
         m_RenderGraph->AddPass(
             "MainPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
@@ -1402,6 +1755,20 @@ namespace Radiant
                                                                      EResourceStateBits::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE_BIT);
                 }
 
+                if (bGPUDriven)
+                {
+                    mainPassData.DrawCommandsBuffer = scheduler.ReadBuffer(ResourceNames::GPUDrivenDrawCommandsBuffer,
+                                                                           EResourceStateBits::RESOURCE_STATE_INDIRECT_ARGUMENT_BIT);
+                    mainPassData.DrawCountBuffer = scheduler.ReadBuffer(ResourceNames::GPUDrivenDrawCountBuffer,
+                                                                        EResourceStateBits::RESOURCE_STATE_INDIRECT_ARGUMENT_BIT);
+                }
+
+                if (bCPUDraws)
+                {
+                    mainPassData.ObjectInstanceBuffer = scheduler.ReadBuffer(ResourceNames::ObjectInstanceBuffer,
+                                                                             EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+                }
+
                 scheduler.SetViewportScissors(
                     vk::Viewport().setMinDepth(0.0f).setMaxDepth(1.0f).setWidth(m_ViewportExtent.width).setHeight(m_ViewportExtent.height),
                     vk::Rect2D().setExtent(m_ViewportExtent));
@@ -1409,7 +1776,13 @@ namespace Radiant
             [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
             {
                 auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
-                pipelineStateCache.Bind(cmd, m_MainLightingPassPipeline.get());
+                auto* mainPassPipeline   = bGPUDriven ? m_MainLightingPassGPUDrivenPipeline.get() : m_MainLightingPassPipeline.get();
+
+                // NOTE: IBL textures are always bound, so branches are compiled out, until permutation is ready runtime branches are used.
+                const GfxShaderDefines mainPassPermutation = {{.Name = "SSAO_ENABLED", .Value = s_bEnableSSAO ? "1" : "0"},
+                                                              {.Name = "IBL_ENABLED"}};
+                mainPassPipeline->SetPermutation(mainPassPermutation);
+                pipelineStateCache.Bind(cmd, mainPassPipeline);
 
                 auto& cameraUBO              = scheduler.GetBuffer(mainPassData.CameraBuffer);
                 auto& lightUBO               = scheduler.GetBuffer(mainPassData.LightBuffer);
@@ -1420,6 +1793,7 @@ namespace Radiant
                 MainPassShaderData mpsData       = {};
                 mpsData.CSMShadowMapTextureArray = scheduler.GetTexture(mainPassData.CSMShadowMapTextureArray)->GetBindlessTextureID();
                 mpsData.CSMData = (const Shaders::CascadedShadowMapsData*)scheduler.GetBuffer(mainPassData.CSMDataBuffer)->GetBDA();
+                mpsData.TextureStreamingFeedback    = (u32*)m_GfxContext->GetTextureStreamer()->GetFeedbackBufferBDA();
                 mpsData.IrradianceMapTextureCubeID  = m_IrradianceCubemapTexture->GetBindlessTextureID();
                 mpsData.PrefilteredMapTextureCubeID = m_PrefilteredCubemapTexture->GetBindlessTextureID();
                 mpsData.PrefilteredMapLodCount      = m_PrefilteredCubemapTexture->GetMipCount();
@@ -1437,54 +1811,96 @@ namespace Radiant
                 //                mpsData.EnvironmentMapTextureCubeID = m_EnvMapTexture->GetBindlessTextureID();
 
                 mainPassShaderDataBuffer->SetData(&mpsData, sizeof(mpsData));
-                for (const auto& ro : m_DrawContext.RenderObjects)
+                if (bGPUDriven)
                 {
-                    ++s_DrawCallCount;
-
                     struct PushConstantBlock
                     {
-                        glm::vec3 scale{1.f};
-                        glm::vec3 translation{0.0f};
-                        float4 orientation{1};
+                        const Shaders::GPUInstanceData* Instances{nullptr};
                         const Shaders::CameraData* CameraData{nullptr};
-                        const VertexPosition* VtxPositions{nullptr};
+                        const DepthOnlyVertexPosition* VtxPositions{nullptr};
                         const VertexAttribute* VtxAttributes{nullptr};
-                        const Shaders::GLTFMaterial* MaterialData{nullptr};
                         const Shaders::LightData* LightData{nullptr};
                         const Shaders::LightClusterList* LightClusterList{nullptr};
                         const MainPassShaderData* MPSData{nullptr};
                     } pc = {};
 
-                    pc.MPSData          = (const MainPassShaderData*)mainPassShaderDataBuffer->GetBDA();
+                    pc.Instances        = (const Shaders::GPUInstanceData*)m_GPUInstanceBuffer->GetBDA();
+                    pc.CameraData       = (const Shaders::CameraData*)cameraUBO->GetBDA();
+                    pc.VtxPositions     = (const DepthOnlyVertexPosition*)m_GPUDrivenDepthOnlyVertexPositionBuffer->GetBDA();
+                    pc.VtxAttributes    = (const VertexAttribute*)m_GPUDrivenVertexAttributeBuffer->GetBDA();
                     pc.LightData        = (const Shaders::LightData*)lightUBO->GetBDA();
                     pc.LightClusterList = (const Shaders::LightClusterList*)lightClusterListBuffer->GetBDA();
-                    pc.CameraData       = (const Shaders::CameraData*)cameraUBO->GetBDA();
-
-                    glm::quat q{1.0f, 0.0f, 0.0f, 0.0f};
-                    glm::vec3 decomposePlaceholder0{1.0f};
-                    glm::vec4 decomposePlaceholder1{1.0f};
-                    glm::decompose(ro.TRS * glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f)),
-                                   pc.scale, q, pc.translation, decomposePlaceholder0, decomposePlaceholder1);
-                    pc.translation += s_MeshTranslation;
-                    pc.scale *= s_MeshScale;
-                    pc.orientation = glm::vec4(q.w, q.x, q.y, q.z);
-
-                    pc.VtxPositions  = (const VertexPosition*)ro.VertexPositionBuffer->GetBDA();
-                    pc.VtxAttributes = (const VertexAttribute*)ro.VertexAttributeBuffer->GetBDA();
-                    pc.MaterialData  = (const Shaders::GLTFMaterial*)ro.MaterialBuffer->GetBDA();
-
-                    const auto currentDepthCompareOp =
-                        ro.AlphaMode == EAlphaMode::ALPHA_MODE_OPAQUE ? vk::CompareOp::eEqual : vk::CompareOp::eGreaterOrEqual;
-                    pipelineStateCache.Set(cmd, currentDepthCompareOp);
-                    pipelineStateCache.Set(cmd, ro.CullMode);
-                    pipelineStateCache.Set(cmd, ro.PrimitiveTopology);
+                    pc.MPSData          = (const MainPassShaderData*)mainPassShaderDataBuffer->GetBDA();
 
                     cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                          vk::ShaderStageFlagBits::eAll, 0, pc);
-                    pipelineStateCache.Bind(cmd, ro.IndexBuffer.get(), 0, ro.IndexType);
-                    cmd.drawIndexed(ro.IndexCount, 1, ro.FirstIndex, 0, 0);
+                    pipelineStateCache.Set(cmd, vk::PrimitiveTopology::eTriangleList);
+                    pipelineStateCache.Bind(cmd, m_GPUDrivenIndexBuffer.get(), 0, vk::IndexType::eUint32);
+
+                    // NOTE: Blended buckets stay empty, blended surfaces are sorted back to front and drawn by CPU path below.
+                    constexpr u32 drawBucketCount = static_cast<u32>(EAlphaMode::ALPHA_MODE_BLEND) * GPU_DRIVEN_CULL_MODE_COUNT;
+                    auto& drawCommandsBuffer      = scheduler.GetBuffer(mainPassData.DrawCommandsBuffer);
+                    auto& drawCountBuffer         = scheduler.GetBuffer(mainPassData.DrawCountBuffer);
+                    for (u32 drawBucket{}; drawBucket < drawBucketCount; ++drawBucket)
+                    {
+                        const auto alphaMode = static_cast<EAlphaMode>(drawBucket / GPU_DRIVEN_CULL_MODE_COUNT);
+                        pipelineStateCache.Set(cmd, alphaMode == EAlphaMode::ALPHA_MODE_OPAQUE ? vk::CompareOp::eEqual
+                                                                                               : vk::CompareOp::eGreaterOrEqual);
+                        pipelineStateCache.Set(cmd, drawBucket % GPU_DRIVEN_CULL_MODE_COUNT == 0 ? vk::CullModeFlagBits::eBack
+                                                                                                 : vk::CullModeFlagBits::eNone);
+                        DrawGPUDrivenBucket(cmd, drawCommandsBuffer, drawCountBuffer, drawBucket, instanceCount);
+                        ++s_DrawCallCount;
+                    }
+
+                    if (bCPUDraws)
+                    {
+                        m_MainLightingPassPipeline->SetPermutation(mainPassPermutation);
+                        pipelineStateCache.Bind(cmd, m_MainLightingPassPipeline.get());
+                    }
+                }
+
+                if (bCPUDraws)
+                {
+                    auto& objectInstanceBuffer = scheduler.GetBuffer(mainPassData.ObjectInstanceBuffer);
+                    for (const u32 objectIndex : m_MainViewVisibleObjects)
+                    {
+                        const auto& ro = m_DrawContext.RenderObjects[objectIndex];
+                        ++s_DrawCallCount;
+
+                        struct PushConstantBlock
+                        {
+                            const ObjectInstanceData* Instances{nullptr};
+                            const Shaders::CameraData* CameraData{nullptr};
+                            const DepthOnlyVertexPosition* VtxPositions{nullptr};
+                            const VertexAttribute* VtxAttributes{nullptr};
+                            const Shaders::GLTFMaterial* MaterialData{nullptr};
+                            const Shaders::LightData* LightData{nullptr};
+                            const Shaders::LightClusterList* LightClusterList{nullptr};
+                            const MainPassShaderData* MPSData{nullptr};
+                        } pc = {};
+
+                        pc.MPSData          = (const MainPassShaderData*)mainPassShaderDataBuffer->GetBDA();
+                        pc.LightData        = (const Shaders::LightData*)lightUBO->GetBDA();
+                        pc.LightClusterList = (const Shaders::LightClusterList*)lightClusterListBuffer->GetBDA();
+                        pc.CameraData       = (const Shaders::CameraData*)cameraUBO->GetBDA();
+                        pc.Instances        = (const ObjectInstanceData*)objectInstanceBuffer->GetBDA();
+
+                        pc.VtxPositions  = (const DepthOnlyVertexPosition*)ro.DepthOnlyVertexPositionBuffer->GetBDA() + ro.VertexOffset;
+                        pc.VtxAttributes = (const VertexAttribute*)ro.VertexAttributeBuffer->GetBDA() + ro.VertexOffset;
+                        pc.MaterialData  = (const Shaders::GLTFMaterial*)ro.MaterialBuffer->GetBDA();
+
+                        const auto currentDepthCompareOp =
+                            ro.AlphaMode == EAlphaMode::ALPHA_MODE_OPAQUE ? vk::CompareOp::eEqual : vk::CompareOp::eGreaterOrEqual;
+                        pipelineStateCache.Set(cmd, currentDepthCompareOp);
+                        pipelineStateCache.Set(cmd, ro.CullMode);
+                        pipelineStateCache.Set(cmd, ro.PrimitiveTopology);
+
+                        cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
+                                                             vk::ShaderStageFlagBits::eAll, 0, pc);
+                        pipelineStateCache.Bind(cmd, ro.IndexBuffer.get(), 0, ro.IndexType);
+                        const auto& lod = ro.GetLOD();
+                        cmd.drawIndexed(lod.IndexCount, 1, lod.FirstIndex, 0, objectIndex);
+                    }
                 }
 
                 {
@@ -1573,7 +1989,8 @@ namespace Radiant
                     [&, i](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
                     {
                         auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
-                        pipelineStateCache.Bind(cmd, m_BloomDownsamplePipelineCompute.get());
+                        const auto variantIndex  = m_GfxContext->GetKernelAutotuner()->GetVariantIndex(s_BloomDownsampleComputePassName);
+                        pipelineStateCache.Bind(cmd, m_BloomDownsamplePipelinesCompute[variantIndex].get());
 
                         struct PushConstantBlock
                         {
@@ -1589,8 +2006,14 @@ namespace Radiant
 
                         cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                              vk::ShaderStageFlagBits::eAll, 0, pc);
-                        cmd.dispatch(glm::ceil(bloomMipChain[i].Size.x / (f32)BLOOM_WG_SIZE_X),
-                                     glm::ceil(bloomMipChain[i].Size.y / (f32)BLOOM_WG_SIZE_Y), 1);
+                        const auto& specializationConstants = s_BloomDownsampleKernelVariants[variantIndex].SpecializationConstants;
+                        const auto workGroupSize            = glm::uvec2(
+                            GfxShaderUtils::GetSpecializationConstant(specializationConstants, BLOOM_DOWNSAMPLE_WG_SIZE_X_CONSTANT_ID,
+                                                                      BLOOM_WG_SIZE_X),
+                            GfxShaderUtils::GetSpecializationConstant(specializationConstants, BLOOM_DOWNSAMPLE_WG_SIZE_Y_CONSTANT_ID,
+                                                                      BLOOM_WG_SIZE_Y));
+                        cmd.dispatch(glm::ceil(bloomMipChain[i].Size.x / (f32)workGroupSize.x),
+                                     glm::ceil(bloomMipChain[i].Size.y / (f32)workGroupSize.y), 1);
                     });
             }
             else
@@ -1892,6 +2315,27 @@ namespace Radiant
                 ImGui::DragFloat3("Rotation", (float*)&s_MeshRotation, 1.f, -360.0f, 360.0f);
                 ImGui::DragFloat("Scale", &s_MeshScale, 0.01f, 0.0f);
 
+                ImGui::SeparatorText("Mesh LODs");
+                ImGui::Checkbox("Enable LODs", &s_bEnableMeshLODs);
+                ImGui::DragFloat("LOD Error Threshold(pixels)", &s_LODErrorThresholdPixels, 0.05f, 0.0f, 32.0f);
+                ImGui::SliderInt("Shadow LOD Bias", &s_ShadowLODBias, 0, s_MaxMeshLODCount - 1);
+
+                ImGui::SeparatorText("GPU-Driven Rendering");
+                ImGui::Checkbox("Enable GPU-Driven Rendering", &s_bGPUDrivenRendering);
+                ImGui::Text("Instances: %zu", m_GPUInstances.size());
+
+                ImGui::SeparatorText("CPU Culling");
+                ImGui::Checkbox("Enable BVH Culling", &s_bEnableBVHCulling);
+                ImGui::Text("BVH Nodes: %u", m_SceneBVH.GetNodeCount());
+                ImGui::Text("Main View: %zu/%zu visible, %.3f ms", m_MainViewVisibleObjects.size(), m_DrawContext.RenderObjects.size(),
+                            s_MainViewCullTimeMs);
+                ImGui::Text("Main View Sort: %.3f ms", s_MainViewSortTimeMs);
+                for (u32 cascadeIndex{}; cascadeIndex < SHADOW_MAP_CASCADE_COUNT; ++cascadeIndex)
+                {
+                    ImGui::Text("Cascade %u: %zu/%zu visible, %.3f ms", cascadeIndex, m_CascadeVisibleObjects[cascadeIndex].size(),
+                                m_DrawContext.RenderObjects.size(), s_CascadeCullTimesMs[cascadeIndex]);
+                }
+
                 ImGui::Separator();
                 ImGui::Checkbox("Bloom Use Compute", &s_bBloomComputeBased);
                 ImGui::Checkbox("Enable SSAO", &s_bEnableSSAO);
@@ -1919,6 +2363,118 @@ namespace Radiant
         m_RenderGraphStats = m_RenderGraph->GetStatistics();
     }
 
+    void CombinedRenderer::UpdateObjectWorldBounds() noexcept
+    {
+        const glm::mat4 meshRotation = glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
+                                       glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
+                                       glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+
+        m_ObjectWorldBounds.resize(m_DrawContext.RenderObjects.size());
+        std::transform(std::execution::par, m_DrawContext.RenderObjects.cbegin(), m_DrawContext.RenderObjects.cend(),
+                       m_ObjectWorldBounds.begin(),
+                       [&](const RenderObject& ro)
+                       {
+                           const glm::mat4 modelMatrix = ro.TRS * meshRotation;
+                           const glm::vec3 axisScale{glm::length(glm::vec3(modelMatrix[0])), glm::length(glm::vec3(modelMatrix[1])),
+                                                     glm::length(glm::vec3(modelMatrix[2]))};
+                           const f32 maxScale = glm::max(glm::max(axisScale.x, axisScale.y), axisScale.z) * s_MeshScale;
+
+                           const glm::vec3 center =
+                               glm::vec3(modelMatrix * glm::vec4(ro.Bounds.Origin * s_MeshScale, 1.0f)) + s_MeshTranslation;
+                           return Sphere{.Origin = center, .Radius = ro.Bounds.Radius * maxScale};
+                       });
+    }
+
+    void CombinedRenderer::BuildDrawSortStateKeys() noexcept
+    {
+        UnorderedMap<const GfxBuffer*, u32> indexBufferIDs;
+        UnorderedMap<const GfxBuffer*, u32> materialIDs;
+
+        m_DrawSortStateKeys.resize(m_DrawContext.RenderObjects.size());
+        for (u32 i{}; i < m_DrawContext.RenderObjects.size(); ++i)
+        {
+            const auto& ro = m_DrawContext.RenderObjects[i];
+            const u32 indexBufferID =
+                indexBufferIDs.try_emplace(ro.IndexBuffer.get(), static_cast<u32>(indexBufferIDs.size())).first->second;
+            const u32 materialID = materialIDs.try_emplace(ro.MaterialBuffer.get(), static_cast<u32>(materialIDs.size())).first->second;
+            RDNT_ASSERT(indexBufferID < (1u << s_DrawSortIndexBufferBitCount) && materialID < (1u << s_DrawSortMaterialBitCount),
+                        "Too many unique index buffers or materials to fit draw sort key!");
+
+            // Cull mode | topology | index buffer | material, most expensive state change goes first.
+            u32 stateKey = ro.CullMode == vk::CullModeFlagBits::eNone ? 1 : 0;
+            stateKey     = (stateKey << s_DrawSortTopologyBitCount) | static_cast<u32>(ro.PrimitiveTopology);
+            stateKey     = (stateKey << s_DrawSortIndexBufferBitCount) | indexBufferID;
+            stateKey     = (stateKey << s_DrawSortMaterialBitCount) | materialID;
+
+            m_DrawSortStateKeys[i] = stateKey;
+        }
+    }
+
+    void CombinedRenderer::BuildGPUInstances() noexcept
+    {
+        static_assert(GPU_DRIVEN_MAX_LOD_COUNT == s_MaxMeshLODCount, "GPU-driven instance LOD count doesn't match mesh one!");
+
+        m_GPUInstances.clear();
+        m_GPUInstances.reserve(m_DrawContext.RenderObjects.size());
+        m_ObjectGPUDrivenFlags.assign(m_DrawContext.RenderObjects.size(), 0);
+        m_CPUDrawnObjectCount = 0;
+        for (u32 objectIndex{}; objectIndex < m_DrawContext.RenderObjects.size(); ++objectIndex)
+        {
+            const auto& ro = m_DrawContext.RenderObjects[objectIndex];
+
+            // NOTE: Points and lines don't get their own buckets, blended surfaces need back to front order, CPU path draws them.
+            if (ro.PrimitiveTopology != vk::PrimitiveTopology::eTriangleList || ro.AlphaMode == EAlphaMode::ALPHA_MODE_BLEND)
+            {
+                ++m_CPUDrawnObjectCount;
+                continue;
+            }
+            m_ObjectGPUDrivenFlags[objectIndex] = 1;
+
+            if (!m_GPUDrivenIndexBuffer)
+            {
+                m_GPUDrivenIndexBuffer                   = ro.IndexBuffer;
+                m_GPUDrivenDepthOnlyVertexPositionBuffer = ro.DepthOnlyVertexPositionBuffer;
+                m_GPUDrivenVertexAttributeBuffer         = ro.VertexAttributeBuffer;
+            }
+            RDNT_ASSERT(ro.IndexBuffer == m_GPUDrivenIndexBuffer &&
+                            ro.DepthOnlyVertexPositionBuffer == m_GPUDrivenDepthOnlyVertexPositionBuffer &&
+                            ro.VertexAttributeBuffer == m_GPUDrivenVertexAttributeBuffer && ro.IndexType == vk::IndexType::eUint32,
+                        "GPU-driven path expects every object to live in the same megabuffers!");
+
+            auto& instance       = m_GPUInstances.emplace_back();
+            instance.Translation = ro.Instance.translation;
+            instance.Orientation = ro.Instance.orientation;
+            instance.Scale       = ro.Instance.scale;
+
+            instance.Bounds                = ro.Bounds;
+            instance.PositionDequantScale  = ro.Instance.positionDequantScale;
+            instance.PositionDequantOffset = ro.Instance.positionDequantOffset;
+            instance.MaterialData          = (const Shaders::GLTFMaterial*)ro.MaterialBuffer->GetBDA();
+            instance.VertexOffset = ro.VertexOffset;
+            instance.DrawBucket   = static_cast<u32>(ro.AlphaMode) * GPU_DRIVEN_CULL_MODE_COUNT +
+                                  (ro.CullMode == vk::CullModeFlagBits::eNone ? 1 : 0);
+            instance.LODCount = static_cast<u32>(ro.LODs.size());
+            for (u32 lodIndex{}; lodIndex < instance.LODCount; ++lodIndex)
+            {
+                instance.LODs[lodIndex].FirstIndex = ro.LODs[lodIndex].FirstIndex;
+                instance.LODs[lodIndex].IndexCount = ro.LODs[lodIndex].IndexCount;
+                instance.LODs[lodIndex].Error      = ro.LODs[lodIndex].Error;
+            }
+        }
+        if (m_GPUInstances.empty()) return;
+
+        const u64 instanceBufferSize = m_GPUInstances.size() * sizeof(Shaders::GPUInstanceData);
+        if (!m_GPUInstanceBuffer)
+        {
+            m_GPUInstanceBuffer = MakeUnique<GfxBuffer>(
+                m_GfxContext->GetDevice(), GfxBufferDescription(instanceBufferSize, sizeof(Shaders::GPUInstanceData),
+                                                                vk::BufferUsageFlagBits::eStorageBuffer,
+                                                                EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
+            m_GfxContext->GetDevice()->SetDebugName("GPUInstanceBuffer", (const vk::Buffer&)*m_GPUInstanceBuffer);
+        }
+        m_GPUInstanceBuffer->SetData(m_GPUInstances.data(), instanceBufferSize);
+    }
+
     /*
         Calculate frustum split depths and matrices for the shadow map cascades
         Based on https://johanmedestrom.wordpress.com/2016/03/18/opengl-cascaded-shadow-maps/
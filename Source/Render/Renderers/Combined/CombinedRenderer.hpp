@@ -3,6 +3,9 @@
 #include <Render/Renderers/Renderer.hpp>
 
 #include <shadows/csm_defines.hpp>
+#include <gpu_driven/gpu_driven_defines.hpp>
+
+#include <Scene/BVH.hpp>
 
 namespace Radiant
 {
@@ -19,13 +22,44 @@ namespace Radiant
         // clustered light culling
         Unique<GfxPipeline> m_LightClustersBuildPipeline{nullptr};
         Unique<GfxPipeline> m_LightClustersDetectActivePipeline{nullptr};
-        Unique<GfxPipeline> m_LightClustersAssignmentPipeline{nullptr};
+        std::vector<Unique<GfxPipeline>> m_LightClustersAssignmentPipelines{};  // per kernel variant
 
         Unique<GfxPipeline> m_DepthPrePassPipeline{nullptr};
         Unique<GfxPipeline> m_CSMPipeline{nullptr};
         Unique<GfxPipeline> m_MainLightingPassPipeline{nullptr};
         Unique<GfxPipeline> m_FinalPassPipeline{nullptr};
 
+        // GPU-driven rendering, compute turns instances into indirect draws, passes draw them per pipeline state bucket.
+        Unique<GfxPipeline> m_BuildDrawCommandsPipeline{nullptr};
+        Unique<GfxPipeline> m_DepthPrePassGPUDrivenPipeline{nullptr};
+        Unique<GfxPipeline> m_CSMGPUDrivenPipeline{nullptr};
+        Unique<GfxPipeline> m_MainLightingPassGPUDrivenPipeline{nullptr};
+        std::vector<Shaders::GPUInstanceData> m_GPUInstances;
+        Unique<GfxBuffer> m_GPUInstanceBuffer{nullptr};
+        Shared<GfxBuffer> m_GPUDrivenIndexBuffer{nullptr};  // Every instance lives in the same megabuffers.
+        Shared<GfxBuffer> m_GPUDrivenDepthOnlyVertexPositionBuffer{nullptr};
+        Shared<GfxBuffer> m_GPUDrivenVertexAttributeBuffer{nullptr};
+        std::vector<u8> m_ObjectGPUDrivenFlags;  // Set for render objects GPU-driven path draws, the rest go through CPU path.
+        u32 m_CPUDrawnObjectCount{0};
+
+        // CPU culling, visible lists index into m_DrawContext.RenderObjects.
+        BVH m_SceneBVH;
+        std::vector<Sphere> m_ObjectWorldBounds;
+        std::vector<u32> m_MainViewVisibleObjects;
+        std::array<std::vector<u32>, SHADOW_MAP_CASCADE_COUNT> m_CascadeVisibleObjects;
+        std::vector<u8> m_ObjectCascadeMasks;  // Bit per cascade object is visible in.
+
+        // Draw sorting, 64 bit keys: alpha mode | (state, depth) for opaque and masked, alpha mode | (inverted depth, state) for blended.
+        static constexpr u32 s_DrawSortMaterialBitCount    = 14;
+        static constexpr u32 s_DrawSortIndexBufferBitCount = 12;
+        static constexpr u32 s_DrawSortTopologyBitCount    = 4;
+        static constexpr u32 s_DrawSortStateBitCount =
+            1 /* cull mode */ + s_DrawSortTopologyBitCount + s_DrawSortIndexBufferBitCount + s_DrawSortMaterialBitCount;
+        static constexpr u32 s_DrawSortDepthBitCount       = 24;
+        std::vector<u32> m_DrawSortStateKeys;  // Static part of sort key, render objects never change their state.
+        std::vector<CoreUtils::RadixSortItem> m_MainViewSortItems;
+        std::vector<CoreUtils::RadixSortItem> m_MainViewSortScratchItems;
+
         Unique<GfxPipeline> m_DepthBoundsComputePipeline{nullptr};
         Unique<GfxPipeline> m_ShadowsSetupPipeline{nullptr};
 
@@ -34,7 +68,7 @@ namespace Radiant
 
         // Screen-space ambient occlusion
         Unique<GfxPipeline> m_SSAOPipelineGraphics{nullptr};
-        Unique<GfxPipeline> m_SSAOPipelineCompute{nullptr};  // better normal reconstruction
+        std::vector<Unique<GfxPipeline>> m_SSAOPipelinesCompute{};  // better normal reconstruction, per kernel variant
         Unique<GfxPipeline> m_SSAOBoxBlurPipelineGraphics{nullptr};
         Unique<GfxPipeline> m_SSAOBoxBlurPipelineCompute{nullptr};
 
@@ -42,7 +76,7 @@ namespace Radiant
         Unique<GfxPipeline> m_BloomDownsamplePipelineGraphics{nullptr};
         Unique<GfxPipeline> m_BloomUpsampleBlurPipelineGraphics{nullptr};
         // compute version is optimized
-        Unique<GfxPipeline> m_BloomDownsamplePipelineCompute{nullptr};
+        std::vector<Unique<GfxPipeline>> m_BloomDownsamplePipelinesCompute{};  // per kernel variant
         Unique<GfxPipeline> m_BloomUpsampleBlurPipelineCompute{nullptr};
 
         Unique<GfxBuffer> m_CubeIndexBuffer{nullptr};
@@ -54,6 +88,26 @@ namespace Radiant
         RenderGraphStatistics m_RenderGraphStats = {};
         Unique<Shaders::LightData> m_LightData{MakeUnique<Shaders::LightData>()};
 
+        void BuildGPUInstances() noexcept;
+        void UpdateObjectWorldBounds() noexcept;
+        void BuildDrawSortStateKeys() noexcept;
+
+        NODISCARD FORCEINLINE static u64 MakeDrawSortKey(const EAlphaMode alphaMode, const u32 stateKey, const f32 depth) noexcept
+        {
+            static_assert(s_DrawSortStateBitCount + s_DrawSortDepthBitCount <= 62, "Draw sort key doesn't fit into 64 bits!");
+
+            // NOTE: Bit pattern of positive float grows monotonically with its value, top bits keep exponent and most of mantissa.
+            const u64 depthKey = std::bit_cast<u32>(glm::max(depth, 0.0f)) >> (32 - s_DrawSortDepthBitCount);
+            const u64 alphaKey = static_cast<u64>(alphaMode) << 62;
+            if (alphaMode == EAlphaMode::ALPHA_MODE_BLEND)
+            {
+                const u64 invertedDepthKey = ~depthKey & ((1ull << s_DrawSortDepthBitCount) - 1);
+                return alphaKey | (invertedDepthKey << s_DrawSortStateBitCount) | stateKey;
+            }
+
+            return alphaKey | (static_cast<u64>(stateKey) << s_DrawSortDepthBitCount) | depthKey;
+        }
+
         static Shaders::CascadedShadowMapsData UpdateCSMData(const f32 cameraFovY, const f32 cameraAR, const f32 zNear, const f32 zFar,
                                                              const glm::mat4& cameraView, const glm::vec3& L) noexcept;
     };
@@ -7,6 +7,14 @@
 
 namespace Radiant
 {
+    static constexpr const char* s_IBLCacheDir = "ibl_cache/";
+
+    NODISCARD static u64 HashFileContents(const std::string_view& filePath) noexcept
+    {
+        const auto fileData = CoreUtils::LoadData<u8>(filePath);
+        return ankerl::unordered_dense::detail::wyhash::hash(fileData.data(), fileData.size());
+    }
+
     Renderer::Renderer() noexcept
         : m_GfxContext(MakeUnique<GfxContext>()), m_RenderGraphResourcePool(MakeUnique<RenderGraphResourcePool>(m_GfxContext->GetDevice())),
           m_UIRenderer(MakeUnique<ImGuiRenderer>(m_GfxContext)), m_DebugRenderer(MakeUnique<DebugRenderer>(m_GfxContext))
@@ -81,6 +89,146 @@ namespace Radiant
         return shaderCameraData;
     }
 
+    void Renderer::UpdateObjectInstances(const f32 meshScale, const glm::vec3& meshTranslation, const glm::vec3& meshRotation) noexcept
+    {
+        const glm::mat4 meshRotationMatrix = glm::rotate(glm::radians(meshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
+                                             glm::rotate(glm::radians(meshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
+                                             glm::rotate(glm::radians(meshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+
+        std::for_each(std::execution::par, m_DrawContext.RenderObjects.begin(), m_DrawContext.RenderObjects.end(),
+                      [&](RenderObject& ro)
+                      {
+                          glm::quat q{1.0f, 0.0f, 0.0f, 0.0f};
+                          glm::vec3 decomposePlaceholder0{1.0f};
+                          glm::vec4 decomposePlaceholder1{1.0f};
+                          glm::decompose(ro.TRS * meshRotationMatrix, ro.Instance.scale, q, ro.Instance.translation, decomposePlaceholder0,
+                                         decomposePlaceholder1);
+                          ro.Instance.translation += meshTranslation;
+                          ro.Instance.scale *= meshScale;
+                          ro.Instance.orientation = glm::vec4(q.w, q.x, q.y, q.z);
+                      });
+    }
+
+    void Renderer::UploadObjectInstances(const Unique<GfxBuffer>& objectInstanceBuffer) const noexcept
+    {
+        RDNT_ASSERT(objectInstanceBuffer->GetMapped(), "Object instance buffer should be host visible!");
+        RDNT_ASSERT(objectInstanceBuffer->GetDescription().Capacity >= m_DrawContext.RenderObjects.size() * sizeof(ObjectInstanceData),
+                    "Object instance buffer is too small!");
+
+        auto* objectInstances = static_cast<ObjectInstanceData*>(objectInstanceBuffer->GetMapped());
+        std::transform(m_DrawContext.RenderObjects.cbegin(), m_DrawContext.RenderObjects.cend(), objectInstances,
+                       [](const RenderObject& ro) { return ro.Instance; });
+    }
+
+    NODISCARD Unique<GfxTexture> Renderer::GenerateBRDFLut() noexcept
+    {
+        static constexpr glm::uvec2 s_BrdfLutDimensions{512, 512};
+
+        const auto& device = m_GfxContext->GetDevice();
+        auto brdfLutTexture = MakeUnique<GfxTexture>(
+            device, GfxTextureDescription(
+                        vk::ImageType::e2D, glm::uvec3(s_BrdfLutDimensions.x, s_BrdfLutDimensions.y, 1),
+                        /* Idk which format is better Sfloat or Unorm, but I think Unorm fits well since its range is [0, 1]*/
+                        vk::Format::eR16G16Unorm,
+                        vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc |
+                            vk::ImageUsageFlagBits::eTransferDst,
+                        vk::SamplerCreateInfo()
+                            .setAddressModeU(vk::SamplerAddressMode::eClampToEdge)
+                            .setAddressModeV(vk::SamplerAddressMode::eClampToEdge)
+                            .setAddressModeW(vk::SamplerAddressMode::eClampToEdge)
+                            .setMagFilter(vk::Filter::eLinear)
+                            .setMinFilter(vk::Filter::eLinear)
+                            .setBorderColor(vk::BorderColor::eFloatOpaqueWhite)));
+        device->SetDebugName("BRDF_LUT", (const vk::Image&)*brdfLutTexture);
+
+        const std::array<u64, 3> cacheKeyData = {s_BrdfLutDimensions.x, s_BrdfLutDimensions.y,
+                                                 HashFileContents("../Assets/Shaders/ibl_utils/generate_brdf_lut.slang")};
+        const u64 cacheKey       = ankerl::unordered_dense::detail::wyhash::hash(cacheKeyData.data(), sizeof(cacheKeyData));
+        const auto brdfCachePath = std::string(s_IBLCacheDir) + "BRDF_LUT.bin";
+        if (GfxTextureUtils::LoadTextureSnapshot(brdfCachePath, cacheKey, *brdfLutTexture))
+        {
+            LOG_INFO("Found BRDF LUT cache.");
+            return brdfLutTexture;
+        }
+
+        const GfxPipelineDescription pipelineDesc = {
+            .DebugName       = "BrdfLutGen",
+            .PipelineOptions = GfxGraphicsPipelineOptions{.RenderingFormats{vk::Format::eR16G16Unorm},
+                                                          //  .CullMode{vk::CullModeFlagBits::eBack},
+                                                          .FrontFace{vk::FrontFace::eCounterClockwise},
+                                                          .PrimitiveTopology{vk::PrimitiveTopology::eTriangleList},
+                                                          .PolygonMode{vk::PolygonMode::eFill}},
+            .Shader = MakeShared<GfxShader>(device, GfxShaderDescription{.Path = "../Assets/Shaders/ibl_utils/generate_brdf_lut.slang"})};
+        auto brdfLutGenPipeline = MakeUnique<GfxPipeline>(device, pipelineDesc);
+
+        auto executionContext = m_GfxContext->CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
+        executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+#if RDNT_DEBUG
+        executionContext.CommandBuffer.beginDebugUtilsLabelEXT(
+            vk::DebugUtilsLabelEXT().setPLabelName("BRDFLutGen").setColor({1.0f, 1.0f, 1.0f, 1.0f}));
+#endif
+
+        executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
+            vk::ImageMemoryBarrier2()
+                .setImage(*brdfLutTexture)
+                .setSubresourceRange(vk::ImageSubresourceRange()
+                                         .setBaseArrayLayer(0)
+                                         .setLayerCount(1)
+                                         .setBaseMipLevel(0)
+                                         .setLevelCount(1)
+                                         .setAspectMask(vk::ImageAspectFlagBits::eColor))
+                .setOldLayout(vk::ImageLayout::eUndefined)
+                .setNewLayout(vk::ImageLayout::eColorAttachmentOptimal)
+                .setSrcAccessMask(vk::AccessFlagBits2::eNone)
+                .setSrcStageMask(vk::PipelineStageFlagBits2::eNone)
+                .setDstAccessMask(vk::AccessFlagBits2::eColorAttachmentWrite)
+                .setDstStageMask(vk::PipelineStageFlagBits2::eColorAttachmentOutput)));
+
+        executionContext.CommandBuffer.beginRendering(
+            vk::RenderingInfo()
+                .setLayerCount(1)
+                .setColorAttachments((vk::RenderingAttachmentInfo&)brdfLutTexture->GetRenderingAttachmentInfo(
+                    vk::ImageLayout::eColorAttachmentOptimal,
+                    vk::ClearValue().setColor(vk::ClearColorValue().setFloat32({0.0f, 0.0f, 0.0f, 1.0f})), vk::AttachmentLoadOp::eClear,
+                    vk::AttachmentStoreOp::eStore))
+                .setRenderArea(vk::Rect2D().setExtent(vk::Extent2D().setWidth(s_BrdfLutDimensions.x).setHeight(s_BrdfLutDimensions.y))));
+
+        executionContext.CommandBuffer.setViewportWithCount(
+            vk::Viewport().setMinDepth(0.0f).setMaxDepth(1.0f).setWidth(s_BrdfLutDimensions.x).setHeight(s_BrdfLutDimensions.y));
+        executionContext.CommandBuffer.setScissorWithCount(
+            vk::Rect2D().setExtent(vk::Extent2D().setWidth(s_BrdfLutDimensions.x).setHeight(s_BrdfLutDimensions.y)));
+        executionContext.CommandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *brdfLutGenPipeline);
+
+        executionContext.CommandBuffer.draw(3, 1, 0, 0);
+
+        executionContext.CommandBuffer.endRendering();
+        executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
+            vk::ImageMemoryBarrier2()
+                .setImage(*brdfLutTexture)
+                .setSubresourceRange(vk::ImageSubresourceRange()
+                                         .setBaseArrayLayer(0)
+                                         .setLayerCount(1)
+                                         .setBaseMipLevel(0)
+                                         .setLevelCount(1)
+                                         .setAspectMask(vk::ImageAspectFlagBits::eColor))
+                .setOldLayout(vk::ImageLayout::eColorAttachmentOptimal)
+                .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                .setSrcAccessMask(vk::AccessFlagBits2::eColorAttachmentWrite)
+                .setSrcStageMask(vk::PipelineStageFlagBits2::eColorAttachmentOutput)
+                .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
+                .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader)));
+
+#if RDNT_DEBUG
+        executionContext.CommandBuffer.endDebugUtilsLabelEXT();
+#endif
+        executionContext.CommandBuffer.end();
+        m_GfxContext->SubmitImmediateExecuteContext(executionContext);
+
+        GfxTextureUtils::SaveTextureSnapshot(brdfCachePath, cacheKey, *brdfLutTexture);
+        return brdfLutTexture;
+    }
+
     NODISCARD std::pair<Unique<GfxTexture>, Unique<GfxTexture>> Renderer::GenerateIBLMaps(
         const std::string_view& equirectangularMapPath) noexcept
     {
@@ -89,12 +237,78 @@ namespace Radiant
         static constexpr u32 s_FromEquirectangularCubeMapSize = 1024u;
         static constexpr u8 s_CubemapMipCount                 = 5;  // used globally across all cubemaps to mititgate bright dots
 
+        const auto& device = m_GfxContext->GetDevice();
+
+        const auto ExtractBaseFilenameFunc = [](const std::string& path) -> std::string
+        {
+            const auto lastSlashPositionIndex = path.find_last_of('/');
+            const auto startPositionIndex     = (lastSlashPositionIndex != std::string::npos) ? lastSlashPositionIndex + 1 : 0;
+
+            const auto dotPositionIndex = path.find_last_of('.');
+            if (dotPositionIndex == std::string::npos) return path.substr(startPositionIndex);
+            return path.substr(startPositionIndex, dotPositionIndex - startPositionIndex);  // Returns actual file name without extension.
+        };
+        const auto environmentMapName = ExtractBaseFilenameFunc(std::string(equirectangularMapPath));
+
+        // Final convoluted environment map.
+        auto irradianceCubemap = MakeUnique<GfxTexture>(
+            device, GfxTextureDescription(vk::ImageType::e2D, glm::uvec3(s_IrradianceCubeMapSize, s_IrradianceCubeMapSize, 1),
+                                          vk::Format::eB10G11R11UfloatPack32,
+                                          vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc |
+                                              vk::ImageUsageFlagBits::eTransferDst,
+                                          vk::SamplerCreateInfo()
+                                              .setAddressModeU(vk::SamplerAddressMode::eClampToEdge)
+                                              .setAddressModeV(vk::SamplerAddressMode::eClampToEdge)
+                                              .setAddressModeW(vk::SamplerAddressMode::eClampToEdge)
+                                              .setMagFilter(vk::Filter::eLinear)
+                                              .setMinFilter(vk::Filter::eLinear),
+                                          6, vk::SampleCountFlagBits::e1));
+        const auto irradianceCubemapName = environmentMapName + "_Irradiance";
+        device->SetDebugName(irradianceCubemapName.data(), (const vk::Image&)*irradianceCubemap);
+
+        // Final prefiltered environment map.
+        auto prefilteredCubemap = MakeUnique<GfxTexture>(
+            device,
+            GfxTextureDescription(vk::ImageType::e2D, glm::uvec3(s_PrefilteredCubeMapSize, s_PrefilteredCubeMapSize, 1),
+                                  vk::Format::eB10G11R11UfloatPack32, vk::ImageUsageFlagBits::eTransferDst,
+                                  vk::SamplerCreateInfo()
+                                      .setAddressModeU(vk::SamplerAddressMode::eClampToEdge)
+                                      .setAddressModeV(vk::SamplerAddressMode::eClampToEdge)
+                                      .setAddressModeW(vk::SamplerAddressMode::eClampToEdge)
+                                      .setMagFilter(vk::Filter::eLinear)
+                                      .setMinFilter(vk::Filter::eLinear)
+                                      .setMipmapMode(vk::SamplerMipmapMode::eLinear)
+                                      .setMinLod(0.0f)
+                                      .setMaxLod(vk::LodClampNone),
+                                  6, vk::SampleCountFlagBits::e1, EResourceCreateBits::RESOURCE_CREATE_CREATE_MIPS_BIT, s_CubemapMipCount));
+        const auto prefilteredCubemapName = environmentMapName + "_Prefiltered";
+        device->SetDebugName(prefilteredCubemapName.data(), (const vk::Image&)*prefilteredCubemap);
+
+        // NOTE: Shader sources are part of the key, so tweaking sample counts(or anything else) in them invalidates the cache.
+        const std::array<u64, 8> cacheKeyData = {HashFileContents(equirectangularMapPath),
+                                                 s_IrradianceCubeMapSize,
+                                                 s_PrefilteredCubeMapSize,
+                                                 s_FromEquirectangularCubeMapSize,
+                                                 s_CubemapMipCount,
+                                                 HashFileContents("../Assets/Shaders/ibl_utils/equirectangular_to_cubemap.slang"),
+                                                 HashFileContents("../Assets/Shaders/ibl_utils/generate_irradiance_cube.slang"),
+                                                 HashFileContents("../Assets/Shaders/ibl_utils/generate_prefiltered_cube.slang")};
+        const u64 cacheKey              = ankerl::unordered_dense::detail::wyhash::hash(cacheKeyData.data(), sizeof(cacheKeyData));
+        const auto irradianceCachePath  = std::string(s_IBLCacheDir) + irradianceCubemapName + ".bin";
+        const auto prefilteredCachePath = std::string(s_IBLCacheDir) + prefilteredCubemapName + ".bin";
+
+        if (GfxTextureUtils::LoadTextureSnapshot(irradianceCachePath, cacheKey, *irradianceCubemap) &&
+            GfxTextureUtils::LoadTextureSnapshot(prefilteredCachePath, cacheKey, *prefilteredCubemap))
+        {
+            LOG_INFO("Found IBL maps cache for: {}", equirectangularMapPath);
+            return {std::move(irradianceCubemap), std::move(prefilteredCubemap)};
+        }
+
         // Prepare pipelines for:
         // 1) Transforming equirectangular to cubemap.
         // 2) Convolute cubemap into irradiance map KxK size. K <= 256.
         // 3) Convolute cubemap into prefiltered map used for specular indirect as a part of split-sum approximation.
 
-        const auto& device                    = m_GfxContext->GetDevice();
         auto equirectangularToCubemapPipeline = MakeUnique<GfxPipeline>(
             device, GfxPipelineDescription{
                         .DebugName       = "equirectangular_to_cubemap",
@@ -130,8 +344,7 @@ namespace Radiant
 
         auto executionContext = m_GfxContext->CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
         executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
-        executionContext.CommandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, device->GetBindlessPipelineLayout(), 0,
-                                                          device->GetCurrentFrameBindlessResources().DescriptorSet, {});
+        device->BindBindlessResources(executionContext.CommandBuffer, vk::PipelineBindPoint::eGraphics);
 #if RDNT_DEBUG
         executionContext.CommandBuffer.beginDebugUtilsLabelEXT(
             vk::DebugUtilsLabelEXT().setPLabelName("IBLMapsGen").setColor({1.0f, 1.0f, 1.0f, 1.0f}));
@@ -332,22 +545,6 @@ namespace Radiant
                         vk::Format::eB10G11R11UfloatPack32, vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc,
                         std::nullopt, 6, vk::SampleCountFlagBits::e1));
 
-        // Final prefiltered environment map.
-        auto prefilteredCubemap = MakeUnique<GfxTexture>(
-            device,
-            GfxTextureDescription(vk::ImageType::e2D, glm::uvec3(s_PrefilteredCubeMapSize, s_PrefilteredCubeMapSize, 1),
-                                  vk::Format::eB10G11R11UfloatPack32, vk::ImageUsageFlagBits::eTransferDst,
-                                  vk::SamplerCreateInfo()
-                                      .setAddressModeU(vk::SamplerAddressMode::eClampToEdge)
-                                      .setAddressModeV(vk::SamplerAddressMode::eClampToEdge)
-                                      .setAddressModeW(vk::SamplerAddressMode::eClampToEdge)
-                                      .setMagFilter(vk::Filter::eLinear)
-                                      .setMinFilter(vk::Filter::eLinear)
-                                      .setMipmapMode(vk::SamplerMipmapMode::eLinear)
-                                      .setMinLod(0.0f)
-                                      .setMaxLod(vk::LodClampNone),
-                                  6, vk::SampleCountFlagBits::e1, EResourceCreateBits::RESOURCE_CREATE_CREATE_MIPS_BIT, s_CubemapMipCount));
-
         // Convolute environment cubemap into prefiltered cubemap.
         pc.SrcTextureID = envCubeMap->GetBindlessTextureID();
 
@@ -528,18 +725,6 @@ namespace Radiant
         executionContext.CommandBuffer.endDebugUtilsLabelEXT();
 #endif
 
-        // Final convoluted environment map.
-        auto irradianceCubemap = MakeUnique<GfxTexture>(
-            device, GfxTextureDescription(vk::ImageType::e2D, glm::uvec3(s_IrradianceCubeMapSize, s_IrradianceCubeMapSize, 1),
-                                          vk::Format::eB10G11R11UfloatPack32, vk::ImageUsageFlagBits::eColorAttachment,
-                                          vk::SamplerCreateInfo()
-                                              .setAddressModeU(vk::SamplerAddressMode::eClampToEdge)
-                                              .setAddressModeV(vk::SamplerAddressMode::eClampToEdge)
-                                              .setAddressModeW(vk::SamplerAddressMode::eClampToEdge)
-                                              .setMagFilter(vk::Filter::eLinear)
-                                              .setMinFilter(vk::Filter::eLinear),
-                                          6, vk::SampleCountFlagBits::e1));
-
         // Convolute environment cubemap into irradiance cubemap.
         pc.SrcTextureID = envCubeMap->GetBindlessTextureID();
         pc.Data1        = 1.0f / static_cast<f32>(s_FromEquirectangularCubeMapSize);
@@ -604,22 +789,8 @@ namespace Radiant
         executionContext.CommandBuffer.end();
         m_GfxContext->SubmitImmediateExecuteContext(executionContext);
 
-        const auto ExtractBaseFilenameFunc = [](const std::string& path) -> std::string
-        {
-            const auto lastSlashPositionIndex = path.find_last_of('/');
-            const auto startPositionIndex     = (lastSlashPositionIndex != std::string::npos) ? lastSlashPositionIndex + 1 : 0;
-
-            const auto dotPositionIndex = path.find_last_of('.');
-            if (dotPositionIndex == std::string::npos) return path.substr(startPositionIndex);
-            return path.substr(startPositionIndex, dotPositionIndex - startPositionIndex);  // Returns actual file name without extension.
-        };
-        const auto environmentMapName = ExtractBaseFilenameFunc(std::string(equirectangularMapPath));
-
-        const auto irradianceCubemapName = environmentMapName + "_Irradiance";
-        device->SetDebugName(irradianceCubemapName.data(), (const vk::Image&)*irradianceCubemap);
-
-        const auto prefilteredCubemapName = environmentMapName + "_Prefiltered";
-        device->SetDebugName(prefilteredCubemapName.data(), (const vk::Image&)*prefilteredCubemap);
+        GfxTextureUtils::SaveTextureSnapshot(irradianceCachePath, cacheKey, *irradianceCubemap);
+        GfxTextureUtils::SaveTextureSnapshot(prefilteredCachePath, cacheKey, *prefilteredCubemap);
 
         return {std::move(irradianceCubemap), std::move(prefilteredCubemap)};
     }
@@ -48,6 +48,15 @@ namespace Radiant
 
         NODISCARD Shaders::CameraData GetShaderMainCameraData() const noexcept;
 
+        // NOTE: Decomposes render objects TRS with global mesh transform applied on top, call when either of them changes.
+        void UpdateObjectInstances(const f32 meshScale, const glm::vec3& meshTranslation, const glm::vec3& meshRotation) noexcept;
+
+        // Gathers object instances in current render objects order, so draw of object i fetches its instance by first instance = i.
+        void UploadObjectInstances(const Unique<GfxBuffer>& objectInstanceBuffer) const noexcept;
+
+        // NOTE: Split-sum BRDF integration LUT(R16G16Unorm), loaded from disk cache when possible.
+        NODISCARD Unique<GfxTexture> GenerateBRDFLut() noexcept;
+
         // Returns
         // 1) Irradiance Cube Map(approximated indirect diffuse lighting portion of environment)
         // 2) Prefiltered Cube Map(approximated indirect specular part of environment lighting)
@@ -60,13 +60,6 @@ namespace Radiant
         }
         bParticleCreationQueued = mainWindow->IsMouseButtonPressed(GLFW_MOUSE_BUTTON_2);
 
-        static bool bHotReloadQueued{false};
-        if (bHotReloadQueued && mainWindow->IsKeyReleased(GLFW_KEY_V))  // Check state frame before and current
-        {
-            m_Point2DPipeline->HotReload();
-        }
-        bHotReloadQueued = mainWindow->IsKeyPressed(GLFW_KEY_V);
-
         struct MainPassData
         {
             RGResourceID Point2DBuffer;
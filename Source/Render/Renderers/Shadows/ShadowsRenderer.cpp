@@ -9,6 +9,7 @@ namespace Radiant
     {
         const std::string LightBuffer{"Resource_Light_Buffer"};
         const std::string CameraBuffer{"Resource_Camera_Buffer"};
+        const std::string ObjectInstanceBuffer{"Resource_Object_Instance_Buffer"};
 
         const std::string CSMDataBuffer{"Resource_CSMDataBuffer"};
         const std::string ShadowsDepthBoundsBuffer{"Resource_Shadows_Depth_Bounds_Buffer"};
@@ -28,6 +29,10 @@ namespace Radiant
     static glm::vec3 s_MeshTranslation{0.0f, 0.0f, 0.0f};
     static glm::vec3 s_MeshRotation{0.0f, 0.0f, 0.0f};
 
+    static bool s_bEnableMeshLODs{true};
+    static f32 s_LODErrorThresholdPixels{1.0f};  // Max on-screen deviation LOD is allowed to have.
+    static i32 s_ShadowLODBias{1};               // Shadow casters are drawn coarser than main view.
+
     static bool s_bComputeTightBounds{true};  // switches whole csm pipeline to GPU.(setup shadows, etc..)
     static bool s_bCascadeTexelSizedIncrements{true};
     static f32 s_CascadeSplitDelta{0.95f};
@@ -39,6 +44,20 @@ namespace Radiant
     // for sdsm d16 could be enough
     static vk::Format s_CSMTextureFormat = vk::Format::eD16Unorm /*eD32Sfloat*/;
 
+    static const std::string s_DepthReductionPassName{"ShadowsDepthReductionPass"};
+    // NOTE: Workgroup sizes kernel autotuner picks from, the first one matches shader defaults.
+    static const auto s_DepthReductionKernelVariants = []() noexcept
+    {
+        std::vector<GfxKernelVariant> variants{};
+        for (const auto& workGroupSize : {glm::uvec2(16, 16), glm::uvec2(8, 8), glm::uvec2(16, 8), glm::uvec2(32, 8), glm::uvec2(8, 32)})
+        {
+            variants.emplace_back(std::format("{}x{}", workGroupSize.x, workGroupSize.y),
+                                  GfxSpecializationConstants{{DEPTH_REDUCTION_WG_SIZE_X_CONSTANT_ID, workGroupSize.x},
+                                                             {DEPTH_REDUCTION_WG_SIZE_Y_CONSTANT_ID, workGroupSize.y}});
+        }
+        return variants;
+    }();
+
     ShadowsRenderer::ShadowsRenderer() noexcept
     {
         m_MainCamera = MakeShared<Camera>(70.0f, static_cast<f32>(m_ViewportExtent.width) / static_cast<f32>(m_ViewportExtent.height),
@@ -90,12 +109,20 @@ namespace Radiant
         thingsToPrepare.emplace_back(Application::Get().GetThreadPool()->Submit(
             [&]() noexcept
             {
-                const GfxPipelineDescription pipelineDesc = {
-                    .DebugName       = "DepthBoundsCompute",
-                    .PipelineOptions = GfxComputePipelineOptions{},
-                    .Shader          = MakeShared<GfxShader>(m_GfxContext->GetDevice(),
-                                                    GfxShaderDescription{.Path = "../Assets/Shaders/shadows/depth_reduction.slang"})};
-                m_DepthBoundsComputePipeline = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                const auto depthReductionShader = MakeShared<GfxShader>(
+                    m_GfxContext->GetDevice(), GfxShaderDescription{.Path = "../Assets/Shaders/shadows/depth_reduction.slang"});
+
+                m_DepthBoundsComputePipelines.resize(s_DepthReductionKernelVariants.size());
+                for (const auto variantIndex :
+                     m_GfxContext->GetKernelAutotuner()->RegisterKernel(s_DepthReductionPassName, s_DepthReductionKernelVariants))
+                {
+                    const auto& variant                       = s_DepthReductionKernelVariants[variantIndex];
+                    const GfxPipelineDescription pipelineDesc = {
+                        .DebugName       = "DepthBoundsCompute[" + variant.Name + "]",
+                        .PipelineOptions = GfxComputePipelineOptions{.SpecializationConstants = variant.SpecializationConstants},
+                        .Shader          = depthReductionShader};
+                    m_DepthBoundsComputePipelines[variantIndex] = MakeUnique<GfxPipeline>(m_GfxContext->GetDevice(), pipelineDesc);
+                }
             }));
 
         // SetupShadows GPU.
@@ -161,6 +188,7 @@ namespace Radiant
 
                 m_Scene->LoadMesh(m_GfxContext, "../Assets/Models/bistro_exterior/scene.gltf");
                 m_Scene->IterateObjects(m_DrawContext);
+                UpdateObjectInstances(s_MeshScale, s_MeshTranslation, s_MeshRotation);
             }));
 
         const auto rendererPrepareBeginTime = Timer::Now();
@@ -172,22 +200,18 @@ namespace Radiant
 
     void ShadowsRenderer::RenderFrame() noexcept
     {
-        auto& mainWindow = Application::Get().GetMainWindow();
-
         s_DrawCallCount = 0;
 
-        static bool bHotReloadQueued{false};
-        if (bHotReloadQueued && mainWindow->IsKeyReleased(GLFW_KEY_V))  // Check state frame before and current
+        // NOTE: Object instances are gathered into per-frame buffer, so they only need refresh when global mesh transform changes.
         {
-            //   m_DepthPrePassPipeline->HotReload();
-            m_MainLightingPassPipeline->HotReload();
-            m_FinalPassPipeline->HotReload();
-
-            m_DepthBoundsComputePipeline->HotReload();
-            m_ShadowsSetupPipeline->HotReload();
-            // m_CSMPipeline->HotReload();
+            static auto s_ObjectInstancesMeshTransform = std::make_tuple(s_MeshScale, s_MeshTranslation, s_MeshRotation);
+            const auto meshTransform                   = std::make_tuple(s_MeshScale, s_MeshTranslation, s_MeshRotation);
+            if (meshTransform != s_ObjectInstancesMeshTransform)
+            {
+                UpdateObjectInstances(s_MeshScale, s_MeshTranslation, s_MeshRotation);
+                s_ObjectInstancesMeshTransform = meshTransform;
+            }
         }
-        bHotReloadQueued = mainWindow->IsKeyPressed(GLFW_KEY_V);
 
         // Sort transparent objects back to front.
         std::sort(std::execution::par, m_DrawContext.RenderObjects.begin(), m_DrawContext.RenderObjects.end(),
@@ -205,10 +229,45 @@ namespace Radiant
                       return lhs.AlphaMode < rhs.AlphaMode;
                   });
 
+        // NOTE: LOD is picked once per frame out of main view, so depth prepass and main pass(equal depth test) stay in sync, shadow
+        // passes reuse it with bias. Picked LOD is the coarsest one whose object space error projects under the pixel threshold.
+        {
+            const glm::mat4 meshRotation = glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
+                                           glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
+                                           glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+            const f32 projectionScale  = m_MainCamera->GetProjectionMatrix()[1][1] * 0.5f * static_cast<f32>(m_ViewportExtent.height);
+            const auto& cameraPosition = m_MainCamera->GetPosition();
+            std::for_each(std::execution::par, m_DrawContext.RenderObjects.begin(), m_DrawContext.RenderObjects.end(),
+                          [&](RenderObject& ro)
+                          {
+                              ro.LODIndex = 0;
+                              if (!s_bEnableMeshLODs) return;
+
+                              const glm::mat4 modelMatrix = ro.TRS * meshRotation;
+                              const glm::vec3 axisScale{glm::length(glm::vec3(modelMatrix[0])), glm::length(glm::vec3(modelMatrix[1])),
+                                                        glm::length(glm::vec3(modelMatrix[2]))};
+                              const f32 maxScale = glm::max(glm::max(axisScale.x, axisScale.y), axisScale.z) * s_MeshScale;
+
+                              const glm::vec3 center =
+                                  glm::vec3(modelMatrix * glm::vec4(ro.Bounds.Origin * s_MeshScale, 1.0f)) + s_MeshTranslation;
+                              const f32 distance = glm::max(glm::distance(center, cameraPosition) - ro.Bounds.Radius * maxScale,
+                                                            Shaders::s_KINDA_SMALL_NUMBER);
+
+                              for (u32 lodIndex{1}; lodIndex < ro.LODs.size(); ++lodIndex)
+                              {
+                                  const f32 projectedError = ro.LODs[lodIndex].Error * maxScale / distance * projectionScale;
+                                  if (projectedError > s_LODErrorThresholdPixels) break;
+
+                                  ro.LODIndex = lodIndex;
+                              }
+                          });
+        }
+
         struct FramePreparePassData
         {
             RGResourceID CameraBuffer;
             RGResourceID LightBuffer;
+            RGResourceID ObjectInstanceBuffer;
         } fpPassData = {};
         m_RenderGraph->AddPass(
             "FramePreparePass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
@@ -227,6 +286,14 @@ namespace Radiant
                                                             EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
                 fpPassData.LightBuffer =
                     scheduler.WriteBuffer(ResourceNames::LightBuffer, EResourceStateBits::RESOURCE_STATE_UNIFORM_BUFFER_BIT);
+
+                const u64 objectCount = glm::max(m_DrawContext.RenderObjects.size(), static_cast<size_t>(1));
+                scheduler.CreateBuffer(ResourceNames::ObjectInstanceBuffer,
+                                       GfxBufferDescription(objectCount * sizeof(ObjectInstanceData), sizeof(ObjectInstanceData),
+                                                            vk::BufferUsageFlagBits::eStorageBuffer,
+                                                            EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_RESIZABLE_BAR_BIT));
+                fpPassData.ObjectInstanceBuffer =
+                    scheduler.WriteBuffer(ResourceNames::ObjectInstanceBuffer, EResourceStateBits::RESOURCE_STATE_STORAGE_BUFFER_BIT);
             },
             [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
             {
@@ -236,11 +303,14 @@ namespace Radiant
 
                 auto& lightUBO = scheduler.GetBuffer(fpPassData.LightBuffer);
                 lightUBO->SetData(m_LightData.get(), sizeof(Shaders::LightData));
+
+                UploadObjectInstances(scheduler.GetBuffer(fpPassData.ObjectInstanceBuffer));
             });
 
         struct DepthPrePassData
         {
             RGResourceID CameraBuffer;
+            RGResourceID ObjectInstanceBuffer;
         } depthPrePassData = {};
         m_RenderGraph->AddPass(
             "DepthPrePass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
@@ -262,6 +332,8 @@ namespace Radiant
 
                 depthPrePassData.CameraBuffer =
                     scheduler.ReadBuffer(ResourceNames::CameraBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+                depthPrePassData.ObjectInstanceBuffer = scheduler.ReadBuffer(
+                    ResourceNames::ObjectInstanceBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
 
                 scheduler.SetViewportScissors(
                     vk::Viewport().setMinDepth(0.0f).setMaxDepth(1.0f).setWidth(m_ViewportExtent.width).setHeight(m_ViewportExtent.height),
@@ -272,32 +344,22 @@ namespace Radiant
                 auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
                 pipelineStateCache.Bind(cmd, m_DepthPrePassPipeline.get());
 
-                auto& cameraUBO = scheduler.GetBuffer(depthPrePassData.CameraBuffer);
-                for (const auto& ro : m_DrawContext.RenderObjects)
+                auto& cameraUBO            = scheduler.GetBuffer(depthPrePassData.CameraBuffer);
+                auto& objectInstanceBuffer = scheduler.GetBuffer(depthPrePassData.ObjectInstanceBuffer);
+                for (u32 objectIndex{}; objectIndex < m_DrawContext.RenderObjects.size(); ++objectIndex)
                 {
+                    const auto& ro = m_DrawContext.RenderObjects[objectIndex];
                     if (ro.AlphaMode != EAlphaMode::ALPHA_MODE_OPAQUE) continue;
 
                     struct PushConstantBlock
                     {
-                        glm::vec3 scale{1.f};
-                        glm::vec3 translation{0.0f};
-                        float4 orientation{1};
+                        const ObjectInstanceData* Instances{nullptr};
                         glm::mat4 ViewProjectionMatrix{1.f};
-                        const VertexPosition* VtxPositions{nullptr};
+                        const DepthOnlyVertexPosition* VtxPositions{nullptr};
                     } pc = {};
 
-                    glm::quat q{1.0f, 0.0f, 0.0f, 0.0f};
-                    glm::vec3 decomposePlaceholder0{1.0f};
-                    glm::vec4 decomposePlaceholder1{1.0f};
-                    glm::decompose(ro.TRS * glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f)),
-                                   pc.scale, q, pc.translation, decomposePlaceholder0, decomposePlaceholder1);
-                    pc.scale *= s_MeshScale;
-                    pc.translation += s_MeshTranslation;
-                    pc.orientation = glm::vec4(q.w, q.x, q.y, q.z);
-
-                    pc.VtxPositions         = (const VertexPosition*)ro.VertexPositionBuffer->GetBDA();
+                    pc.Instances            = (const ObjectInstanceData*)objectInstanceBuffer->GetBDA();
+                    pc.VtxPositions         = (const DepthOnlyVertexPosition*)ro.DepthOnlyVertexPositionBuffer->GetBDA() + ro.VertexOffset;
                     pc.ViewProjectionMatrix = m_MainCamera->GetViewProjectionMatrix();
 
                     pipelineStateCache.Set(cmd, ro.CullMode);
@@ -306,7 +368,8 @@ namespace Radiant
                     cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                          vk::ShaderStageFlagBits::eAll, 0, pc);
                     pipelineStateCache.Bind(cmd, ro.IndexBuffer.get(), 0, ro.IndexType);
-                    cmd.drawIndexed(ro.IndexCount, 1, ro.FirstIndex, 0, 0);
+                    const auto& lod = ro.GetLOD();
+                    cmd.drawIndexed(lod.IndexCount, 1, lod.FirstIndex, 0, objectIndex);
                 }
             });
 
@@ -325,7 +388,7 @@ namespace Radiant
         if (s_bComputeTightBounds)
         {
             m_RenderGraph->AddPass(
-                "ShadowsDepthReductionPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
+                s_DepthReductionPassName, ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
                 [&](RenderGraphResourceScheduler& scheduler)
                 {
                     scheduler.CreateBuffer(ResourceNames::ShadowsDepthBoundsBuffer,
@@ -348,7 +411,8 @@ namespace Radiant
                 [&](const RenderGraphResourceScheduler& scheduler, const vk::CommandBuffer& cmd)
                 {
                     auto& pipelineStateCache = m_GfxContext->GetPipelineStateCache();
-                    pipelineStateCache.Bind(cmd, m_DepthBoundsComputePipeline.get());
+                    const auto variantIndex  = m_GfxContext->GetKernelAutotuner()->GetVariantIndex(s_DepthReductionPassName);
+                    pipelineStateCache.Bind(cmd, m_DepthBoundsComputePipelines[variantIndex].get());
 
                     struct PushConstantBlock
                     {
@@ -368,8 +432,13 @@ namespace Radiant
 
                     cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                          vk::ShaderStageFlagBits::eAll, 0, pc);
-                    cmd.dispatch(glm::ceil(dimensions.x / (f32)DEPTH_REDUCTION_WG_SIZE_X),
-                                 glm::ceil(dimensions.y / (f32)DEPTH_REDUCTION_WG_SIZE_Y), 1);
+                    const auto& specializationConstants = s_DepthReductionKernelVariants[variantIndex].SpecializationConstants;
+                    const auto workGroupSize            = glm::uvec2(
+                        GfxShaderUtils::GetSpecializationConstant(specializationConstants, DEPTH_REDUCTION_WG_SIZE_X_CONSTANT_ID,
+                                                                  DEPTH_REDUCTION_WG_SIZE_X),
+                        GfxShaderUtils::GetSpecializationConstant(specializationConstants, DEPTH_REDUCTION_WG_SIZE_Y_CONSTANT_ID,
+                                                                  DEPTH_REDUCTION_WG_SIZE_Y));
+                    cmd.dispatch(glm::ceil(dimensions.x / (f32)workGroupSize.x), glm::ceil(dimensions.y / (f32)workGroupSize.y), 1);
                 });
 
             m_RenderGraph->AddPass(
@@ -424,6 +493,7 @@ namespace Radiant
         struct CascadedShadowMapsPassData
         {
             RGResourceID CSMDataBuffer;
+            RGResourceID ObjectInstanceBuffer;
         };
         std::array<CascadedShadowMapsPassData, SHADOW_MAP_CASCADE_COUNT> cmsPassDatas{};
 
@@ -473,6 +543,9 @@ namespace Radiant
                                                 vk::AttachmentLoadOp::eNoneKHR, vk::AttachmentStoreOp::eNone, cascadeIndex);
                 }
 
+                cmsPassDatas[0].ObjectInstanceBuffer = scheduler.ReadBuffer(
+                    ResourceNames::ObjectInstanceBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+
                 scheduler.SetViewportScissors(
                     vk::Viewport().setMinDepth(0.0f).setMaxDepth(1.0f).setWidth(SHADOW_MAP_CASCADE_SIZE).setHeight(SHADOW_MAP_CASCADE_SIZE),
                     vk::Rect2D().setExtent(vk::Extent2D().setWidth(SHADOW_MAP_CASCADE_SIZE).setHeight(SHADOW_MAP_CASCADE_SIZE)));
@@ -495,43 +568,37 @@ namespace Radiant
                     csmDataBuffer->SetData(&csmShaderData, sizeof(csmShaderData));  // NOTE: will be used further in main pass
                 }
 
-                for (const auto& ro : m_DrawContext.RenderObjects)
+                auto& objectInstanceBuffer = scheduler.GetBuffer(cmsPassDatas[0].ObjectInstanceBuffer);
+                for (u32 objectIndex{}; objectIndex < m_DrawContext.RenderObjects.size(); ++objectIndex)
                 {
+                    const auto& ro = m_DrawContext.RenderObjects[objectIndex];
                     if (ro.AlphaMode != EAlphaMode::ALPHA_MODE_OPAQUE) continue;
 
                     struct PushConstantBlock
                     {
-                        glm::vec3 scale{1.0f};
-                        glm::vec3 translation{0.0f};
-                        float4 orientation{1.0f};
+                        const ObjectInstanceData* Instances{nullptr};
                         const Shaders::CascadedShadowMapsData* CSMData{nullptr};
-                        const VertexPosition* VtxPositions{nullptr};
+                        const DepthOnlyVertexPosition* VtxPositions{nullptr};
+                        u32 CascadeMask{(1u << SHADOW_MAP_CASCADE_COUNT) - 1};  // No culling here, every cascade is drawn.
                     } pc = {};
-                    glm::quat q{1.0f, 0.0f, 0.0f, 0.0f};
-                    glm::vec3 decomposePlaceholder0{1.0f};
-                    glm::vec4 decomposePlaceholder1{1.0f};
-                    glm::decompose(ro.TRS * glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f)),
-                                   pc.scale, q, pc.translation, decomposePlaceholder0, decomposePlaceholder1);
-                    pc.scale *= s_MeshScale;
-                    pc.translation += s_MeshTranslation;
-                    pc.orientation = glm::vec4(q.w, q.x, q.y, q.z);
 
+                    pc.Instances    = (const ObjectInstanceData*)objectInstanceBuffer->GetBDA();
                     pc.CSMData      = (const Shaders::CascadedShadowMapsData*)csmDataBuffer->GetBDA();
-                    pc.VtxPositions = (const VertexPosition*)ro.VertexPositionBuffer->GetBDA();
+                    pc.VtxPositions = (const DepthOnlyVertexPosition*)ro.DepthOnlyVertexPositionBuffer->GetBDA() + ro.VertexOffset;
 
                     pipelineStateCache.Set(cmd, ro.PrimitiveTopology);
                     cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                          vk::ShaderStageFlagBits::eAll, 0, pc);
                     pipelineStateCache.Bind(cmd, ro.IndexBuffer.get(), 0, ro.IndexType);
-                    cmd.drawIndexed(ro.IndexCount, 1, ro.FirstIndex, 0, 0);
+                    const auto& lod = ro.GetLOD(static_cast<u32>(s_ShadowLODBias));
+                    cmd.drawIndexed(lod.IndexCount, 1, lod.FirstIndex, 0, objectIndex);
                 }
             });
 
         struct MainPassShaderData
         {
             const Shaders::CascadedShadowMapsData* CSMData{nullptr};
+            u32* TextureStreamingFeedback{nullptr};
             u32 ShadowMapTextureArrayID{0};
         };
 
@@ -544,6 +611,7 @@ namespace Radiant
             RGResourceID CSMShadowMapTextureArray;
             RGResourceID CSMDataBuffer;
             RGResourceID MainPassShaderDataBuffer;
+            RGResourceID ObjectInstanceBuffer;
         } mainPassData = {};
         m_RenderGraph->AddPass(
             "MainPass", ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL,
@@ -583,6 +651,9 @@ namespace Radiant
                         scheduler.ReadTexture(ResourceNames::CSMShadowMapTexture, MipSet::FirstMip(),
                                               EResourceStateBits::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE_BIT, cascadeIndex);
 
+                mainPassData.ObjectInstanceBuffer = scheduler.ReadBuffer(
+                    ResourceNames::ObjectInstanceBuffer, EResourceStateBits::RESOURCE_STATE_VERTEX_SHADER_RESOURCE_BIT);
+
                 scheduler.SetViewportScissors(
                     vk::Viewport().setMinDepth(0.0f).setMaxDepth(1.0f).setWidth(m_ViewportExtent.width).setHeight(m_ViewportExtent.height),
                     vk::Rect2D().setExtent(m_ViewportExtent));
@@ -600,19 +671,21 @@ namespace Radiant
                 MainPassShaderData mpsData      = {};
                 mpsData.ShadowMapTextureArrayID = scheduler.GetTexture(mainPassData.CSMShadowMapTextureArray)->GetBindlessTextureID();
                 mpsData.CSMData = (const Shaders::CascadedShadowMapsData*)scheduler.GetBuffer(mainPassData.CSMDataBuffer)->GetBDA();
+                mpsData.TextureStreamingFeedback = (u32*)m_GfxContext->GetTextureStreamer()->GetFeedbackBufferBDA();
 
                 mainPassShaderDataBuffer->SetData(&mpsData, sizeof(mpsData));
-                for (const auto& ro : m_DrawContext.RenderObjects)
+
+                auto& objectInstanceBuffer = scheduler.GetBuffer(mainPassData.ObjectInstanceBuffer);
+                for (u32 objectIndex{}; objectIndex < m_DrawContext.RenderObjects.size(); ++objectIndex)
                 {
+                    const auto& ro = m_DrawContext.RenderObjects[objectIndex];
                     ++s_DrawCallCount;
 
                     struct PushConstantBlock
                     {
-                        glm::vec3 scale{1.f};
-                        glm::vec3 translation{0.0f};
-                        float4 orientation{1};
+                        const ObjectInstanceData* Instances{nullptr};
                         const Shaders::CameraData* CameraData{nullptr};
-                        const VertexPosition* VtxPositions{nullptr};
+                        const DepthOnlyVertexPosition* VtxPositions{nullptr};
                         const VertexAttribute* VtxAttributes{nullptr};
                         const Shaders::GLTFMaterial* MaterialData{nullptr};
                         const Shaders::LightData* LightData{nullptr};
@@ -622,20 +695,10 @@ namespace Radiant
                     pc.MPSData    = (const MainPassShaderData*)mainPassShaderDataBuffer->GetBDA();
                     pc.LightData  = (const Shaders::LightData*)lightUBO->GetBDA();
                     pc.CameraData = (const Shaders::CameraData*)cameraUBO->GetBDA();
+                    pc.Instances  = (const ObjectInstanceData*)objectInstanceBuffer->GetBDA();
 
-                    glm::quat q{1.0f, 0.0f, 0.0f, 0.0f};
-                    glm::vec3 decomposePlaceholder0{1.0f};
-                    glm::vec4 decomposePlaceholder1{1.0f};
-                    glm::decompose(ro.TRS * glm::rotate(glm::radians(s_MeshRotation.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
-                                       glm::rotate(glm::radians(s_MeshRotation.z), glm::vec3(0.0f, 0.0f, 1.0f)),
-                                   pc.scale, q, pc.translation, decomposePlaceholder0, decomposePlaceholder1);
-                    pc.scale *= s_MeshScale;
-                    pc.translation += s_MeshTranslation;
-                    pc.orientation = glm::vec4(q.w, q.x, q.y, q.z);
-
-                    pc.VtxPositions  = (const VertexPosition*)ro.VertexPositionBuffer->GetBDA();
-                    pc.VtxAttributes = (const VertexAttribute*)ro.VertexAttributeBuffer->GetBDA();
+                    pc.VtxPositions  = (const DepthOnlyVertexPosition*)ro.DepthOnlyVertexPositionBuffer->GetBDA() + ro.VertexOffset;
+                    pc.VtxAttributes = (const VertexAttribute*)ro.VertexAttributeBuffer->GetBDA() + ro.VertexOffset;
                     pc.MaterialData  = (const Shaders::GLTFMaterial*)ro.MaterialBuffer->GetBDA();
 
                     const auto currentDepthCompareOp =
@@ -647,7 +710,8 @@ namespace Radiant
                     cmd.pushConstants<PushConstantBlock>(m_GfxContext->GetDevice()->GetBindlessPipelineLayout(),
                                                          vk::ShaderStageFlagBits::eAll, 0, pc);
                     pipelineStateCache.Bind(cmd, ro.IndexBuffer.get(), 0, ro.IndexType);
-                    cmd.drawIndexed(ro.IndexCount, 1, ro.FirstIndex, 0, 0);
+                    const auto& lod = ro.GetLOD();
+                    cmd.drawIndexed(lod.IndexCount, 1, lod.FirstIndex, 0, objectIndex);
                 }
             });
 
@@ -757,6 +821,45 @@ namespace Radiant
                         ImGui::TreePop();
                     }
 
+                    if (ImGui::TreeNodeEx("Texture Streaming Statistics", ImGuiTreeNodeFlags_Framed))
+                    {
+                        const auto textureStreamingStatistics = m_GfxContext->GetTextureStreamer()->GetStatistics();
+                        ImGui::Text("Streamed Textures: %zu", textureStreamingStatistics.StreamedTextureCount);
+                        ImGui::Text("Resident Size: %.3f MB", textureStreamingStatistics.ResidentSizeBytes / 1024.0 / 1024.0);
+                        ImGui::Text("Budget Size: %.3f MB", textureStreamingStatistics.BudgetSizeBytes / 1024.0 / 1024.0);
+
+                        ImGui::TreePop();
+                    }
+
+                    if (ImGui::TreeNodeEx("Geometry Pool Statistics", ImGuiTreeNodeFlags_Framed))
+                    {
+                        const auto geometryPoolStatistics = m_GfxContext->GetGeometryPool()->GetStatistics();
+                        ImGui::Text("Vertices: %zu/%zu", geometryPoolStatistics.UsedVertexCount, geometryPoolStatistics.VertexCapacity);
+                        ImGui::Text("Indices: %zu/%zu", geometryPoolStatistics.UsedIndexCount, geometryPoolStatistics.IndexCapacity);
+                        ImGui::Text("Free Vertex Blocks: %zu", geometryPoolStatistics.FreeVertexBlockCount);
+                        ImGui::Text("Free Index Blocks: %zu", geometryPoolStatistics.FreeIndexBlockCount);
+
+                        ImGui::TreePop();
+                    }
+
+                    if (ImGui::TreeNodeEx("Pipeline Cache Statistics", ImGuiTreeNodeFlags_Framed))
+                    {
+                        const auto pipelineCacheStatistics = m_GfxContext->GetPipelineManifest()->GetCacheStatistics();
+                        ImGui::Text("Hits since warm-up: %u", pipelineCacheStatistics.HitCount);
+                        ImGui::Text("Misses since warm-up: %u", pipelineCacheStatistics.MissCount);
+
+                        if (const auto& pipelineLibraryCache = m_GfxContext->GetPipelineLibraryCache(); pipelineLibraryCache)
+                        {
+                            const auto pipelineLibraryStatistics = pipelineLibraryCache->GetStatistics();
+                            ImGui::Text("Pipeline library parts: %u, reused: %u", pipelineLibraryStatistics.LibraryCount,
+                                        pipelineLibraryStatistics.ReuseCount);
+                        }
+                        else
+                            ImGui::Text("Pipeline libraries aren't supported, pipelines are monolithic.");
+
+                        ImGui::TreePop();
+                    }
+
                     ImGui::Separator();
                     if (ImGui::TreeNodeEx("RenderGraph Statistics", ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_DefaultOpen))
                     {
@@ -798,6 +901,16 @@ namespace Radiant
                     ImGui::TreePop();
                 }
 
+                ImGui::Separator();
+                if (ImGui::TreeNodeEx("Mesh LODs", ImGuiTreeNodeFlags_Framed))
+                {
+                    ImGui::Checkbox("Enable LODs", &s_bEnableMeshLODs);
+                    ImGui::DragFloat("LOD Error Threshold(pixels)", &s_LODErrorThresholdPixels, 0.05f, 0.0f, 32.0f);
+                    ImGui::SliderInt("Shadow LOD Bias", &s_ShadowLODBias, 0, s_MaxMeshLODCount - 1);
+
+                    ImGui::TreePop();
+                }
+
                 ImGui::Separator();
                 if (ImGui::TreeNodeEx("Cascaded Shadow Maps", ImGuiTreeNodeFlags_Framed))
                 {
@@ -17,7 +17,7 @@ namespace Radiant
       private:
         Unique<GfxPipeline> m_DepthPrePassPipeline{nullptr};
 
-        Unique<GfxPipeline> m_DepthBoundsComputePipeline{nullptr};
+        std::vector<Unique<GfxPipeline>> m_DepthBoundsComputePipelines{};  // Per kernel variant, only ones picked by autotuner are built.
         Unique<GfxPipeline> m_ShadowsSetupPipeline{nullptr};
         Unique<GfxPipeline> m_CSMPipeline{nullptr};
 
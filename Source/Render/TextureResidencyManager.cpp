@@ -0,0 +1,124 @@
+#include "TextureResidencyManager.hpp"
+
+namespace Radiant
+{
+
+    void TextureResidencyManager::RegisterTexture(const u32 textureID, const std::vector<u64>& mipSizesBytes,
+                                                  const u8 residentBaseMip) noexcept
+    {
+        RDNT_ASSERT(!m_Textures.contains(textureID), "Texture is already registered!");
+        RDNT_ASSERT(residentBaseMip < mipSizesBytes.size(), "Resident base mip is out of range!");
+
+        auto& texture            = m_Textures[textureID];
+        texture.MipSizesBytes    = mipSizesBytes;
+        texture.ResidentBaseMip  = residentBaseMip;
+        texture.RequestedBaseMip = residentBaseMip;
+        texture.TailBaseMip      = residentBaseMip;
+
+        m_ResidentSizeBytes += GetSizeBytes(texture, residentBaseMip);
+    }
+
+    void TextureResidencyManager::UnregisterTexture(const u32 textureID) noexcept
+    {
+        const auto it = m_Textures.find(textureID);
+        if (it == m_Textures.end()) return;
+
+        m_ResidentSizeBytes -= GetSizeBytes(it->second, it->second.ResidentBaseMip);
+        m_Textures.erase(it);
+    }
+
+    void TextureResidencyManager::ProcessFeedback(const std::span<const u32> feedback, const u64 frameNumber) noexcept
+    {
+        for (auto& [textureID, texture] : m_Textures)
+        {
+            if (textureID >= feedback.size() || feedback[textureID] == 0) continue;
+
+            // NOTE: Feedback stores requested top mip dimension in log2, so (MipCount - 1) - log2 is the wanted base mip.
+            const i32 topMipLog2       = static_cast<i32>(texture.MipSizesBytes.size()) - 1;
+            const i32 requestedBaseMip = topMipLog2 - static_cast<i32>(feedback[textureID] - 1);
+            texture.RequestedBaseMip   = static_cast<u8>(glm::clamp(requestedBaseMip, 0, static_cast<i32>(texture.TailBaseMip)));
+            texture.LastRequestedFrame = frameNumber;
+        }
+    }
+
+    std::vector<TextureResidencyManager::ResidencyRequest> TextureResidencyManager::Update(const u64 maxStreamInSizeBytes) noexcept
+    {
+        std::vector<std::pair<u32, TextureResidency*>> streamInCandidates{};
+        std::vector<std::pair<u32, TextureResidency*>> evictionCandidates{};
+        for (auto& [textureID, texture] : m_Textures)
+        {
+            if (texture.RequestedBaseMip < texture.ResidentBaseMip) streamInCandidates.emplace_back(textureID, &texture);
+            if (texture.ResidentBaseMip < texture.TailBaseMip) evictionCandidates.emplace_back(textureID, &texture);
+        }
+        if (streamInCandidates.empty()) return {};
+
+        // Most recently requested first, then the ones that lack the most mips.
+        std::ranges::sort(streamInCandidates,
+                          [](const auto& lhs, const auto& rhs) noexcept
+                          {
+                              if (lhs.second->LastRequestedFrame != rhs.second->LastRequestedFrame)
+                                  return lhs.second->LastRequestedFrame > rhs.second->LastRequestedFrame;
+
+                              return lhs.second->ResidentBaseMip - lhs.second->RequestedBaseMip >
+                                     rhs.second->ResidentBaseMip - rhs.second->RequestedBaseMip;
+                          });
+        // Least recently requested first.
+        std::ranges::sort(evictionCandidates, [](const auto& lhs, const auto& rhs) noexcept
+                          { return lhs.second->LastRequestedFrame < rhs.second->LastRequestedFrame; });
+
+        std::vector<ResidencyRequest> requests{};
+        u64 streamInSizeBytes{0};
+        u32 evictionCandidateIndex{0};
+        for (auto& [textureID, texture] : streamInCandidates)
+        {
+            // NOTE: Texture could've been evicted by previous candidate.
+            if (texture->RequestedBaseMip >= texture->ResidentBaseMip) continue;
+
+            const u64 currentSizeBytes   = GetSizeBytes(*texture, texture->ResidentBaseMip);
+            const u64 requestedSizeBytes = GetSizeBytes(*texture, texture->RequestedBaseMip);
+            const u64 deltaSizeBytes     = requestedSizeBytes - currentSizeBytes;
+            if (streamInSizeBytes + deltaSizeBytes > maxStreamInSizeBytes) continue;
+
+            // NOTE: Evict only textures that weren't requested as recently as this one, otherwise we end up thrashing.
+            while (m_ResidentSizeBytes + deltaSizeBytes > m_BudgetSizeBytes && evictionCandidateIndex < evictionCandidates.size())
+            {
+                auto& [victimID, victim] = evictionCandidates[evictionCandidateIndex];
+                if (victim->LastRequestedFrame >= texture->LastRequestedFrame) break;
+
+                ++evictionCandidateIndex;
+                if (victim->ResidentBaseMip >= victim->TailBaseMip) continue;
+
+                m_ResidentSizeBytes -= GetSizeBytes(*victim, victim->ResidentBaseMip) - GetSizeBytes(*victim, victim->TailBaseMip);
+                victim->ResidentBaseMip  = victim->TailBaseMip;
+                victim->RequestedBaseMip = victim->TailBaseMip;
+                requests.emplace_back(victimID, victim->TailBaseMip);
+            }
+
+            if (m_ResidentSizeBytes + deltaSizeBytes > m_BudgetSizeBytes) continue;
+
+            m_ResidentSizeBytes += deltaSizeBytes;
+            streamInSizeBytes += deltaSizeBytes;
+            texture->ResidentBaseMip = texture->RequestedBaseMip;
+            requests.emplace_back(textureID, texture->ResidentBaseMip);
+        }
+
+        return requests;
+    }
+
+    u8 TextureResidencyManager::GetResidentBaseMip(const u32 textureID) const noexcept
+    {
+        const auto it = m_Textures.find(textureID);
+        RDNT_ASSERT(it != m_Textures.end(), "Texture isn't registered!");
+        return it->second.ResidentBaseMip;
+    }
+
+    u64 TextureResidencyManager::GetSizeBytes(const TextureResidency& texture, const u8 baseMip) noexcept
+    {
+        u64 sizeBytes{0};
+        for (u64 mipLevel{baseMip}; mipLevel < texture.MipSizesBytes.size(); ++mipLevel)
+            sizeBytes += texture.MipSizesBytes[mipLevel];
+
+        return sizeBytes;
+    }
+
+}  // namespace Radiant
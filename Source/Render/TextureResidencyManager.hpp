@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Core/Core.hpp>
+#include <span>
+
+namespace Radiant
+{
+
+    // NOTE: CPU-only part of texture streaming, knows nothing about GPU, so it can be fed with simulated feedback.
+    // Feedback entry is log2 of the largest mip dimension requested by shaders plus one(0 means texture wasn't sampled at all),
+    // see Shaders::RecordTextureStreamingFeedback(). Not thread-safe.
+    class TextureResidencyManager final : private Uncopyable, private Unmovable
+    {
+      public:
+        explicit TextureResidencyManager(const u64 budgetSizeBytes) noexcept : m_BudgetSizeBytes(budgetSizeBytes) {}
+        ~TextureResidencyManager() noexcept = default;
+
+        struct ResidencyRequest
+        {
+            u32 TextureID{0};
+            u8 NewBaseMip{0};  // Texture should have mips [NewBaseMip, MipCount) resident.
+        };
+
+        // NOTE: residentBaseMip is also the lowest quality texture can be evicted to, mips below it are always resident.
+        void RegisterTexture(const u32 textureID, const std::vector<u64>& mipSizesBytes, const u8 residentBaseMip) noexcept;
+        void UnregisterTexture(const u32 textureID) noexcept;
+
+        void ProcessFeedback(const std::span<const u32> feedback, const u64 frameNumber) noexcept;
+
+        // Returns residency changes that fit into budget, evicting least recently requested textures when needed.
+        // NOTE: Caller should apply all of them, since resident size is updated right away.
+        NODISCARD std::vector<ResidencyRequest> Update(const u64 maxStreamInSizeBytes) noexcept;
+
+        NODISCARD u8 GetResidentBaseMip(const u32 textureID) const noexcept;
+        NODISCARD FORCEINLINE auto GetResidentSizeBytes() const noexcept { return m_ResidentSizeBytes; }
+        NODISCARD FORCEINLINE auto GetBudgetSizeBytes() const noexcept { return m_BudgetSizeBytes; }
+        NODISCARD FORCEINLINE auto GetTextureCount() const noexcept { return m_Textures.size(); }
+
+      private:
+        struct TextureResidency
+        {
+            std::vector<u64> MipSizesBytes{};
+            u64 LastRequestedFrame{0};
+            u8 ResidentBaseMip{0};
+            u8 RequestedBaseMip{0};
+            u8 TailBaseMip{0};
+        };
+        UnorderedMap<u32, TextureResidency> m_Textures{};
+        u64 m_BudgetSizeBytes{0};
+        u64 m_ResidentSizeBytes{0};
+
+        constexpr TextureResidencyManager() noexcept = delete;
+        NODISCARD static u64 GetSizeBytes(const TextureResidency& texture, const u8 baseMip) noexcept;
+    };
+
+}  // namespace Radiant
@@ -0,0 +1,373 @@
+#include "BVH.hpp"
+
+#include <shadows/csm_defines.hpp>
+
+// NOTE: It assumes AVX2 instructions are supported.
+#define BVH_CULLING_USE_AVX2 1
+#if _MSC_VER && BVH_CULLING_USE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace Radiant
+{
+
+    namespace BVHUtils
+    {
+        enum class EFrustumTestResult : u8
+        {
+            FRUSTUM_TEST_RESULT_OUTSIDE,
+            FRUSTUM_TEST_RESULT_INTERSECT,
+            FRUSTUM_TEST_RESULT_INSIDE,
+        };
+
+        NODISCARD FORCEINLINE static AABB MakeEmptyAABB() noexcept
+        {
+            return {.Min = glm::vec3(std::numeric_limits<f32>::max()), .Max = glm::vec3(std::numeric_limits<f32>::lowest())};
+        }
+
+        FORCEINLINE static void GrowAABB(AABB& aabb, const Sphere& sphere) noexcept
+        {
+            aabb.Min = glm::min(aabb.Min, sphere.Origin - glm::vec3(sphere.Radius));
+            aabb.Max = glm::max(aabb.Max, sphere.Origin + glm::vec3(sphere.Radius));
+        }
+
+        FORCEINLINE static void GrowAABB(AABB& aabb, const AABB& other) noexcept
+        {
+            aabb.Min = glm::min(aabb.Min, other.Min);
+            aabb.Max = glm::max(aabb.Max, other.Max);
+        }
+
+        NODISCARD FORCEINLINE static f32 GetSurfaceArea(const AABB& aabb) noexcept
+        {
+            const glm::vec3 extent = glm::max(aabb.Max - aabb.Min, glm::vec3(0.0f));
+            return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+        }
+
+        // NOTE: Checks the most positive corner(along plane normal) first, if it's behind any plane box is outside, if the most
+        // negative one is in front of every plane box is fully inside.
+        NODISCARD static EFrustumTestResult TestAABB(const AABB& aabb, std::span<const glm::vec4> planes) noexcept
+        {
+            auto result = EFrustumTestResult::FRUSTUM_TEST_RESULT_INSIDE;
+            for (const auto& plane : planes)
+            {
+                const glm::vec3 normal{plane};
+                const glm::vec3 positiveCorner{glm::mix(aabb.Min, aabb.Max, glm::greaterThanEqual(normal, glm::vec3(0.0f)))};
+                if (glm::dot(normal, positiveCorner) + plane.w < 0.0f) return EFrustumTestResult::FRUSTUM_TEST_RESULT_OUTSIDE;
+
+                const glm::vec3 negativeCorner{glm::mix(aabb.Max, aabb.Min, glm::greaterThanEqual(normal, glm::vec3(0.0f)))};
+                if (glm::dot(normal, negativeCorner) + plane.w < 0.0f) result = EFrustumTestResult::FRUSTUM_TEST_RESULT_INTERSECT;
+            }
+
+            return result;
+        }
+
+    }  // namespace BVHUtils
+
+    void BVH::Build(std::span<const Sphere> primitiveBounds) noexcept
+    {
+        m_Nodes.clear();
+        m_PrimitiveIndices.resize(primitiveBounds.size());
+        std::iota(m_PrimitiveIndices.begin(), m_PrimitiveIndices.end(), 0);
+        if (primitiveBounds.empty()) return;
+
+        m_Nodes.reserve(primitiveBounds.size() * 2 - 1);
+        m_Nodes.emplace_back(Node{.FirstPrimitive = 0, .PrimitiveCount = static_cast<u32>(primitiveBounds.size())});
+        BuildRecursive(0, primitiveBounds);
+
+        UpdateLeafSpheres(primitiveBounds);
+    }
+
+    void BVH::BuildRecursive(const u32 nodeIndex, std::span<const Sphere> primitiveBounds) noexcept
+    {
+        const u32 firstPrimitive = m_Nodes[nodeIndex].FirstPrimitive;
+        const u32 primitiveCount = m_Nodes[nodeIndex].PrimitiveCount;
+
+        AABB nodeBounds     = BVHUtils::MakeEmptyAABB();
+        AABB centroidBounds = BVHUtils::MakeEmptyAABB();
+        for (u32 i{firstPrimitive}; i < firstPrimitive + primitiveCount; ++i)
+        {
+            const auto& sphere = primitiveBounds[m_PrimitiveIndices[i]];
+            BVHUtils::GrowAABB(nodeBounds, sphere);
+            centroidBounds.Min = glm::min(centroidBounds.Min, sphere.Origin);
+            centroidBounds.Max = glm::max(centroidBounds.Max, sphere.Origin);
+        }
+        m_Nodes[nodeIndex].Bounds = nodeBounds;
+        if (primitiveCount == 1) return;
+
+        // Binned SAH, cost of split is sum of child primitive counts weighted by child surface areas.
+        struct Bin
+        {
+            AABB Bounds{BVHUtils::MakeEmptyAABB()};
+            u32 PrimitiveCount{0};
+        };
+
+        u32 bestAxis{0};
+        u32 bestSplit{0};
+        f32 bestCost{std::numeric_limits<f32>::max()};
+        const glm::vec3 centroidExtent = centroidBounds.Max - centroidBounds.Min;
+        for (u32 axis{}; axis < 3; ++axis)
+        {
+            if (centroidExtent[axis] <= Shaders::s_KINDA_SMALL_NUMBER) continue;
+
+            std::array<Bin, s_SAHBinCount> bins{};
+            const f32 binScale = static_cast<f32>(s_SAHBinCount) / centroidExtent[axis];
+            for (u32 i{firstPrimitive}; i < firstPrimitive + primitiveCount; ++i)
+            {
+                const auto& sphere = primitiveBounds[m_PrimitiveIndices[i]];
+                const u32 binIndex =
+                    glm::min(static_cast<u32>((sphere.Origin[axis] - centroidBounds.Min[axis]) * binScale), s_SAHBinCount - 1);
+                BVHUtils::GrowAABB(bins[binIndex].Bounds, sphere);
+                ++bins[binIndex].PrimitiveCount;
+            }
+
+            // Sweep from both sides, split i puts bins [0, i) to the left.
+            std::array<f32, s_SAHBinCount> leftCosts{};
+            AABB leftBounds = BVHUtils::MakeEmptyAABB();
+            u32 leftCount{0};
+            for (u32 i{1}; i < s_SAHBinCount; ++i)
+            {
+                BVHUtils::GrowAABB(leftBounds, bins[i - 1].Bounds);
+                leftCount += bins[i - 1].PrimitiveCount;
+                leftCosts[i] = leftCount == 0 ? 0.0f : leftCount * BVHUtils::GetSurfaceArea(leftBounds);
+            }
+
+            AABB rightBounds = BVHUtils::MakeEmptyAABB();
+            u32 rightCount{0};
+            for (u32 i{s_SAHBinCount - 1}; i > 0; --i)
+            {
+                BVHUtils::GrowAABB(rightBounds, bins[i].Bounds);
+                rightCount += bins[i].PrimitiveCount;
+                if (rightCount == 0 || rightCount == primitiveCount) continue;
+
+                const f32 cost = leftCosts[i] + rightCount * BVHUtils::GetSurfaceArea(rightBounds);
+                if (cost >= bestCost) continue;
+
+                bestCost  = cost;
+                bestAxis  = axis;
+                bestSplit = i;
+            }
+        }
+
+        const f32 leafCost = primitiveCount * BVHUtils::GetSurfaceArea(nodeBounds);
+        if (primitiveCount <= s_MaxLeafPrimitiveCount && bestCost >= leafCost) return;
+
+        const auto primitivesBegin = m_PrimitiveIndices.begin() + firstPrimitive;
+        const auto primitivesEnd   = primitivesBegin + primitiveCount;
+        u32 leftCount{0};
+        if (bestSplit != 0)
+        {
+            const f32 binScale    = static_cast<f32>(s_SAHBinCount) / centroidExtent[bestAxis];
+            const auto IsLeftFunc = [&](const u32 primitiveIndex)
+            {
+                const f32 centroid = primitiveBounds[primitiveIndex].Origin[bestAxis];
+                const u32 binIndex = glm::min(static_cast<u32>((centroid - centroidBounds.Min[bestAxis]) * binScale), s_SAHBinCount - 1);
+                return binIndex < bestSplit;
+            };
+            leftCount = static_cast<u32>(std::partition(primitivesBegin, primitivesEnd, IsLeftFunc) - primitivesBegin);
+        }
+        else
+        {
+            // NOTE: Every centroid falls into the same spot, so leaf size limit is kept by splitting in half.
+            leftCount = primitiveCount / 2;
+        }
+
+        const u32 leftChild = static_cast<u32>(m_Nodes.size());
+        m_Nodes.emplace_back(Node{.FirstPrimitive = firstPrimitive, .PrimitiveCount = leftCount});
+        BuildRecursive(leftChild, primitiveBounds);
+
+        const u32 rightChild = static_cast<u32>(m_Nodes.size());
+        m_Nodes.emplace_back(Node{.FirstPrimitive = firstPrimitive + leftCount, .PrimitiveCount = primitiveCount - leftCount});
+        BuildRecursive(rightChild, primitiveBounds);
+
+        m_Nodes[nodeIndex].LeftChild  = leftChild;
+        m_Nodes[nodeIndex].RightChild = rightChild;
+    }
+
+    void BVH::Refit(std::span<const Sphere> primitiveBounds) noexcept
+    {
+        RDNT_ASSERT(primitiveBounds.size() == m_PrimitiveIndices.size(), "BVH: Refit primitive count doesn't match the built one!");
+
+        for (u32 nodeIndex{static_cast<u32>(m_Nodes.size())}; nodeIndex > 0; --nodeIndex)
+        {
+            auto& node = m_Nodes[nodeIndex - 1];
+
+            node.Bounds = BVHUtils::MakeEmptyAABB();
+            if (node.LeftChild == 0)
+            {
+                for (u32 i{node.FirstPrimitive}; i < node.FirstPrimitive + node.PrimitiveCount; ++i)
+                    BVHUtils::GrowAABB(node.Bounds, primitiveBounds[m_PrimitiveIndices[i]]);
+            }
+            else
+            {
+                BVHUtils::GrowAABB(node.Bounds, m_Nodes[node.LeftChild].Bounds);
+                BVHUtils::GrowAABB(node.Bounds, m_Nodes[node.RightChild].Bounds);
+            }
+        }
+
+        UpdateLeafSpheres(primitiveBounds);
+    }
+
+    void BVH::UpdateLeafSpheres(std::span<const Sphere> primitiveBounds) noexcept
+    {
+        const size_t paddedPrimitiveCount = m_PrimitiveIndices.size() + s_MaxLeafPrimitiveCount - 1;
+        m_CenterX.assign(paddedPrimitiveCount, 0.0f);
+        m_CenterY.assign(paddedPrimitiveCount, 0.0f);
+        m_CenterZ.assign(paddedPrimitiveCount, 0.0f);
+        m_Radius.assign(paddedPrimitiveCount, 0.0f);
+        for (size_t i{}; i < m_PrimitiveIndices.size(); ++i)
+        {
+            const auto& sphere = primitiveBounds[m_PrimitiveIndices[i]];
+            m_CenterX[i]       = sphere.Origin.x;
+            m_CenterY[i]       = sphere.Origin.y;
+            m_CenterZ[i]       = sphere.Origin.z;
+            m_Radius[i]        = sphere.Radius;
+        }
+    }
+
+    void BVH::Cull(std::span<const glm::vec4> planes, std::vector<u32>& visiblePrimitives) const noexcept
+    {
+        if (m_Nodes.empty()) return;
+
+        std::vector<u32> nodeStack;
+        nodeStack.reserve(64);
+        nodeStack.emplace_back(0);
+        while (!nodeStack.empty())
+        {
+            const auto& node = m_Nodes[nodeStack.back()];
+            nodeStack.pop_back();
+
+            const auto testResult = BVHUtils::TestAABB(node.Bounds, planes);
+            if (testResult == BVHUtils::EFrustumTestResult::FRUSTUM_TEST_RESULT_OUTSIDE) continue;
+
+            // Whole subtree is visible, its primitives are contiguous.
+            if (testResult == BVHUtils::EFrustumTestResult::FRUSTUM_TEST_RESULT_INSIDE)
+            {
+                visiblePrimitives.insert(visiblePrimitives.end(), m_PrimitiveIndices.begin() + node.FirstPrimitive,
+                                         m_PrimitiveIndices.begin() + node.FirstPrimitive + node.PrimitiveCount);
+                continue;
+            }
+
+            if (node.LeftChild == 0)
+            {
+                CullLeaf(node, planes, visiblePrimitives);
+                continue;
+            }
+
+            nodeStack.emplace_back(node.RightChild);
+            nodeStack.emplace_back(node.LeftChild);
+        }
+    }
+
+    void BVH::CullLeaf(const Node& node, std::span<const glm::vec4> planes, std::vector<u32>& visiblePrimitives) const noexcept
+    {
+        RDNT_ASSERT(node.PrimitiveCount <= s_MaxLeafPrimitiveCount, "BVH: Leaf holds more primitives than SIMD lane count!");
+
+#if _MSC_VER && BVH_CULLING_USE_AVX2
+        const __m256 centerX   = _mm256_loadu_ps(&m_CenterX[node.FirstPrimitive]);
+        const __m256 centerY   = _mm256_loadu_ps(&m_CenterY[node.FirstPrimitive]);
+        const __m256 centerZ   = _mm256_loadu_ps(&m_CenterZ[node.FirstPrimitive]);
+        const __m256 negRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(&m_Radius[node.FirstPrimitive]));
+
+        __m256 visibleMask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (const auto& plane : planes)
+        {
+            __m256 distance = _mm256_mul_ps(centerX, _mm256_set1_ps(plane.x));
+            distance        = _mm256_add_ps(distance, _mm256_mul_ps(centerY, _mm256_set1_ps(plane.y)));
+            distance        = _mm256_add_ps(distance, _mm256_mul_ps(centerZ, _mm256_set1_ps(plane.z)));
+            distance        = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+            visibleMask     = _mm256_and_ps(visibleMask, _mm256_cmp_ps(distance, negRadius, _CMP_GE_OQ));
+        }
+
+        u32 visibleBits = static_cast<u32>(_mm256_movemask_ps(visibleMask)) & ((1u << node.PrimitiveCount) - 1);
+        while (visibleBits != 0)
+        {
+            visiblePrimitives.emplace_back(m_PrimitiveIndices[node.FirstPrimitive + std::countr_zero(visibleBits)]);
+            visibleBits &= visibleBits - 1;
+        }
+#else
+        for (u32 i{node.FirstPrimitive}; i < node.FirstPrimitive + node.PrimitiveCount; ++i)
+        {
+            const glm::vec3 center{m_CenterX[i], m_CenterY[i], m_CenterZ[i]};
+            const bool bVisible = std::all_of(planes.begin(), planes.end(), [&](const glm::vec4& plane)
+                                              { return glm::dot(glm::vec3(plane), center) + plane.w >= -m_Radius[i]; });
+            if (bVisible) visiblePrimitives.emplace_back(m_PrimitiveIndices[i]);
+        }
+#endif
+    }
+
+    namespace BVHUtils
+    {
+
+        void RunCullBenchmark(std::span<const u32> instanceCounts, const u32 iterationCount) noexcept
+        {
+            RDNT_ASSERT(iterationCount > 0, "Iteration count should be > 0!");
+
+            const auto MeasureCullFunc = [&](const BVH& bvh, std::span<const glm::vec4> planes, std::vector<u32>& visiblePrimitives)
+            {
+                const Timer cullTimer{};
+                for (u32 i{}; i < iterationCount; ++i)
+                {
+                    visiblePrimitives.clear();
+                    bvh.Cull(planes, visiblePrimitives);
+                }
+                return cullTimer.GetElapsedMilliseconds() / static_cast<f64>(iterationCount);
+            };
+
+            std::mt19937 randomEngine{1337};
+            std::vector<u32> visiblePrimitives{};
+            for (const u32 instanceCount : instanceCounts)
+            {
+                // NOTE: Scene grows with instance count, so density and visible fraction of each view stay roughly the same.
+                const f32 sceneHalfExtent = 100.0f * std::cbrt(static_cast<f32>(instanceCount) / 10000.0f);
+                std::uniform_real_distribution<f32> positionDistribution(-sceneHalfExtent, sceneHalfExtent);
+                std::uniform_real_distribution<f32> radiusDistribution(0.1f, 2.0f);
+
+                std::vector<Sphere> primitiveBounds(instanceCount);
+                for (auto& sphere : primitiveBounds)
+                {
+                    sphere.Origin = glm::vec3(positionDistribution(randomEngine), positionDistribution(randomEngine),
+                                              positionDistribution(randomEngine));
+                    sphere.Radius = radiusDistribution(randomEngine);
+                }
+
+                BVH bvh{};
+                Timer timer{};
+                bvh.Build(primitiveBounds);
+                const f64 buildTime = timer.GetElapsedMilliseconds();
+
+                for (auto& sphere : primitiveBounds)
+                    sphere.Origin += glm::vec3(0.5f, 0.0f, 0.0f);
+                timer.Reset();
+                bvh.Refit(primitiveBounds);
+                const f64 refitTime = timer.GetElapsedMilliseconds();
+
+                LOG_INFO("BVH cull benchmark [{} instances, {} nodes]:", instanceCount, bvh.GetNodeCount());
+                LOG_INFO("\tbuild: {:.3f} ms, refit: {:.3f} ms", buildTime, refitTime);
+
+                const glm::mat4 mainView   = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+                const auto mainViewPlanes  =
+                    Math::ExtractFrustumPlanes(glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, sceneHalfExtent) * mainView);
+                const f64 mainViewCullTime = MeasureCullFunc(bvh, mainViewPlanes, visiblePrimitives);
+                LOG_INFO("\tmain view: avg {:.3f} ms, {} visible", mainViewCullTime, visiblePrimitives.size());
+
+                // NOTE: Cascades look along sun direction, each one twice as wide as previous, the last one spans the whole scene.
+                const glm::vec3 sunDirection = glm::normalize(glm::vec3(0.3f, -1.0f, 0.2f));
+                const glm::mat4 sunView      = glm::lookAt(-sunDirection * sceneHalfExtent, glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+                for (u32 cascadeIndex{}; cascadeIndex < SHADOW_MAP_CASCADE_COUNT; ++cascadeIndex)
+                {
+                    const f32 cascadeHalfExtent = sceneHalfExtent / static_cast<f32>(1u << (SHADOW_MAP_CASCADE_COUNT - 1 - cascadeIndex));
+                    const glm::mat4 cascadeViewProjection =
+                        glm::ortho(-cascadeHalfExtent, cascadeHalfExtent, -cascadeHalfExtent, cascadeHalfExtent, 0.0f,
+                                   2.0f * sceneHalfExtent) *
+                        sunView;
+                    const auto cascadePlanes = Math::ExtractFrustumPlanes(cascadeViewProjection);
+                    const f64 cascadeCullTime =
+                        MeasureCullFunc(bvh, std::span<const glm::vec4>(cascadePlanes).first(4), visiblePrimitives);
+                    LOG_INFO("\tcascade {}: avg {:.3f} ms, {} visible", cascadeIndex, cascadeCullTime, visiblePrimitives.size());
+                }
+            }
+        }
+
+    }  // namespace BVHUtils
+
+}  // namespace Radiant
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+
+namespace Radiant
+{
+
+    // NOTE: Binary BVH over world space bounding spheres, built with binned SAH. Nodes are stored depth first, so every node covers
+    // contiguous range of primitives and parents always come before their children(refit is a single reverse pass).
+    // Leaves hold at most 8 primitives, their spheres are kept in SoA and culled at once with AVX2.
+    class BVH final : private Uncopyable
+    {
+      public:
+        BVH() noexcept  = default;
+        ~BVH() noexcept = default;
+
+        void Build(std::span<const Sphere> primitiveBounds) noexcept;
+
+        // NOTE: Topology stays the same, only bounds are updated, primitive count must match the one BVH was built with.
+        void Refit(std::span<const Sphere> primitiveBounds) noexcept;
+
+        // Appends indices of primitives intersecting volume bounded by planes(xyz - normal pointing inside, w - distance).
+        void Cull(std::span<const glm::vec4> planes, std::vector<u32>& visiblePrimitives) const noexcept;
+
+        NODISCARD FORCEINLINE bool IsEmpty() const noexcept { return m_Nodes.empty(); }
+        NODISCARD FORCEINLINE u32 GetPrimitiveCount() const noexcept { return static_cast<u32>(m_PrimitiveIndices.size()); }
+        NODISCARD FORCEINLINE u32 GetNodeCount() const noexcept { return static_cast<u32>(m_Nodes.size()); }
+
+      private:
+        static constexpr u32 s_MaxLeafPrimitiveCount = 8;
+        static constexpr u32 s_SAHBinCount           = 16;
+
+        struct Node final
+        {
+            AABB Bounds{};
+            u32 FirstPrimitive{0};
+            u32 PrimitiveCount{0};
+            u32 LeftChild{0};  // 0 means leaf, right child is placed right after whole left subtree.
+            u32 RightChild{0};
+        };
+
+        std::vector<Node> m_Nodes;
+        std::vector<u32> m_PrimitiveIndices;  // Leaf order -> original primitive index.
+
+        // Leaf ordered primitive spheres, padded with 7 elements, so 8 wide loads from any leaf start stay in bounds.
+        std::vector<f32> m_CenterX;
+        std::vector<f32> m_CenterY;
+        std::vector<f32> m_CenterZ;
+        std::vector<f32> m_Radius;
+
+        void BuildRecursive(const u32 nodeIndex, std::span<const Sphere> primitiveBounds) noexcept;
+        void UpdateLeafSpheres(std::span<const Sphere> primitiveBounds) noexcept;
+        void CullLeaf(const Node& node, std::span<const glm::vec4> planes, std::vector<u32>& visiblePrimitives) const noexcept;
+    };
+
+    namespace BVHUtils
+    {
+
+        // NOTE: Headless, builds BVH over random spheres for every instance count, then reports build, refit and cull time per view:
+        // main view and every cascade, culled against side planes only, same way CombinedRenderer does.
+        void RunCullBenchmark(std::span<const u32> instanceCounts, const u32 iterationCount) noexcept;
+
+    }  // namespace BVHUtils
+
+}  // namespace Radiant
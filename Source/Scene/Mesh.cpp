@@ -1,4 +1,5 @@
 #include "Mesh.hpp"
+#include "VertexQuantization.hpp"
 
 #include <Core/Application.hpp>
 
@@ -141,9 +142,8 @@ namespace Radiant
             vertexStream = std::move(newVertexStream);
         }
 
-        template <typename IndexType>
-        static void OptimizeMesh(std::vector<IndexType>& indices, std::vector<VertexPosition>& vertexPositions,
-                                 std::vector<VertexAttribute>& vertexAttributes) noexcept
+        static void OptimizeMesh(std::vector<u32>& indices, std::vector<VertexPosition>& vertexPositions,
+                                 std::vector<VertexAttribute>& vertexAttributes, const std::vector<GeometryData>& surfaces) noexcept
         {
             RDNT_ASSERT(vertexPositions.size() == vertexAttributes.size(),
                         "VertexPositions size should be equal to VertexAttributes size!");
@@ -164,7 +164,70 @@ namespace Radiant
             RemapVertexStream(uniqueVertexCount, vertexAttributes, remap);
 
             // #2 VERTEX CACHE OPTIMIZATION (REORDER TRIANGLES TO MAXIMIZE THE LOCALITY OF REUSED VERTEX REFERENCES IN VERTEX SHADERS)
-            meshopt_optimizeVertexCache(indices.data(), indices.data(), indices.size(), vertexPositions.size());
+            // NOTE: Done per surface, so triangles don't migrate between surfaces(materials).
+            for (const auto& surface : surfaces)
+            {
+                if (surface.PrimitiveTopology != vk::PrimitiveTopology::eTriangleList) continue;
+
+                meshopt_optimizeVertexCache(indices.data() + surface.StartIndex, indices.data() + surface.StartIndex, surface.Count,
+                                            vertexPositions.size());
+            }
+        }
+
+        static constexpr f32 s_LODIndexReduction = 0.5f;   // Target index count of the next LOD relative to the previous one.
+        static constexpr f32 s_LODMinReduction   = 0.85f;  // LOD chain stops once simplifier can't get below this ratio.
+        static constexpr f32 s_LODTargetError    = 0.05f;  // Relative to mesh extents.
+        static constexpr u64 s_LODMinIndexCount  = 3 * 16;
+
+        // NOTE: Every LOD is simplified out of the previous one, so errors are summed up and scaled to object space, that way they can be
+        // projected on screen directly. LOD indices are appended past all LOD0 indices, so surface ranges stay untouched.
+        static void GenerateLODs(std::vector<u32>& indices, const std::vector<VertexPosition>& vertexPositions,
+                                 std::vector<GeometryData>& surfaces) noexcept
+        {
+            const f32 meshScale = meshopt_simplifyScale(&vertexPositions[0].Position.x, vertexPositions.size(), sizeof(VertexPosition));
+
+            std::vector<u32> lodIndices, prevLodIndices;
+            for (auto& surface : surfaces)
+            {
+                surface.LODs[0]  = {.FirstIndex = surface.StartIndex, .IndexCount = surface.Count, .Error = 0.0f};
+                surface.LODCount = 1;
+                if (surface.PrimitiveTopology != vk::PrimitiveTopology::eTriangleList) continue;
+
+                prevLodIndices.assign(indices.cbegin() + surface.StartIndex, indices.cbegin() + surface.StartIndex + surface.Count);
+                f32 lodError{0.0f};
+                while (surface.LODCount < s_MaxMeshLODCount)
+                {
+                    const u64 targetIndexCount = static_cast<u64>(prevLodIndices.size() * s_LODIndexReduction) / 3 * 3;
+                    if (targetIndexCount < s_LODMinIndexCount) break;
+
+                    // NOTE: Surfaces share vertices, so borders are locked first to avoid cracks between them, if the simplifier gets
+                    // stuck on them, they're released.
+                    const auto SimplifyFunc = [&](const u32 options, f32& resultError)
+                    {
+                        lodIndices.resize(prevLodIndices.size());
+                        const u64 lodIndexCount = meshopt_simplify(lodIndices.data(), prevLodIndices.data(), prevLodIndices.size(),
+                                                                   &vertexPositions[0].Position.x, vertexPositions.size(),
+                                                                   sizeof(VertexPosition), targetIndexCount, s_LODTargetError, options,
+                                                                   &resultError);
+                        lodIndices.resize(lodIndexCount);
+                    };
+
+                    const u64 maxLodIndexCount = static_cast<u64>(prevLodIndices.size() * s_LODMinReduction);
+                    f32 resultError{0.0f};
+                    SimplifyFunc(meshopt_SimplifyLockBorder, resultError);
+                    if (lodIndices.size() > maxLodIndexCount) SimplifyFunc(0, resultError);
+                    if (lodIndices.empty() || lodIndices.size() > maxLodIndexCount) break;
+
+                    meshopt_optimizeVertexCache(lodIndices.data(), lodIndices.data(), lodIndices.size(), vertexPositions.size());
+
+                    lodError += resultError * meshScale;
+                    surface.LODs[surface.LODCount++] = {.FirstIndex = static_cast<u32>(indices.size()),
+                                                        .IndexCount = static_cast<u32>(lodIndices.size()),
+                                                        .Error      = lodError};
+                    indices.insert(indices.end(), lodIndices.cbegin(), lodIndices.cend());
+                    std::swap(prevLodIndices, lodIndices);
+                }
+            }
         }
 
     }  // namespace MeshoptimizerUtils
@@ -239,6 +302,67 @@ namespace Radiant
 
         constexpr bool c_bGenerateMipMaps      = true;
         constexpr bool c_bUseSamplerAnisotropy = false;
+
+        struct ImageSource
+        {
+            std::string Name{};             // Relative uri path or "embedded/<content hash>", used as texture map and cache key.
+            std::string FilePath{};         // Empty for embedded images.
+            std::span<const u8> RawData{};  // Encoded(png/jpg) image bytes for embedded images.
+        };
+
+        NODISCARD static std::span<const u8> GetDataSourceBytes(const fastgltf::DataSource& dataSource) noexcept
+        {
+            std::span<const u8> bytes{};
+            std::visit(fastgltf::visitor{[](const auto& arg) {},
+                                         [&](const fastgltf::sources::Vector& vector)
+                                         { bytes = {reinterpret_cast<const u8*>(vector.bytes.data()), vector.bytes.size()}; },
+                                         [&](const fastgltf::sources::Array& array)
+                                         { bytes = {reinterpret_cast<const u8*>(array.bytes.data()), array.bytes.size()}; },
+                                         [&](const fastgltf::sources::ByteView& byteView)
+                                         { bytes = {reinterpret_cast<const u8*>(byteView.bytes.data()), byteView.bytes.size()}; }},
+                       dataSource);
+            return bytes;
+        }
+
+        // NOTE: Embedded images are decoded straight from GLB binary chunk(or decoded data uri) that fastgltf already holds in memory, so
+        // no file is touched per texture. Their name is a content hash, so the same image shared across assets is compressed only once.
+        NODISCARD static ImageSource ResolveImageSource(const fastgltf::Asset& asset, const fastgltf::Image& image,
+                                                        const std::filesystem::path& meshParentPath) noexcept
+        {
+            ImageSource imageSource = {};
+            std::visit(fastgltf::visitor{[&](const auto& arg) { imageSource.RawData = GetDataSourceBytes(image.data); },
+                                         [&](const fastgltf::sources::URI& filePath)
+                                         {
+                                             RDNT_ASSERT(filePath.fileByteOffset == 0, "fastgltf: We don't support offsets with stbi!");
+                                             RDNT_ASSERT(filePath.uri.isLocalPath(),
+                                                         "fastgltf: We're only capable of loading local files!");
+
+                                             imageSource.Name = filePath.uri.path();
+                                             RDNT_ASSERT(!imageSource.Name.empty(), "fastgltf: Texture name is empty!");
+
+                                             imageSource.FilePath = (meshParentPath / imageSource.Name).string();
+                                         },
+                                         [&](const fastgltf::sources::BufferView& view)
+                                         {
+                                             const auto& bufferView = asset.bufferViews[view.bufferViewIndex];
+                                             const auto bufferBytes = GetDataSourceBytes(asset.buffers[bufferView.bufferIndex].data);
+                                             RDNT_ASSERT(bufferView.byteOffset + bufferView.byteLength <= bufferBytes.size(),
+                                                         "fastgltf: Image buffer view is out of buffer bounds!");
+
+                                             imageSource.RawData = bufferBytes.subspan(bufferView.byteOffset, bufferView.byteLength);
+                                         }},
+                       image.data);
+
+            if (imageSource.FilePath.empty())
+            {
+                RDNT_ASSERT(!imageSource.RawData.empty(), "fastgltf: Unsupported image data source!");
+                imageSource.Name = "embedded/" + std::to_string(ankerl::unordered_dense::detail::wyhash::hash(imageSource.RawData.data(),
+                                                                                                           imageSource.RawData.size()));
+            }
+
+            return imageSource;
+        }
+
         // NOTE: For simplicity, usage of the same texture with multiple samplers isn't supported at least for now!
         NODISCARD static std::string LoadTexture(std::mutex& loaderMutex, UnorderedMap<std::string, Shared<GfxTexture>>& textureMap,
                                                  const std::filesystem::path& meshParentPath, const Unique<GfxContext>& gfxContext,
@@ -257,174 +381,147 @@ namespace Radiant
                 return defaultWhiteTextureName;
             }
 
-            std::string textureName{s_DEFAULT_STRING};
+            const auto imageSource  = ResolveImageSource(asset, asset.images[*texture.imageIndex], meshParentPath);
+            const bool bIsEmbedded  = !imageSource.RawData.empty();
+            const auto& textureName = imageSource.Name;
             Shared<GfxTexture> loadedTexture{nullptr};
-            std::visit(
-                fastgltf::visitor{
-                    [](auto& arg) { RDNT_ASSERT(false, "fastgltf: Default argument when loading image! This shouldn't happen!"); },
-                    [&](const fastgltf::sources::URI& filePath)
-                    {
-                        RDNT_ASSERT(filePath.fileByteOffset == 0, "fastgltf: We don't support offsets with stbi!");
-                        RDNT_ASSERT(filePath.uri.isLocalPath(), "fastgltf: We're only capable of loading local files!");
-
-                        textureName = filePath.uri.path();
-                        RDNT_ASSERT(!textureName.empty(), "fastgltf: Texture name is empty!");
-                        {
-                            std::scoped_lock lock(loaderMutex);  // Synchronizing access to textureMap by putting dummy(null) texture
-                            if (textureMap.contains(textureName))
-                                return;
-                            else
-                                textureMap[textureName] = loadedTexture;
-                        }
+            {
+                std::scoped_lock lock(loaderMutex);  // Synchronizing access to textureMap by putting dummy(null) texture
+                if (textureMap.contains(textureName))
+                    return textureName;
+                else
+                    textureMap[textureName] = loadedTexture;
+            }
 
-                        const auto textureFilePath = meshParentPath / textureName;
+            std::vector<GfxTextureUtils::TextureCompressor::TextureInfo> mips{};
+            if constexpr (s_bUseTextureCompressionBC)
+            {
+                // NOTE: Embedded images are cached by their content hash name.
+                mips = GfxTextureUtils::TextureCompressor::LoadTextureCache(bIsEmbedded ? textureName : imageSource.FilePath, format);
+            }
+            else
+            {
+                i32 width{1}, height{1}, channels{4};
 
-                        std::vector<GfxTextureUtils::TextureCompressor::TextureInfo> mips{};
-                        if constexpr (s_bUseTextureCompressionBC)
-                        {
-                            mips = GfxTextureUtils::TextureCompressor::LoadTextureCache(textureFilePath.string(), format);
-                        }
-                        else
-                        {
-                            i32 width{1}, height{1}, channels{4};
+                void* stbImageData =
+                    bIsEmbedded
+                        ? GfxTextureUtils::LoadImage(imageSource.RawData.data(), imageSource.RawData.size(), width, height, channels)
+                        : GfxTextureUtils::LoadImage(imageSource.FilePath, width, height, channels);
+                RDNT_ASSERT(stbImageData, "fastgltf: Failed to load image data!");
 
-                            void* stbImageData = GfxTextureUtils::LoadImage(textureFilePath.string(), width, height, channels);
-                            RDNT_ASSERT(stbImageData, "fastgltf: Failed to load image data!");
+                auto& mip      = mips.emplace_back();
+                mip.Dimensions = glm::uvec2{width, height};
 
-                            auto& mip      = mips.emplace_back();
-                            mip.Dimensions = glm::uvec2{width, height};
+                const auto stbImageDataSizeBytes = static_cast<u64>(width * height * channels * sizeof(u8));
+                mip.Data.resize(stbImageDataSizeBytes);
+                std::memcpy(mip.Data.data(), stbImageData, stbImageDataSizeBytes);
 
-                            const auto stbImageDataSizeBytes = static_cast<u64>(width * height * channels * sizeof(u8));
-                            mip.Data.resize(stbImageDataSizeBytes);
-                            std::memcpy(mip.Data.data(), stbImageData, stbImageDataSizeBytes);
+                GfxTextureUtils::UnloadImage(stbImageData);
+            }
 
-                            GfxTextureUtils::UnloadImage(stbImageData);
-                        }
+            if constexpr (s_bUseTextureStreaming && c_bGenerateMipMaps)
+            {
+                // NOTE: Only tail mips are uploaded right now, the rest is streamed on demand based on GPU feedback.
+                loadedTexture = gfxContext->GetTextureStreamer()->CreateStreamedTexture(textureName, std::move(mips), format, samplerCI);
 
-                        u32 width = mips[0].Dimensions.x, height = mips[0].Dimensions.y;
+                std::scoped_lock lock(loaderMutex);  // Synchronizing access to textureMap
+                textureMap[textureName] = loadedTexture;
+                return textureName;
+            }
 
-                        {
-                            std::scoped_lock lock(loaderMutex);  // Synchronizing access to textureMap by loading actual texture
-                            loadedTexture = MakeShared<GfxTexture>(
-                                gfxContext->GetDevice(),
-                                GfxTextureDescription(vk::ImageType::e2D, glm::uvec3(width, height, 1), format,
-                                                      vk::ImageUsageFlagBits::eTransferDst, samplerCI, 1, vk::SampleCountFlagBits::e1,
-                                                      EResourceCreateBits::RESOURCE_CREATE_DONT_TOUCH_SAMPLED_IMAGES_BIT |
-                                                          (c_bGenerateMipMaps ? EResourceCreateBits::RESOURCE_CREATE_CREATE_MIPS_BIT : 0)));
-                            textureMap[textureName] = loadedTexture;
-                            gfxContext->GetDevice()->SetDebugName(textureName, (const vk::Image&)*loadedTexture);
-                        }
+            u32 width = mips[0].Dimensions.x, height = mips[0].Dimensions.y;
 
-                        auto executionContext = gfxContext->CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
-                        executionContext.CommandBuffer.begin(
-                            vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
-
-                        // NOTE: Currently BCn mips are loaded by hand, and RGBA8 are blitted, so mipsToIterateCount will be > 1 for BCn.
-                        const u32 mipCount            = c_bGenerateMipMaps
-                                                            ? glm::max(GfxTextureUtils::GetMipLevelCount(width, height), static_cast<u32>(mips.size()))
-                                                            : 1;
-                        const auto mipsToIterateCount = s_bUseTextureCompressionBC ? mipCount : 1;
-
-                        executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
-                            vk::ImageMemoryBarrier2()
-                                .setImage(*loadedTexture)
-                                .setSubresourceRange(vk::ImageSubresourceRange()
-                                                         .setBaseArrayLayer(0)
-                                                         .setBaseMipLevel(0)
-                                                         .setLevelCount(mipCount)
-                                                         .setLayerCount(1)
-                                                         .setAspectMask(vk::ImageAspectFlagBits::eColor))
-                                .setOldLayout(vk::ImageLayout::eUndefined)
-                                .setSrcAccessMask(vk::AccessFlagBits2::eNone)
-                                .setSrcStageMask(vk::PipelineStageFlagBits2::eNone)
-                                .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
-                                .setDstAccessMask(vk::AccessFlagBits2::eTransferWrite)
-                                .setDstStageMask(vk::PipelineStageFlagBits2::eAllTransfer)));
-
-                        std::vector<Unique<GfxBuffer>> stagingBuffers(mipsToIterateCount);
-                        for (u32 i{}; i < mipsToIterateCount; ++i)
-                        {
-                            const u64 imageSize = mips[i].Data.size() * sizeof(mips[i].Data[0]);
-
-                            auto& stagingBuffer = stagingBuffers[i];
-                            stagingBuffer       = MakeUnique<GfxBuffer>(gfxContext->GetDevice(),
-                                                                  GfxBufferDescription(imageSize, /* placeholder */ 1,
-                                                                                             vk::BufferUsageFlagBits::eTransferSrc,
-                                                                                             EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
-                            stagingBuffer->SetData(mips[i].Data.data(), imageSize);
-
-                            executionContext.CommandBuffer.copyBufferToImage(
-                                *stagingBuffer, *loadedTexture, vk::ImageLayout::eTransferDstOptimal,
-                                vk::BufferImageCopy()
-                                    .setImageSubresource(vk::ImageSubresourceLayers()
-                                                             .setLayerCount(1)
-                                                             .setAspectMask(vk::ImageAspectFlagBits::eColor)
-                                                             .setBaseArrayLayer(0)
-                                                             .setMipLevel(i))
-                                    .setImageExtent(vk::Extent3D(mips[i].Dimensions.x, mips[i].Dimensions.y, 1)));
-                        }
+            // NOTE: Storage capable formats get their mips reduced on compute(GfxDownsampler), the rest(sRGB) is blitted mip by mip.
+            const bool bGenerateMipsOnCompute =
+                c_bGenerateMipMaps && !s_bUseTextureCompressionBC &&
+                static_cast<bool>(gfxContext->GetDevice()->GetPhysicalDevice().getFormatProperties(format).optimalTilingFeatures &
+                                  vk::FormatFeatureFlagBits::eStorageImage);
 
-                        if (c_bGenerateMipMaps && !s_bUseTextureCompressionBC)
-                            loadedTexture->GenerateMipMaps(executionContext.CommandBuffer);
-                        else
-                        {
-                            executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
-                                vk::ImageMemoryBarrier2()
-                                    .setImage(*loadedTexture)
-                                    .setSubresourceRange(vk::ImageSubresourceRange()
-                                                             .setBaseArrayLayer(0)
-                                                             .setBaseMipLevel(0)
-                                                             .setLevelCount(mipsToIterateCount)
-                                                             .setLayerCount(1)
-                                                             .setAspectMask(vk::ImageAspectFlagBits::eColor))
-                                    .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
-                                    .setSrcAccessMask(vk::AccessFlagBits2::eTransferWrite)
-                                    .setSrcStageMask(vk::PipelineStageFlagBits2::eCopy)
-                                    .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
-                                    .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
-                                    .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader |
-                                                     vk::PipelineStageFlagBits2::eComputeShader)));
-                        }
+            {
+                std::scoped_lock lock(loaderMutex);  // Synchronizing access to textureMap by loading actual texture
+                loadedTexture = MakeShared<GfxTexture>(
+                    gfxContext->GetDevice(),
+                    GfxTextureDescription(vk::ImageType::e2D, glm::uvec3(width, height, 1), format,
+                                          vk::ImageUsageFlagBits::eTransferDst |
+                                              (bGenerateMipsOnCompute ? vk::ImageUsageFlagBits::eStorage : vk::ImageUsageFlags{}),
+                                          samplerCI, 1, vk::SampleCountFlagBits::e1,
+                                          EResourceCreateBits::RESOURCE_CREATE_DONT_TOUCH_SAMPLED_IMAGES_BIT |
+                                              (c_bGenerateMipMaps ? EResourceCreateBits::RESOURCE_CREATE_CREATE_MIPS_BIT : 0) |
+                                              (bGenerateMipsOnCompute ? EResourceCreateBits::RESOURCE_CREATE_EXPOSE_MIPS_BIT : 0)));
+                textureMap[textureName] = loadedTexture;
+                gfxContext->GetDevice()->SetDebugName(textureName, (const vk::Image&)*loadedTexture);
+            }
 
-                        executionContext.CommandBuffer.end();
-                        GfxContext::Get().SubmitImmediateExecuteContext(executionContext);
-                    },
-                    [&](const fastgltf::sources::Vector& vector)
-                    {
-                        RDNT_ASSERT(false, "{}: NOT IMPLEMENTED!", __FUNCTION__);
+            auto executionContext = gfxContext->CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_GENERAL);
+            executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
 
-                        i32 width{1}, height{1}, channels{4};
+            // NOTE: Currently BCn mips are loaded by hand, and RGBA8 are blitted, so mipsToIterateCount will be > 1 for BCn.
+            const u32 mipCount =
+                c_bGenerateMipMaps ? glm::max(GfxTextureUtils::GetMipLevelCount(width, height), static_cast<u32>(mips.size())) : 1;
+            const auto mipsToIterateCount = s_bUseTextureCompressionBC ? mipCount : 1;
+
+            executionContext.CommandBuffer.pipelineBarrier2(
+                vk::DependencyInfo().setImageMemoryBarriers(vk::ImageMemoryBarrier2()
+                                                                .setImage(*loadedTexture)
+                                                                .setSubresourceRange(vk::ImageSubresourceRange()
+                                                                                         .setBaseArrayLayer(0)
+                                                                                         .setBaseMipLevel(0)
+                                                                                         .setLevelCount(mipCount)
+                                                                                         .setLayerCount(1)
+                                                                                         .setAspectMask(vk::ImageAspectFlagBits::eColor))
+                                                                .setOldLayout(vk::ImageLayout::eUndefined)
+                                                                .setSrcAccessMask(vk::AccessFlagBits2::eNone)
+                                                                .setSrcStageMask(vk::PipelineStageFlagBits2::eNone)
+                                                                .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
+                                                                .setDstAccessMask(vk::AccessFlagBits2::eTransferWrite)
+                                                                .setDstStageMask(vk::PipelineStageFlagBits2::eAllTransfer)));
+
+            std::vector<Unique<GfxBuffer>> stagingBuffers(mipsToIterateCount);
+            for (u32 i{}; i < mipsToIterateCount; ++i)
+            {
+                const u64 imageSize = mips[i].Data.size() * sizeof(mips[i].Data[0]);
+
+                auto& stagingBuffer = stagingBuffers[i];
+                stagingBuffer =
+                    MakeUnique<GfxBuffer>(gfxContext->GetDevice(), GfxBufferDescription(imageSize, /* placeholder */ 1,
+                                                                                        vk::BufferUsageFlagBits::eTransferSrc,
+                                                                                        EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
+                stagingBuffer->SetData(mips[i].Data.data(), imageSize);
+
+                executionContext.CommandBuffer.copyBufferToImage(
+                    *stagingBuffer, *loadedTexture, vk::ImageLayout::eTransferDstOptimal,
+                    vk::BufferImageCopy()
+                        .setImageSubresource(vk::ImageSubresourceLayers()
+                                                 .setLayerCount(1)
+                                                 .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                                 .setBaseArrayLayer(0)
+                                                 .setMipLevel(i))
+                        .setImageExtent(vk::Extent3D(mips[i].Dimensions.x, mips[i].Dimensions.y, 1)));
+            }
 
-                        void* imageData = GfxTextureUtils::LoadImage(vector.bytes.data(), vector.bytes.size(), width, height, channels);
-                        RDNT_ASSERT(imageData, "Failed to load image data!");
+            if (c_bGenerateMipMaps && !s_bUseTextureCompressionBC)
+                loadedTexture->GenerateMipMaps(executionContext.CommandBuffer);
+            else
+            {
+                executionContext.CommandBuffer.pipelineBarrier2(vk::DependencyInfo().setImageMemoryBarriers(
+                    vk::ImageMemoryBarrier2()
+                        .setImage(*loadedTexture)
+                        .setSubresourceRange(vk::ImageSubresourceRange()
+                                                 .setBaseArrayLayer(0)
+                                                 .setBaseMipLevel(0)
+                                                 .setLevelCount(mipsToIterateCount)
+                                                 .setLayerCount(1)
+                                                 .setAspectMask(vk::ImageAspectFlagBits::eColor))
+                        .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
+                        .setSrcAccessMask(vk::AccessFlagBits2::eTransferWrite)
+                        .setSrcStageMask(vk::PipelineStageFlagBits2::eCopy)
+                        .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                        .setDstAccessMask(vk::AccessFlagBits2::eShaderSampledRead)
+                        .setDstStageMask(vk::PipelineStageFlagBits2::eFragmentShader | vk::PipelineStageFlagBits2::eComputeShader)));
+            }
 
-                        GfxTextureUtils::UnloadImage(imageData);
-                    },
-                    [&](const fastgltf::sources::BufferView& view)
-                    {
-                        RDNT_ASSERT(false, "{}: NOT IMPLEMENTED!", __FUNCTION__);
-
-                        const auto& bufferView = asset.bufferViews[view.bufferViewIndex];
-                        const auto& buffer     = asset.buffers[bufferView.bufferIndex];
-
-                        i32 width{1}, height{1}, channels{4};
-                        std::visit(fastgltf::visitor{// We only care about VectorWithMime here, because we
-                                                     // specify LoadExternalBuffers, meaning all buffers
-                                                     // are already loaded into a vector.
-                                                     [](auto& arg) {},
-                                                     [&](fastgltf::sources::Vector& vector)
-                                                     {
-                                                         void* imageData =
-                                                             GfxTextureUtils::LoadImage(vector.bytes.data() + bufferView.byteOffset,
-                                                                                        bufferView.byteLength, width, height, channels);
-                                                         RDNT_ASSERT(imageData, "Failed to load image data!");
-
-                                                         GfxTextureUtils::UnloadImage(imageData);
-                                                     }},
-                                   buffer.data);
-                    },
-                },
-                asset.images[*texture.imageIndex].data);
+            executionContext.CommandBuffer.end();
+            GfxContext::Get().SubmitImmediateExecuteContext(executionContext);
 
             return textureName;
         }
@@ -447,7 +544,636 @@ namespace Radiant
 
     }  // namespace FastGltfUtils
 
-    Mesh::Mesh(const Unique<GfxContext>& gfxContext, const std::filesystem::path& meshFilePath) noexcept
+    namespace MeshCookUtils
+    {
+        // NOTE: Cooked mesh is a flat binary blob of final(remapped, vertex cache optimized, narrowed) vertex/index streams, surfaces and
+        // node hierarchy. Every section is aligned, so it's read in place straight out of the memory mapped file.
+        static constexpr u32 s_CookedMeshMagic            = 0x4B4D4452;  // "RDMK"
+        static constexpr u32 s_CookedMeshVersion          = 2;
+        static constexpr u64 s_CookedMeshSectionAlignment = 16;
+        static constexpr const char* s_CookedMeshDir      = "mesh_cache/";
+
+        struct CookedString
+        {
+            u64 Offset{0};
+            u64 Length{0};
+        };
+
+        struct CookedMeshHeader
+        {
+            u32 Magic{s_CookedMeshMagic};
+            u32 Version{s_CookedMeshVersion};
+            u64 SourceKey{0};
+            u64 FileSizeBytes{0};
+            u64 MeshesOffset{0};
+            u64 NodesOffset{0};
+            u32 MeshCount{0};
+            u32 NodeCount{0};
+        };
+
+        struct CookedMeshRecord
+        {
+            CookedString Name{};
+            u32 IndexType{static_cast<u32>(vk::IndexType::eNoneKHR)};
+            u32 SurfaceCount{0};
+            u64 SurfacesOffset{0};
+            u64 VertexCount{0};
+            u64 VertexPositionsOffset{0};
+            u64 VertexAttributesOffset{0};
+            u64 IndicesOffset{0};
+            u64 IndicesSizeBytes{0};
+        };
+
+        struct CookedNodeRecord
+        {
+            glm::mat4 LocalTransform{1.0f};
+            CookedString Name{};
+            i32 MeshIndex{-1};
+            u32 ChildCount{0};
+            u64 ChildrenOffset{0};
+        };
+
+        static_assert(std::is_trivially_copyable_v<GeometryData>, "GeometryData is written into cooked mesh as is!");
+
+        class CookedMeshWriter final
+        {
+          public:
+            CookedMeshWriter() noexcept { m_Data.resize(sizeof(CookedMeshHeader)); }
+            ~CookedMeshWriter() noexcept = default;
+
+            template <typename T> NODISCARD u64 Append(const T* data, const u64 count) noexcept
+            {
+                static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable!");
+
+                const u64 offset = CoreUtils::AlignSize(m_Data.size(), s_CookedMeshSectionAlignment);
+                m_Data.resize(offset + count * sizeof(T));
+                if (count != 0) std::memcpy(m_Data.data() + offset, data, count * sizeof(T));
+                return offset;
+            }
+
+            NODISCARD CookedString AppendString(const std::string_view& str) noexcept
+            {
+                return {.Offset = Append(str.data(), str.size()), .Length = str.size()};
+            }
+
+            NODISCARD std::vector<u8> Finalize(CookedMeshHeader header, const std::vector<CookedMeshRecord>& meshRecords,
+                                               const std::vector<CookedNodeRecord>& nodeRecords) noexcept
+            {
+                header.MeshCount     = static_cast<u32>(meshRecords.size());
+                header.MeshesOffset  = Append(meshRecords.data(), meshRecords.size());
+                header.NodeCount     = static_cast<u32>(nodeRecords.size());
+                header.NodesOffset   = Append(nodeRecords.data(), nodeRecords.size());
+                header.FileSizeBytes = m_Data.size();
+                std::memcpy(m_Data.data(), &header, sizeof(header));
+
+                return std::move(m_Data);
+            }
+
+          private:
+            std::vector<u8> m_Data;
+        };
+
+        NODISCARD static std::string GetCookedMeshPath(const std::filesystem::path& meshFilePath) noexcept
+        {
+            const auto meshFilePathString = meshFilePath.string();
+            return std::string(s_CookedMeshDir) + meshFilePath.stem().string() + "_" +
+                   std::to_string(ankerl::unordered_dense::detail::wyhash::hash(meshFilePathString.data(), meshFilePathString.size())) +
+                   ".rdmesh";
+        }
+
+        // NOTE: Key covers glTF itself and everything it references. Files are identified by path, size and modification time.
+        // External buffers are already loaded by fastgltf(their URIs are gone by then), so their bytes are hashed, which is still way
+        // cheaper than cooking. Embedded images live inside buffers or data URIs, so they're hashed the same way.
+        NODISCARD static u64 MakeCookedMeshSourceKey(const std::filesystem::path& meshFilePath, const fastgltf::Asset& asset) noexcept
+        {
+            u64 sourceKey{s_CookedMeshVersion};
+            const auto HashCombineFunc = [&](const u64 value) noexcept
+            {
+                const std::array<u64, 2> keyData = {sourceKey, value};
+                sourceKey                        = ankerl::unordered_dense::detail::wyhash::hash(keyData.data(), sizeof(keyData));
+            };
+            const auto HashFileFunc = [&](const std::filesystem::path& filePath) noexcept
+            {
+                const auto filePathString = filePath.string();
+                HashCombineFunc(ankerl::unordered_dense::detail::wyhash::hash(filePathString.data(), filePathString.size()));
+
+                // Missing file changes the key as well, glTF loader complains about it later.
+                std::error_code errorCode{};
+                const auto fileSize = std::filesystem::file_size(filePath, errorCode);
+                HashCombineFunc(errorCode ? 0 : static_cast<u64>(fileSize));
+
+                const auto lastWriteTime = std::filesystem::last_write_time(filePath, errorCode);
+                HashCombineFunc(errorCode ? 0 : static_cast<u64>(lastWriteTime.time_since_epoch().count()));
+            };
+            const auto HashDataSourceFunc = [&](const fastgltf::DataSource& dataSource) noexcept
+            {
+                if (const auto* uri = std::get_if<fastgltf::sources::URI>(&dataSource); uri)
+                {
+                    HashFileFunc(meshFilePath.parent_path() / std::string(uri->uri.path()));
+                    return;
+                }
+
+                const auto bytes = FastGltfUtils::GetDataSourceBytes(dataSource);
+                HashCombineFunc(ankerl::unordered_dense::detail::wyhash::hash(bytes.data(), bytes.size()));
+            };
+
+            HashFileFunc(meshFilePath);
+            for (const auto& buffer : asset.buffers)
+                HashDataSourceFunc(buffer.data);
+
+            // NOTE: Images referencing buffer views are covered by buffers.
+            for (const auto& image : asset.images)
+                if (!std::holds_alternative<fastgltf::sources::BufferView>(image.data)) HashDataSourceFunc(image.data);
+
+            return sourceKey;
+        }
+
+        NODISCARD static u64 GetIndexTypeSize(const vk::IndexType indexType) noexcept
+        {
+            switch (indexType)
+            {
+                case vk::IndexType::eUint8EXT: return sizeof(u8);
+                case vk::IndexType::eUint16: return sizeof(u16);
+                case vk::IndexType::eUint32: return sizeof(u32);
+                default: RDNT_ASSERT(false, "Unknown index type!"); return 0;
+            }
+        }
+
+        // NOTE: Section has to be aligned and fit into the file, it's read in place. Written so that corrupted counts can't overflow.
+        NODISCARD static bool IsCookedSectionValid(const std::span<const u8> cookedData, const u64 offset, const u64 count,
+                                                   const u64 elementSizeBytes) noexcept
+        {
+            if (offset % s_CookedMeshSectionAlignment != 0 || offset > cookedData.size()) return false;
+
+            return count <= (cookedData.size() - offset) / elementSizeBytes;
+        }
+
+        template <typename T>
+        NODISCARD static FORCEINLINE const T* GetCookedData(const std::span<const u8> cookedData, const u64 offset) noexcept
+        {
+            return reinterpret_cast<const T*>(cookedData.data() + offset);
+        }
+
+        NODISCARD static std::string_view GetCookedString(const std::span<const u8> cookedData, const CookedString& str) noexcept
+        {
+            return {GetCookedData<char>(cookedData, str.Offset), str.Length};
+        }
+
+        // NOTE: Cooked file comes from disk, so every offset, count and index is checked before LoadCookedMesh() trusts them.
+        NODISCARD static bool IsCookedMeshValid(const std::span<const u8> cookedData, const u64 sourceKey) noexcept
+        {
+            if (cookedData.size() < sizeof(CookedMeshHeader)) return false;
+
+            CookedMeshHeader header = {};
+            std::memcpy(&header, cookedData.data(), sizeof(header));
+            if (header.Magic != s_CookedMeshMagic || header.Version != s_CookedMeshVersion || header.SourceKey != sourceKey ||
+                header.FileSizeBytes != cookedData.size())
+                return false;
+
+            if (!IsCookedSectionValid(cookedData, header.MeshesOffset, header.MeshCount, sizeof(CookedMeshRecord)) ||
+                !IsCookedSectionValid(cookedData, header.NodesOffset, header.NodeCount, sizeof(CookedNodeRecord)))
+                return false;
+
+            const auto IsStringValidFunc = [&](const CookedString& str) noexcept
+            { return IsCookedSectionValid(cookedData, str.Offset, str.Length, sizeof(char)); };
+
+            const auto* meshRecords = GetCookedData<CookedMeshRecord>(cookedData, header.MeshesOffset);
+            for (u32 meshIndex{}; meshIndex < header.MeshCount; ++meshIndex)
+            {
+                const auto& meshRecord = meshRecords[meshIndex];
+                const auto indexType   = static_cast<vk::IndexType>(meshRecord.IndexType);
+                if (indexType != vk::IndexType::eUint8EXT && indexType != vk::IndexType::eUint16 && indexType != vk::IndexType::eUint32)
+                    return false;
+
+                if (!IsStringValidFunc(meshRecord.Name) ||
+                    !IsCookedSectionValid(cookedData, meshRecord.SurfacesOffset, meshRecord.SurfaceCount, sizeof(GeometryData)) ||
+                    !IsCookedSectionValid(cookedData, meshRecord.VertexPositionsOffset, meshRecord.VertexCount, sizeof(VertexPosition)) ||
+                    !IsCookedSectionValid(cookedData, meshRecord.VertexAttributesOffset, meshRecord.VertexCount, sizeof(VertexAttribute)) ||
+                    !IsCookedSectionValid(cookedData, meshRecord.IndicesOffset, meshRecord.IndicesSizeBytes, sizeof(u8)) ||
+                    meshRecord.IndicesSizeBytes % GetIndexTypeSize(indexType) != 0)
+                    return false;
+            }
+
+            const auto* nodeRecords = GetCookedData<CookedNodeRecord>(cookedData, header.NodesOffset);
+            for (u32 nodeIndex{}; nodeIndex < header.NodeCount; ++nodeIndex)
+            {
+                const auto& nodeRecord = nodeRecords[nodeIndex];
+                if (!IsStringValidFunc(nodeRecord.Name) || nodeRecord.MeshIndex < -1 ||
+                    nodeRecord.MeshIndex >= static_cast<i32>(header.MeshCount) ||
+                    !IsCookedSectionValid(cookedData, nodeRecord.ChildrenOffset, nodeRecord.ChildCount, sizeof(u32)))
+                    return false;
+
+                const auto* childIndices = GetCookedData<u32>(cookedData, nodeRecord.ChildrenOffset);
+                if (std::any_of(childIndices, childIndices + nodeRecord.ChildCount,
+                                [&](const u32 childIndex) noexcept { return childIndex >= header.NodeCount; }))
+                    return false;
+            }
+
+            return true;
+        }
+
+
+        // NOTE: Does all the heavy lifting: accessor decoding, octahedral encoding of normals/tangents, bounds generation, index
+        // narrowing and meshoptimizer passes.
+        NODISCARD static std::vector<u8> CookMesh(const fastgltf::Asset& asset, const u64 sourceKey) noexcept
+        {
+            CookedMeshWriter cookedMeshWriter = {};
+            std::vector<CookedMeshRecord> meshRecords;
+            meshRecords.reserve(asset.meshes.size());
+
+            // Use the same vectors for all meshes so that the memory doesn't reallocate as often.
+            std::vector<u32> indicesUint32;
+            std::vector<VertexPosition> vertexPositions;
+            std::vector<VertexAttribute> vertexAttributes;
+            std::vector<GeometryData> surfaces;
+            std::vector<VertexPosition> vertexPositionsPerPrimitive;  // Used only for bounding sphere generation.
+            for (const auto& fastgltfMesh : asset.meshes)
+            {
+                RDNT_ASSERT(!fastgltfMesh.name.empty(), "fastgltf: Mesh has no name!");
+
+                const std::string meshName{fastgltfMesh.name};
+                LOG_INFO("Loading submesh: {}", meshName);
+
+                indicesUint32.clear();
+                vertexPositions.clear();
+                vertexAttributes.clear();
+                surfaces.clear();
+
+                vk::IndexType indexType{vk::IndexType::eNoneKHR};
+                for (const auto& primitive : fastgltfMesh.primitives)
+                {
+                    RDNT_ASSERT(primitive.indicesAccessor.has_value(),
+                                "fastgltf: We specify GenerateMeshIndices, so we should always have indices!");
+                    const auto* positionIt = primitive.findAttribute("POSITION");
+                    RDNT_ASSERT(positionIt != primitive.attributes.end(),
+                                "fastgltf: A mesh primitive is required to hold the POSITION attribute.");
+
+                    vertexPositionsPerPrimitive.clear();
+                    surfaces.emplace_back(static_cast<u32>(indicesUint32.size()),
+                                          static_cast<u32>(asset.accessors[*primitive.indicesAccessor].count), Sphere{},
+                                          static_cast<u32>(primitive.materialIndex.value_or(0)),
+                                          FastGltfUtils::ConvertPrimitiveTypeToVulkanPrimitiveTopology(primitive.type));
+
+                    if (primitive.materialIndex.has_value())
+                    {
+                        surfaces.back().CullMode = asset.materials[*primitive.materialIndex].doubleSided ? vk::CullModeFlagBits::eNone
+                                                                                                         : vk::CullModeFlagBits::eBack;
+                        surfaces.back().AlphaMode =
+                            FastGltfUtils::ConvertAlphaModeToRadiant(asset.materials[primitive.materialIndex.value_or(0)].alphaMode);
+                    }
+
+                    const auto initialVertexIndex{vertexPositions.size()};
+
+                    // Loading indices.
+                    {
+                        const auto& indicesAccessor = asset.accessors[*primitive.indicesAccessor];
+                        const u32 prevIndexOffset   = indicesUint32.size();
+                        u32 idxCounter{0};
+                        indicesUint32.resize(indicesUint32.size() + indicesAccessor.count);
+
+                        fastgltf::iterateAccessor<u32>(asset, indicesAccessor,
+                                                       [&](u32 idx)
+                                                       {
+                                                           auto& currentIndexBufferValue = indicesUint32[prevIndexOffset + idxCounter];
+                                                           currentIndexBufferValue       = initialVertexIndex + idx;
+                                                           ++idxCounter;
+                                                       });
+
+                        // NOTE: Check if index > u16/u8::max() and then switch to index type u32/u16.
+                        const u32 maxIdx = *std::max_element(indicesUint32.cbegin(), indicesUint32.cend());
+                        if (indexType == vk::IndexType::eNoneKHR) indexType = vk::IndexType::eUint8EXT;
+
+                        if (maxIdx >= std::numeric_limits<u8>::max()) indexType = vk::IndexType::eUint16;
+                        if (maxIdx >= std::numeric_limits<u16>::max()) indexType = vk::IndexType::eUint32;
+                    }
+
+                    // Load vertex positions.
+                    {
+                        const auto& posAccessor = asset.accessors[positionIt->accessorIndex];
+                        vertexPositionsPerPrimitive.resize(posAccessor.count);
+                        fastgltf::iterateAccessorWithIndex<glm::vec3>(asset, posAccessor,
+                                                                      [&](const glm::vec3& v, const u64 index)
+                                                                      { vertexPositionsPerPrimitive[index].Position = v; });
+                        surfaces.back().Bounds = MeshUtils::GenerateBoundingSphere(vertexPositionsPerPrimitive);
+
+                        // Extend current vertex buffers
+                        vertexPositions.resize(vertexPositions.size() + posAccessor.count);
+                        vertexAttributes.resize(vertexAttributes.size() + posAccessor.count);
+
+                        for (u64 vtxIndex{}; vtxIndex < posAccessor.count; ++vtxIndex)
+                        {
+                            vertexPositions[initialVertexIndex + vtxIndex].Position = vertexPositionsPerPrimitive[vtxIndex].Position;
+                        }
+                    }
+
+                    // Load vertex attributes.
+                    // 1. Vertex colors
+                    if (const auto* colorsAttribute = primitive.findAttribute("COLOR_0"); colorsAttribute != primitive.attributes.end())
+                    {
+                        fastgltf::iterateAccessorWithIndex<glm::vec4>(asset, asset.accessors[colorsAttribute->accessorIndex],
+                                                                      [&](const glm::vec4& vertexColor, const u64 index) {
+                                                                          vertexAttributes[initialVertexIndex + index].Color =
+                                                                              Shaders::PackUnorm4x8(vertexColor);
+                                                                      });
+                    }
+
+                    // 2. Normals
+                    if (const auto* normalsAttribute = primitive.findAttribute("NORMAL"); normalsAttribute != primitive.attributes.end())
+                    {
+                        fastgltf::iterateAccessorWithIndex<glm::vec3>(asset, asset.accessors[normalsAttribute->accessorIndex],
+                                                                      [&](const glm::vec3& n, const u64 index) {
+                                                                          vertexAttributes[initialVertexIndex + index].Normal =
+                                                                              glm::packHalf(Shaders::EncodeOct(n));
+                                                                      });
+                    }
+
+                    // 3. Tangents
+                    if (const auto* tangentAttribute = primitive.findAttribute("TANGENT"); tangentAttribute != primitive.attributes.end())
+                    {
+                        fastgltf::iterateAccessorWithIndex<glm::vec4>(asset, asset.accessors[tangentAttribute->accessorIndex],
+                                                                      [&](const glm::vec4& t, const u64 index)
+                                                                      {
+                                                                          vertexAttributes[initialVertexIndex + index].TSign = t.w;
+                                                                          vertexAttributes[initialVertexIndex + index].Tangent =
+                                                                              glm::packHalf(Shaders::EncodeOct(t));
+                                                                      });
+                    }
+
+                    // 4. UV
+                    if (const auto* uvAttribute = primitive.findAttribute("TEXCOORD_0"); uvAttribute != primitive.attributes.end())
+                    {
+                        fastgltf::iterateAccessorWithIndex<glm::vec2>(asset, asset.accessors[uvAttribute->accessorIndex],
+                                                                      [&](const glm::vec2& uv, const u64 index) {
+                                                                          vertexAttributes[initialVertexIndex + index].UV =
+                                                                              glm::packHalf(uv);
+                                                                      });
+                    }
+                }
+
+                MeshoptimizerUtils::OptimizeMesh(indicesUint32, vertexPositions, vertexAttributes, surfaces);
+                MeshoptimizerUtils::GenerateLODs(indicesUint32, vertexPositions, surfaces);
+
+                // I store indices as uint32, but in case index type is different, then encoding also different.
+                // NOTE: Narrowing is done last, remapping only shrinks vertex count and LODs reference the same vertices.
+                u64 ibSize{indicesUint32.size() * sizeof(indicesUint32[0])};
+                const void* ibData{indicesUint32.data()};
+                std::vector<u16> indicesUint16{};
+                std::vector<u8> indicesUint8{};
+                if (indexType == vk::IndexType::eUint16)
+                {
+                    indicesUint16.resize(indicesUint32.size());
+                    for (u32 i{}; i < indicesUint32.size(); ++i)
+                    {
+                        indicesUint16[i] = static_cast<u16>(indicesUint32[i]);
+                    }
+
+                    ibSize = indicesUint16.size() * sizeof(indicesUint16[0]);
+                    ibData = indicesUint16.data();
+                }
+                else if (indexType == vk::IndexType::eUint8EXT)
+                {
+                    indicesUint8.resize(indicesUint32.size());
+                    for (u32 i{}; i < indicesUint32.size(); ++i)
+                    {
+                        indicesUint8[i] = static_cast<u8>(indicesUint32[i]);
+                    }
+
+                    ibSize = indicesUint8.size() * sizeof(indicesUint8[0]);
+                    ibData = indicesUint8.data();
+                }
+
+                auto& meshRecord                  = meshRecords.emplace_back();
+                meshRecord.Name                   = cookedMeshWriter.AppendString(meshName);
+                meshRecord.IndexType              = static_cast<u32>(indexType);
+                meshRecord.SurfaceCount           = static_cast<u32>(surfaces.size());
+                meshRecord.SurfacesOffset         = cookedMeshWriter.Append(surfaces.data(), surfaces.size());
+                meshRecord.VertexCount            = vertexPositions.size();
+                meshRecord.VertexPositionsOffset  = cookedMeshWriter.Append(vertexPositions.data(), vertexPositions.size());
+                meshRecord.VertexAttributesOffset = cookedMeshWriter.Append(vertexAttributes.data(), vertexAttributes.size());
+                meshRecord.IndicesSizeBytes       = ibSize;
+                meshRecord.IndicesOffset          = cookedMeshWriter.Append(static_cast<const u8*>(ibData), ibSize);
+            }
+
+            std::vector<CookedNodeRecord> nodeRecords(asset.nodes.size());
+            std::vector<u32> childIndices;
+            for (u32 i{}; i < asset.nodes.size(); ++i)
+            {
+                const auto& gltfNode = asset.nodes[i];
+                RDNT_ASSERT(!gltfNode.name.empty(), "fastgltf: Node has no name!");
+
+                auto& nodeRecord     = nodeRecords[i];
+                nodeRecord.Name      = cookedMeshWriter.AppendString(gltfNode.name);
+                nodeRecord.MeshIndex = gltfNode.meshIndex.has_value() ? static_cast<i32>(*gltfNode.meshIndex) : -1;
+
+                std::visit(fastgltf::visitor{[](auto& arg) {
+                                                 RDNT_ASSERT(false,
+                                                             "fastgltf: Default argument when parsing transformation matrices! This "
+                                                             "shouldn't happen!");
+                                             },
+                                             [&](const fastgltf::math::fmat4x4& trsMatrix)
+                                             { memcpy(&nodeRecord.LocalTransform, trsMatrix.data(), sizeof(trsMatrix)); },
+                                             [&](const fastgltf::TRS& trsMatrix)
+                                             {
+                                                 const glm::vec3 tl{(glm::vec3&)trsMatrix.translation};
+                                                 const glm::quat rot{(glm::quat&)trsMatrix.rotation};
+                                                 const glm::vec3 sc{(glm::vec3&)trsMatrix.scale};
+
+                                                 const glm::mat4 tm{glm::translate(glm::mat4(1.f), tl)};
+                                                 const glm::mat4 rm{glm::toMat4(rot)};
+                                                 const glm::mat4 sm{glm::scale(glm::mat4(1.f), sc)};
+
+                                                 nodeRecord.LocalTransform = tm * rm * sm;
+                                             }},
+                           gltfNode.transform);
+
+                childIndices.assign(gltfNode.children.cbegin(), gltfNode.children.cend());
+                nodeRecord.ChildCount     = static_cast<u32>(childIndices.size());
+                nodeRecord.ChildrenOffset = cookedMeshWriter.Append(childIndices.data(), childIndices.size());
+            }
+
+            return cookedMeshWriter.Finalize(CookedMeshHeader{.SourceKey = sourceKey}, meshRecords, nodeRecords);
+        }
+
+        // NOTE: Both freshly cooked blob and memory mapped cooked file end up here, vertex/index slices go straight into staging buffers.
+        // Whole file gets single range of geometry pool megabuffers shared by all loaded meshes, indices are widened to u32 on upload, so
+        // everything can be drawn with single index buffer bind(and by indirect draws).
+        static void LoadCookedMesh(Mesh& mesh, const Unique<GfxContext>& gfxContext, const std::span<const u8> cookedData) noexcept
+        {
+            CookedMeshHeader header = {};
+            std::memcpy(&header, cookedData.data(), sizeof(header));
+
+            const auto* meshRecords = GetCookedData<CookedMeshRecord>(cookedData, header.MeshesOffset);
+            u64 totalVertexCount{0}, totalIndexCount{0};
+            for (u32 meshIndex{}; meshIndex < header.MeshCount; ++meshIndex)
+            {
+                totalVertexCount += meshRecords[meshIndex].VertexCount;
+                totalIndexCount += meshRecords[meshIndex].IndicesSizeBytes /
+                                   GetIndexTypeSize(static_cast<vk::IndexType>(meshRecords[meshIndex].IndexType));
+            }
+
+            // NOTE: Pool doesn't grow, if it's full mesh stays without geometry(no assets, empty hierarchy), so it simply draws nothing.
+            auto geometryAllocation = gfxContext->GetGeometryPool()->Allocate(totalVertexCount, totalIndexCount);
+            if (!geometryAllocation.has_value())
+            {
+                LOG_ERROR("Failed to allocate geometry for ({}) vertices, ({}) indices, skipping mesh!", totalVertexCount, totalIndexCount);
+                return;
+            }
+
+            mesh.GeometryAllocation    = std::move(*geometryAllocation);
+            const u32 poolVertexOffset = static_cast<u32>(mesh.GeometryAllocation.GetVertexOffset());
+            const u32 poolIndexOffset  = static_cast<u32>(mesh.GeometryAllocation.GetIndexOffset());
+
+            const u64 vbpSize     = totalVertexCount * sizeof(VertexPosition);
+            auto vbpStagingBuffer = MakeUnique<GfxBuffer>(
+                gfxContext->GetDevice(), GfxBufferDescription(vbpSize, sizeof(VertexPosition), vk::BufferUsageFlagBits::eTransferSrc,
+                                                              EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
+            const u64 vabSize     = totalVertexCount * sizeof(VertexAttribute);
+            auto vabStagingBuffer = MakeUnique<GfxBuffer>(
+                gfxContext->GetDevice(), GfxBufferDescription(vabSize, sizeof(VertexAttribute), vk::BufferUsageFlagBits::eTransferSrc,
+                                                              EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
+            const u64 ibSize     = totalIndexCount * sizeof(u32);
+            auto ibStagingBuffer = MakeUnique<GfxBuffer>(gfxContext->GetDevice(),
+                                                         GfxBufferDescription(ibSize, sizeof(u32), vk::BufferUsageFlagBits::eTransferSrc,
+                                                                              EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
+            // Depth only passes get their own 16 bit copy of positions, shading passes keep full precision.
+            const u64 vbpqSize = QUANTIZE_VERTEX_POSITIONS ? totalVertexCount * sizeof(VertexPositionQuantized) : 0;
+            Unique<GfxBuffer> vbpqStagingBuffer{nullptr};
+            if constexpr (QUANTIZE_VERTEX_POSITIONS)
+            {
+                vbpqStagingBuffer = MakeUnique<GfxBuffer>(gfxContext->GetDevice(),
+                                                          GfxBufferDescription(vbpqSize, sizeof(VertexPositionQuantized),
+                                                                               vk::BufferUsageFlagBits::eTransferSrc,
+                                                                               EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
+            }
+            auto* mappedVertexPositions  = static_cast<VertexPosition*>(vbpStagingBuffer->GetMapped());
+            auto* mappedVertexAttributes = static_cast<VertexAttribute*>(vabStagingBuffer->GetMapped());
+            auto* mappedIndices          = static_cast<u32*>(ibStagingBuffer->GetMapped());
+
+            std::vector<Shared<MeshAsset>> meshAssetLUT(header.MeshCount);
+            mesh.MeshAssetMap.reserve(header.MeshCount);
+            u32 vertexOffset{0}, indexOffset{0};
+            f32 maxPositionQuantizationError{0.0f};
+            for (u32 meshIndex{}; meshIndex < header.MeshCount; ++meshIndex)
+            {
+                const auto& meshRecord = meshRecords[meshIndex];
+                const std::string meshName{GetCookedString(cookedData, meshRecord.Name)};
+
+                auto& currentMeshAsset  = mesh.MeshAssetMap[meshName];
+                currentMeshAsset        = MakeShared<MeshAsset>();
+                currentMeshAsset->Name  = meshName;
+                meshAssetLUT[meshIndex] = currentMeshAsset;
+
+                // Surfaces(and their LODs) are rebased onto pool megabuffer, staging buffers hold this file only.
+                const auto* surfaces       = GetCookedData<GeometryData>(cookedData, meshRecord.SurfacesOffset);
+                currentMeshAsset->Surfaces = {surfaces, surfaces + meshRecord.SurfaceCount};
+                for (auto& surface : currentMeshAsset->Surfaces)
+                {
+                    surface.StartIndex += poolIndexOffset + indexOffset;
+                    for (u32 lodIndex{}; lodIndex < surface.LODCount; ++lodIndex)
+                        surface.LODs[lodIndex].FirstIndex += poolIndexOffset + indexOffset;
+                }
+
+                currentMeshAsset->IndexType               = vk::IndexType::eUint32;
+                currentMeshAsset->VertexOffset            = poolVertexOffset + vertexOffset;
+                currentMeshAsset->IndexBufferID           = 0;
+                currentMeshAsset->VertexPositionBufferID  = 0;
+                currentMeshAsset->VertexAttributeBufferID = 0;
+
+                std::memcpy(mappedVertexPositions + vertexOffset, GetCookedData<u8>(cookedData, meshRecord.VertexPositionsOffset),
+                            meshRecord.VertexCount * sizeof(VertexPosition));
+                if constexpr (QUANTIZE_VERTEX_POSITIONS)
+                {
+                    const auto quantizedPositionsInfo = VertexQuantizationUtils::QuantizePositions(
+                        {GetCookedData<VertexPosition>(cookedData, meshRecord.VertexPositionsOffset), meshRecord.VertexCount},
+                        {static_cast<VertexPositionQuantized*>(vbpqStagingBuffer->GetMapped()) + vertexOffset, meshRecord.VertexCount});
+                    currentMeshAsset->PositionDequantScale  = quantizedPositionsInfo.DequantScale;
+                    currentMeshAsset->PositionDequantOffset = quantizedPositionsInfo.DequantOffset;
+                    maxPositionQuantizationError            = glm::max(maxPositionQuantizationError, quantizedPositionsInfo.MaxError);
+                }
+                std::memcpy(mappedVertexAttributes + vertexOffset, GetCookedData<u8>(cookedData, meshRecord.VertexAttributesOffset),
+                            meshRecord.VertexCount * sizeof(VertexAttribute));
+
+                // Indices are narrowed down on disk, so they're widened back here.
+                const auto cookedIndexType = static_cast<vk::IndexType>(meshRecord.IndexType);
+                const u64 indexCount       = meshRecord.IndicesSizeBytes / GetIndexTypeSize(cookedIndexType);
+                for (u64 i{}; i < indexCount; ++i)
+                {
+                    switch (cookedIndexType)
+                    {
+                        case vk::IndexType::eUint8EXT:
+                            mappedIndices[indexOffset + i] = GetCookedData<u8>(cookedData, meshRecord.IndicesOffset)[i];
+                            break;
+                        case vk::IndexType::eUint16:
+                            mappedIndices[indexOffset + i] = GetCookedData<u16>(cookedData, meshRecord.IndicesOffset)[i];
+                            break;
+                        default: mappedIndices[indexOffset + i] = GetCookedData<u32>(cookedData, meshRecord.IndicesOffset)[i]; break;
+                    }
+                }
+
+                vertexOffset += static_cast<u32>(meshRecord.VertexCount);
+                indexOffset += static_cast<u32>(indexCount);
+            }
+
+            auto executionContext = gfxContext->CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_DEDICATED_TRANSFER);
+            executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+            const auto& geometryPool = gfxContext->GetGeometryPool();
+            auto& vtxPosBuffer       = mesh.VertexPositionBuffers.emplace_back(geometryPool->GetVertexPositionBuffer());
+            executionContext.CommandBuffer.copyBuffer(
+                *vbpStagingBuffer, *vtxPosBuffer,
+                vk::BufferCopy().setDstOffset(poolVertexOffset * sizeof(VertexPosition)).setSize(vbpSize));
+
+            auto& depthOnlyVtxPosBuffer =
+                mesh.DepthOnlyVertexPositionBuffers.emplace_back(geometryPool->GetDepthOnlyVertexPositionBuffer());
+            if constexpr (QUANTIZE_VERTEX_POSITIONS)
+            {
+                executionContext.CommandBuffer.copyBuffer(
+                    *vbpqStagingBuffer, *depthOnlyVtxPosBuffer,
+                    vk::BufferCopy().setDstOffset(poolVertexOffset * sizeof(VertexPositionQuantized)).setSize(vbpqSize));
+                LOG_INFO("Quantized ({}) vertex positions, max error [{:.6f}]", totalVertexCount, maxPositionQuantizationError);
+            }
+
+            auto& vtxAttribBuffer = mesh.VertexAttributeBuffers.emplace_back(geometryPool->GetVertexAttributeBuffer());
+            executionContext.CommandBuffer.copyBuffer(
+                *vabStagingBuffer, *vtxAttribBuffer,
+                vk::BufferCopy().setDstOffset(poolVertexOffset * sizeof(VertexAttribute)).setSize(vabSize));
+
+            auto& ibBuffer = mesh.IndexBuffers.emplace_back(geometryPool->GetIndexBuffer());
+            executionContext.CommandBuffer.copyBuffer(*ibStagingBuffer, *ibBuffer,
+                                                      vk::BufferCopy().setDstOffset(poolIndexOffset * sizeof(u32)).setSize(ibSize));
+
+            executionContext.CommandBuffer.end();
+            gfxContext->SubmitImmediateExecuteContext(executionContext);
+
+            std::vector<SceneGraph::NodeDescription> nodeDescriptions(header.NodeCount);
+            const auto* nodeRecords = GetCookedData<CookedNodeRecord>(cookedData, header.NodesOffset);
+            for (u32 i{}; i < header.NodeCount; ++i)
+            {
+                const auto& nodeRecord = nodeRecords[i];
+                auto& nodeDescription  = nodeDescriptions[i];
+
+                nodeDescription.Name           = GetCookedString(cookedData, nodeRecord.Name);
+                nodeDescription.LocalTransform = nodeRecord.LocalTransform;
+
+                // Find if the node has a mesh, and if it does hook it to the mesh pointer.
+                if (nodeRecord.MeshIndex != -1) nodeDescription.MeshAsset = meshAssetLUT[nodeRecord.MeshIndex];
+            }
+
+            // Setup transform hierarchy.
+            for (u32 i{}; i < header.NodeCount; ++i)
+            {
+                const auto& nodeRecord   = nodeRecords[i];
+                const auto* childIndices = GetCookedData<u32>(cookedData, nodeRecord.ChildrenOffset);
+                for (u32 k{}; k < nodeRecord.ChildCount; ++k)
+                    nodeDescriptions[childIndices[k]].ParentIndex = static_cast<i32>(i);
+            }
+
+            mesh.Hierarchy.Build(nodeDescriptions);
+        }
+
+    }  // namespace MeshCookUtils
+
+    Mesh::Mesh(const Unique<GfxContext>& gfxContext, const std::filesystem::path& meshFilePath) noexcept : FilePath(meshFilePath)
     {
         constexpr auto gltfLoadOptions = fastgltf::Options::DontRequireValidAssetMember | fastgltf::Options::LoadGLBBuffers |
                                          fastgltf::Options::LoadExternalBuffers | fastgltf::Options::GenerateMeshIndices;
@@ -511,22 +1237,11 @@ namespace Radiant
 
                         imageIndexToFormatMap[imageIndex] = format;
 
-                        std::visit(
-                            fastgltf::visitor{
-                                [](const auto& arg)
-                                { RDNT_ASSERT(false, "fastgltf: Default argument when loading image! This shouldn't happen!"); },
-                                [&](const fastgltf::sources::URI& filePath)
-                                {
-                                    RDNT_ASSERT(filePath.fileByteOffset == 0, "fastgltf: We don't support offsets with stbi!");
-                                    RDNT_ASSERT(filePath.uri.isLocalPath(), "fastgltf: We're only capable of loading local files!");
-
-                                    const auto textureName = filePath.uri.path();
-                                    RDNT_ASSERT(!textureName.empty(), "fastgltf: Texture name is empty!");
-
-                                    const auto textureFilePath = meshParentPath / textureName;
-                                    textureCompressor.PushTextureIntoBatchList(textureFilePath.string(), format);
-                                }},
-                            asset->images[imageIndex].data);
+                        const auto imageSource = FastGltfUtils::ResolveImageSource(asset.get(), asset->images[imageIndex], meshParentPath);
+                        if (imageSource.RawData.empty())
+                            textureCompressor.PushTextureIntoBatchList(imageSource.FilePath, format);
+                        else
+                            textureCompressor.PushTextureIntoBatchList(imageSource.Name, imageSource.RawData, format);
                     }
                 };
 
@@ -653,287 +1368,35 @@ namespace Radiant
                 .AlphaCutoff{fastgltfMaterial.alphaCutoff}};
         }
 
-        // Use the same vectors for all meshes so that the memory doesn't reallocate as often.
-        std::vector<u32> indicesUint32;
-        std::vector<VertexPosition> vertexPositions;
-        std::vector<VertexAttribute> vertexAttributes;
         LOG_INFO("Loading scene: {}", meshFilePath.string());
-
-        std::vector<std::string> meshAssetLUT{};
-        MeshAssetMap.reserve(asset->meshes.size());
-        std::vector<VertexPosition> vertexPositionsPerPrimitive;  // Used only for bounding sphere generation.
-        for (const auto& fastgltfMesh : asset->meshes)
         {
-            RDNT_ASSERT(!fastgltfMesh.name.empty(), "fastgltf: Mesh has no name!");
-
-            const std::string meshName{fastgltfMesh.name};
-            LOG_INFO("Loading submesh: {}", meshName);
-
-            indicesUint32.clear();
-            vertexPositions.clear();
-            vertexAttributes.clear();
-
-            meshAssetLUT.emplace_back(meshName);
-
-            auto& currentMeshAsset = MeshAssetMap[meshName];
-            currentMeshAsset       = MakeShared<MeshAsset>();
-            currentMeshAsset->Name = meshName;
+            const auto geometryLoadBeginTime = Timer::Now();
 
-            for (const auto& primitive : fastgltfMesh.primitives)
+            const auto cookedMeshPath  = MeshCookUtils::GetCookedMeshPath(meshFilePath);
+            const u64 cookedSourceKey  = MeshCookUtils::MakeCookedMeshSourceKey(meshFilePath, asset.get());
+            bool bLoadedFromCookedMesh = false;
+            if (std::filesystem::exists(cookedMeshPath))
             {
-                RDNT_ASSERT(primitive.indicesAccessor.has_value(),
-                            "fastgltf: We specify GenerateMeshIndices, so we should always have indices!");
-                const auto* positionIt = primitive.findAttribute("POSITION");
-                RDNT_ASSERT(positionIt != primitive.attributes.end(),
-                            "fastgltf: A mesh primitive is required to hold the POSITION attribute.");
-
-                vertexPositionsPerPrimitive.clear();
-                currentMeshAsset->Surfaces.emplace_back(static_cast<u32>(indicesUint32.size()),
-                                                        static_cast<u32>(asset->accessors[*primitive.indicesAccessor].count), Sphere{},
-                                                        static_cast<u32>(primitive.materialIndex.value_or(0)),
-                                                        FastGltfUtils::ConvertPrimitiveTypeToVulkanPrimitiveTopology(primitive.type));
-
-                if (primitive.materialIndex.has_value())
+                const CoreUtils::MappedFile cookedMeshFile(cookedMeshPath);
+                if (cookedMeshFile.IsValid() && MeshCookUtils::IsCookedMeshValid(cookedMeshFile.GetData(), cookedSourceKey))
                 {
-                    currentMeshAsset->Surfaces.back().CullMode =
-                        asset->materials[*primitive.materialIndex].doubleSided ? vk::CullModeFlagBits::eNone : vk::CullModeFlagBits::eBack;
-                    currentMeshAsset->Surfaces.back().AlphaMode =
-                        FastGltfUtils::ConvertAlphaModeToRadiant(asset->materials[primitive.materialIndex.value_or(0)].alphaMode);
+                    MeshCookUtils::LoadCookedMesh(*this, gfxContext, cookedMeshFile.GetData());
+                    bLoadedFromCookedMesh = true;
                 }
-
-                const auto initialVertexIndex{vertexPositions.size()};
-
-                // Loading indices.
-                {
-                    const auto& indicesAccessor = asset->accessors[*primitive.indicesAccessor];
-                    const u32 prevIndexOffset   = indicesUint32.size();
-                    u32 idxCounter{0};
-                    indicesUint32.resize(indicesUint32.size() + indicesAccessor.count);
-
-                    fastgltf::iterateAccessor<u32>(asset.get(), indicesAccessor,
-                                                   [&](u32 idx)
-                                                   {
-                                                       auto& currentIndexBufferValue = indicesUint32[prevIndexOffset + idxCounter];
-                                                       currentIndexBufferValue       = initialVertexIndex + idx;
-                                                       ++idxCounter;
-                                                   });
-
-                    // NOTE: Check if index > u16/u8::max() and then switch to index type u32/u16.
-                    const u32 maxIdx = *std::max_element(indicesUint32.cbegin(), indicesUint32.cend());
-                    if (currentMeshAsset->IndexType == vk::IndexType::eNoneKHR) currentMeshAsset->IndexType = vk::IndexType::eUint8EXT;
-
-                    if (maxIdx >= std::numeric_limits<u8>::max()) currentMeshAsset->IndexType = vk::IndexType::eUint16;
-                    if (maxIdx >= std::numeric_limits<u16>::max()) currentMeshAsset->IndexType = vk::IndexType::eUint32;
-                }
-
-                // Load vertex positions.
-                {
-                    const auto& posAccessor = asset->accessors[positionIt->accessorIndex];
-                    vertexPositionsPerPrimitive.resize(posAccessor.count);
-                    fastgltf::iterateAccessorWithIndex<glm::vec3>(asset.get(), posAccessor,
-                                                                  [&](const glm::vec3& v, const u64 index)
-                                                                  { vertexPositionsPerPrimitive[index].Position = v; });
-                    currentMeshAsset->Surfaces.back().Bounds = MeshUtils::GenerateBoundingSphere(vertexPositionsPerPrimitive);
-
-                    // Extend current vertex buffers
-                    vertexPositions.resize(vertexPositions.size() + posAccessor.count);
-                    vertexAttributes.resize(vertexAttributes.size() + posAccessor.count);
-
-                    for (u64 vtxIndex{}; vtxIndex < posAccessor.count; ++vtxIndex)
-                    {
-                        vertexPositions[initialVertexIndex + vtxIndex].Position = vertexPositionsPerPrimitive[vtxIndex].Position;
-                    }
-                }
-
-                // Load vertex attributes.
-                // 1. Vertex colors
-                if (const auto* colorsAttribute = primitive.findAttribute("COLOR_0"); colorsAttribute != primitive.attributes.end())
-                {
-                    fastgltf::iterateAccessorWithIndex<glm::vec4>(asset.get(), asset->accessors[colorsAttribute->accessorIndex],
-                                                                  [&](const glm::vec4& vertexColor, const u64 index) {
-                                                                      vertexAttributes[initialVertexIndex + index].Color =
-                                                                          Shaders::PackUnorm4x8(vertexColor);
-                                                                  });
-                }
-
-                // 2. Normals
-                if (const auto* normalsAttribute = primitive.findAttribute("NORMAL"); normalsAttribute != primitive.attributes.end())
-                {
-                    fastgltf::iterateAccessorWithIndex<glm::vec3>(asset.get(), asset->accessors[normalsAttribute->accessorIndex],
-                                                                  [&](const glm::vec3& n, const u64 index) {
-                                                                      vertexAttributes[initialVertexIndex + index].Normal =
-                                                                          glm::packHalf(Shaders::EncodeOct(n));
-                                                                  });
-                }
-
-                // 3. Tangents
-                if (const auto* tangentAttribute = primitive.findAttribute("TANGENT"); tangentAttribute != primitive.attributes.end())
-                {
-                    fastgltf::iterateAccessorWithIndex<glm::vec4>(asset.get(), asset->accessors[tangentAttribute->accessorIndex],
-                                                                  [&](const glm::vec4& t, const u64 index)
-                                                                  {
-                                                                      vertexAttributes[initialVertexIndex + index].TSign = t.w;
-                                                                      vertexAttributes[initialVertexIndex + index].Tangent =
-                                                                          glm::packHalf(Shaders::EncodeOct(t));
-                                                                  });
-                }
-
-                // 4. UV
-                if (const auto* uvAttribute = primitive.findAttribute("TEXCOORD_0"); uvAttribute != primitive.attributes.end())
-                {
-                    fastgltf::iterateAccessorWithIndex<glm::vec2>(asset.get(), asset->accessors[uvAttribute->accessorIndex],
-                                                                  [&](const glm::vec2& uv, const u64 index)
-                                                                  { vertexAttributes[initialVertexIndex + index].UV = glm::packHalf(uv); });
-                }
-            }
-
-            currentMeshAsset->IndexBufferID           = IndexBuffers.size();
-            currentMeshAsset->VertexPositionBufferID  = VertexPositionBuffers.size();
-            currentMeshAsset->VertexAttributeBufferID = VertexAttributeBuffers.size();
-
-            // I store indices as uint32, but in case index type is different, then encoding also different.
-            // Handle indices with different types.
-            u64 ibElementSize{sizeof(indicesUint32[0])};
-            u64 ibSize{indicesUint32.size() * ibElementSize};
-            void* ibData{indicesUint32.data()};
-            std::vector<u16> indicesUint16{};
-            std::vector<u8> indicesUint8{};
-            if (currentMeshAsset->IndexType == vk::IndexType::eUint32)
-            {
-                MeshoptimizerUtils::OptimizeMesh(indicesUint32, vertexPositions, vertexAttributes);
-            }
-            else if (currentMeshAsset->IndexType == vk::IndexType::eUint16)
-            {
-                indicesUint16.resize(indicesUint32.size());
-                for (u32 i{}; i < indicesUint32.size(); ++i)
-                {
-                    indicesUint16[i] = static_cast<u16>(indicesUint32[i]);
-                }
-                MeshoptimizerUtils::OptimizeMesh(indicesUint16, vertexPositions, vertexAttributes);
-
-                ibElementSize = sizeof(indicesUint16[0]);
-                ibSize        = indicesUint16.size() * ibElementSize;
-                ibData        = indicesUint16.data();
-            }
-            else if (currentMeshAsset->IndexType == vk::IndexType::eUint8EXT)
-            {
-                indicesUint8.resize(indicesUint32.size());
-                for (u32 i{}; i < indicesUint32.size(); ++i)
-                {
-                    indicesUint8[i] = static_cast<u8>(indicesUint32[i]);
-                }
-                MeshoptimizerUtils::OptimizeMesh(indicesUint8, vertexPositions, vertexAttributes);
-
-                ibElementSize = sizeof(indicesUint8[0]);
-                ibSize        = indicesUint8.size() * ibElementSize;
-                ibData        = indicesUint8.data();
             }
 
-            auto executionContext = gfxContext->CreateImmediateExecuteContext(ECommandQueueType::COMMAND_QUEUE_TYPE_DEDICATED_TRANSFER);
-            executionContext.CommandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
-
-            // Handle vertex positions.
-            auto vbpStagingBuffer = MakeUnique<GfxBuffer>(
-                gfxContext->GetDevice(),
-                GfxBufferDescription(vertexPositions.size() * sizeof(vertexPositions[0]), sizeof(vertexPositions[0]),
-                                     vk::BufferUsageFlagBits::eTransferSrc, EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
-            vbpStagingBuffer->SetData(vertexPositions.data(), vertexPositions.size() * sizeof(vertexPositions[0]));
-
-            auto& vtxPosBuffer = VertexPositionBuffers.emplace_back(MakeShared<GfxBuffer>(
-                gfxContext->GetDevice(),
-                GfxBufferDescription(vertexPositions.size() * sizeof(vertexPositions[0]), sizeof(vertexPositions[0]),
-                                     vk::BufferUsageFlagBits::eVertexBuffer, EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT)));
-            executionContext.CommandBuffer.copyBuffer(*vbpStagingBuffer, *vtxPosBuffer,
-                                                      vk::BufferCopy().setSize(vertexPositions.size() * sizeof(vertexPositions[0])));
-
-            // Handle vertex attributes.
-            auto vabStagingBuffer = MakeUnique<GfxBuffer>(
-                gfxContext->GetDevice(),
-                GfxBufferDescription(vertexAttributes.size() * sizeof(vertexAttributes[0]), sizeof(vertexAttributes[0]),
-                                     vk::BufferUsageFlagBits::eTransferSrc, EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
-            vabStagingBuffer->SetData(vertexAttributes.data(), vertexAttributes.size() * sizeof(vertexAttributes[0]));
-
-            auto& vtxAttribBuffer = VertexAttributeBuffers.emplace_back(MakeShared<GfxBuffer>(
-                gfxContext->GetDevice(),
-                GfxBufferDescription(vertexAttributes.size() * sizeof(vertexAttributes[0]), sizeof(vertexAttributes[0]),
-                                     vk::BufferUsageFlagBits::eVertexBuffer, EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT)));
-            executionContext.CommandBuffer.copyBuffer(*vabStagingBuffer, *vtxAttribBuffer,
-                                                      vk::BufferCopy().setSize(vertexAttributes.size() * sizeof(vertexAttributes[0])));
-
-            auto ibStagingBuffer = MakeUnique<GfxBuffer>(gfxContext->GetDevice(),
-                                                         GfxBufferDescription(ibSize, ibElementSize, vk::BufferUsageFlagBits::eTransferSrc,
-                                                                              EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_HOST_BIT));
-            ibStagingBuffer->SetData(ibData, ibSize);
-
-            auto& ibBuffer = IndexBuffers.emplace_back(MakeShared<GfxBuffer>(
-                gfxContext->GetDevice(), GfxBufferDescription(ibSize, ibElementSize, vk::BufferUsageFlagBits::eIndexBuffer,
-                                                              EExtraBufferFlagBits::EXTRA_BUFFER_FLAG_DEVICE_LOCAL_BIT)));
-            executionContext.CommandBuffer.copyBuffer(*ibStagingBuffer, *ibBuffer, vk::BufferCopy().setSize(ibSize));
-
-            executionContext.CommandBuffer.end();
-            gfxContext->SubmitImmediateExecuteContext(executionContext);
-        }
-        meshAssetLUT.shrink_to_fit();
-
-        std::vector<Shared<RenderNode>> nodesToConfigureLater;
-        for (const auto& gltfNode : asset->nodes)
-        {
-            RDNT_ASSERT(!gltfNode.name.empty(), "fastgltf: Node has no name!");
-
-            const std::string nodeName{gltfNode.name};
-            Shared<RenderNode> newNode{MakeShared<RenderNode>()};
-            newNode->Name = nodeName;
-
-            // Find if the node has a mesh, and if it does hook it to the mesh pointer and allocate it with the RenderNode class.
-            if (gltfNode.meshIndex.has_value())
+            if (!bLoadedFromCookedMesh)
             {
-                newNode->MeshAsset = MeshAssetMap[meshAssetLUT[*gltfNode.meshIndex]];
-            }
-            RenderNodes[nodeName] = newNode;
-            nodesToConfigureLater.emplace_back(newNode);
-
-            std::visit(fastgltf::visitor{[](auto& arg) {
-                                             RDNT_ASSERT(
-                                                 false,
-                                                 "fastgltf: Default argument when parsing transformation matrices! This shouldn't happen!");
-                                         },
-                                         [&](const fastgltf::math::fmat4x4& trsMatrix)
-                                         { memcpy(&newNode->LocalTransform, trsMatrix.data(), sizeof(trsMatrix)); },
-                                         [&](const fastgltf::TRS& trsMatrix)
-                                         {
-                                             const glm::vec3 tl{(glm::vec3&)trsMatrix.translation};
-                                             const glm::quat rot{(glm::quat&)trsMatrix.rotation};
-                                             const glm::vec3 sc{(glm::vec3&)trsMatrix.scale};
-
-                                             const glm::mat4 tm{glm::translate(glm::mat4(1.f), tl)};
-                                             const glm::mat4 rm{glm::toMat4(rot)};
-                                             const glm::mat4 sm{glm::scale(glm::mat4(1.f), sc)};
-
-                                             newNode->LocalTransform = tm * rm * sm;
-                                         }},
-                       gltfNode.transform);
-        }
-
-        // Setup transform hierarchy.
-        for (u32 i{}; i < asset->nodes.size(); ++i)
-        {
-            const auto& node = asset->nodes[i];
-            auto& renderNode = nodesToConfigureLater[i];
+                const auto cookedMeshData = MeshCookUtils::CookMesh(asset.get(), cookedSourceKey);
+                MeshCookUtils::LoadCookedMesh(*this, gfxContext, cookedMeshData);
 
-            for (const auto& childrenIndex : node.children)
-            {
-                nodesToConfigureLater[childrenIndex]->Parent = renderNode;
-                renderNode->Children.emplace_back(nodesToConfigureLater[childrenIndex]);
+                std::filesystem::create_directories(MeshCookUtils::s_CookedMeshDir);
+                CoreUtils::SaveData(cookedMeshPath, cookedMeshData);
             }
-        }
 
-        // Find the root nodes.
-        for (auto& renderNode : nodesToConfigureLater)
-        {
-            if (renderNode->Parent.lock()) continue;
-
-            RootNodes.emplace_back(renderNode);
-            renderNode->RefreshTransform(glm::mat4{1.f});
+            const auto geometryLoadEndTime = Timer::Now();
+            LOG_INFO("Loaded ({}) meshes {} in [{:.3f}] ms", MeshAssetMap.size(), bLoadedFromCookedMesh ? "from cooked mesh" : "from glTF",
+                     std::chrono::duration<f32, std::chrono::milliseconds::period>(geometryLoadEndTime - geometryLoadBeginTime).count());
         }
 
         // Load material buffers(marking as ReBAR btw).
@@ -947,4 +1410,36 @@ namespace Radiant
         }
     }
 
+    namespace MeshUtils
+    {
+
+        void RunLoadBenchmark(const Unique<GfxContext>& gfxContext, const std::filesystem::path& meshFilePath,
+                              const u32 iterationCount) noexcept
+        {
+            RDNT_ASSERT(iterationCount > 0, "Iteration count should be > 0!");
+            std::filesystem::remove(MeshCookUtils::GetCookedMeshPath(meshFilePath));
+
+            // NOTE: Textures come out of BC texture cache in both cases, so the difference is geometry cooking.
+            std::vector<f64> loadTimes{};
+            for (u32 i{}; i <= iterationCount; ++i)
+            {
+                const Timer loadTimer{};
+                {
+                    const Mesh mesh(gfxContext, meshFilePath);
+                }
+                gfxContext->GetDevice()->WaitIdle();
+                loadTimes.emplace_back(loadTimer.GetElapsedMilliseconds());
+            }
+
+            const auto cookedLoadTimes = std::span(loadTimes).subspan(1);
+            const f64 averageCookedLoadTime =
+                std::accumulate(cookedLoadTimes.begin(), cookedLoadTimes.end(), 0.0) / static_cast<f64>(cookedLoadTimes.size());
+            LOG_INFO("Mesh load benchmark [{}]:", meshFilePath.string());
+            LOG_INFO("\tglTF(cooking included): {:.3f} ms", loadTimes[0]);
+            LOG_INFO("\tcooked mesh: avg {:.3f} ms, min {:.3f} ms over {} loads", averageCookedLoadTime,
+                     *std::ranges::min_element(cookedLoadTimes), cookedLoadTimes.size());
+        }
+
+    }  // namespace MeshUtils
+
 }  // namespace Radiant
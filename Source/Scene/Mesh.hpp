@@ -2,6 +2,8 @@
 
 #include <Render/CoreDefines.hpp>
 #include <vulkan/vulkan.hpp>
+#include <Scene/SceneGraph.hpp>
+#include <Render/GfxGeometryPool.hpp>
 
 namespace Radiant
 {
@@ -10,19 +12,38 @@ namespace Radiant
     class GfxContext;
     class GfxTexture;
 
+    static constexpr u32 s_MaxMeshLODCount = 8;
+
+    // NOTE: Error is object space distance simplified surface may deviate from the original one, 0 for full resolution.
+    struct MeshLOD final
+    {
+        u32 FirstIndex{};
+        u32 IndexCount{};
+        f32 Error{};
+    };
+
     struct RenderObject final
     {
         glm::mat4 TRS{1.0f};
+        ObjectInstanceData Instance{};  // Decomposed TRS with global mesh transform applied, refreshed by renderer.
         Shared<GfxBuffer> VertexPositionBuffer{nullptr};
+        Shared<GfxBuffer> DepthOnlyVertexPositionBuffer{nullptr};  // Read by depth prepass and CSM, see QUANTIZE_VERTEX_POSITIONS.
         Shared<GfxBuffer> VertexAttributeBuffer{nullptr};
         Shared<GfxBuffer> IndexBuffer{nullptr};
         vk::IndexType IndexType{vk::IndexType::eNoneKHR};
-        u32 IndexCount{0};
-        u32 FirstIndex{0};
+        u32 VertexOffset{0};              // Into geometry pool vertex megabuffers.
+        std::span<const MeshLOD> LODs{};  // Points into MeshAsset surface, LOD0 is full resolution.
+        Sphere Bounds{};                  // Object space.
+        u32 LODIndex{0};                  // Selected per frame.
         Shared<GfxBuffer> MaterialBuffer{nullptr};
         vk::PrimitiveTopology PrimitiveTopology{vk::PrimitiveTopology::ePointList};
         vk::CullModeFlags CullMode{vk::CullModeFlagBits::eBack};
         EAlphaMode AlphaMode{EAlphaMode::ALPHA_MODE_OPAQUE};
+
+        NODISCARD FORCEINLINE const MeshLOD& GetLOD(const u32 lodBias = 0) const noexcept
+        {
+            return LODs[glm::min(LODIndex + lodBias, static_cast<u32>(LODs.size()) - 1)];
+        }
     };
 
     struct DrawContext final
@@ -39,6 +60,8 @@ namespace Radiant
         vk::PrimitiveTopology PrimitiveTopology{vk::PrimitiveTopology::eTriangleList};
         vk::CullModeFlags CullMode{vk::CullModeFlagBits::eBack};
         EAlphaMode AlphaMode{EAlphaMode::ALPHA_MODE_OPAQUE};
+        u32 LODCount{1};
+        std::array<MeshLOD, s_MaxMeshLODCount> LODs{};  // Stored contiguously in the same index buffer, past all LOD0 indices.
     };
 
     struct MeshAsset final
@@ -46,69 +69,40 @@ namespace Radiant
         std::string Name{s_DEFAULT_STRING};
         std::vector<GeometryData> Surfaces;
         vk::IndexType IndexType{vk::IndexType::eNoneKHR};
+        u32 VertexOffset{};  // NOTE: Buffers are geometry pool megabuffers shared by all meshes, surface indices are already rebased.
         u32 IndexBufferID{};
-        u32 VertexPositionBufferID{};
+        u32 VertexPositionBufferID{};  // Indexes DepthOnlyVertexPositionBuffers as well.
         u32 VertexAttributeBufferID{};
-    };
-
-    struct RenderNode final
-    {
-        std::string Name{s_DEFAULT_STRING};
-        WeakPtr<RenderNode> Parent{};
-        std::vector<Shared<RenderNode>> Children;
-
-        Shared<MeshAsset> MeshAsset{nullptr};
-
-        glm::mat4 LocalTransform{1.f};
-        glm::mat4 WorldTransform{1.f};
-
-        void Iterate(DrawContext& drawContext, const std::vector<Shared<GfxBuffer>>& vertexPositionBuffers,
-                     const std::vector<Shared<GfxBuffer>>& vertexAttributeBuffers, const std::vector<Shared<GfxBuffer>>& indexBuffers,
-                     const std::vector<Shared<GfxBuffer>>& materialBuffers, const glm::mat4& topMatrix) noexcept
-        {
-            if (MeshAsset)
-            {
-                const auto& indexBuffer        = indexBuffers[MeshAsset->IndexBufferID];
-                const auto& vertexPosBuffer    = vertexPositionBuffers[MeshAsset->VertexPositionBufferID];
-                const auto& vertexAttribBuffer = vertexAttributeBuffers[MeshAsset->VertexAttributeBufferID];
-                const auto& modelMatrix        = topMatrix * WorldTransform;
-
-                for (const auto& surface : MeshAsset->Surfaces)
-                {
-                    const auto& materialBuffer = materialBuffers[surface.MaterialID];
-                    drawContext.RenderObjects.emplace_back(modelMatrix, vertexPosBuffer, vertexAttribBuffer, indexBuffer,
-                                                           MeshAsset->IndexType, surface.Count, surface.StartIndex, materialBuffer,
-                                                           surface.PrimitiveTopology, surface.CullMode, surface.AlphaMode);
-                }
-            }
-
-            for (const auto& child : Children)
-            {
-                child->Iterate(drawContext, vertexPositionBuffers, vertexAttributeBuffers, indexBuffers, materialBuffers, topMatrix);
-            }
-        }
-
-        void RefreshTransform(const glm::mat4& parentTransform) noexcept
-        {
-            WorldTransform = parentTransform * LocalTransform;
-            for (auto& child : Children)
-                child->RefreshTransform(WorldTransform);
-        }
+        glm::vec3 PositionDequantScale{1.0f};  // NOTE: Decode DepthOnlyVertexPosition, identity unless positions are quantized.
+        glm::vec3 PositionDequantOffset{0.0f};
     };
 
     struct Mesh final
     {
         Mesh(const Unique<GfxContext>& gfxContext, const std::filesystem::path& meshFilePath) noexcept;
         ~Mesh() noexcept = default;
+        Mesh(Mesh&&) noexcept            = default;
+        Mesh& operator=(Mesh&&) noexcept = default;
 
-        std::vector<Shared<RenderNode>> RootNodes;
-        UnorderedMap<std::string, Shared<RenderNode>> RenderNodes;
+        std::filesystem::path FilePath{};            // Path it was loaded from, meshes are unloaded by it.
+        GfxGeometryAllocation GeometryAllocation{};  // Returned to the pool once mesh is unloaded.
+        SceneGraph Hierarchy;
         UnorderedMap<std::string, Shared<GfxTexture>> TextureMap;
         UnorderedMap<std::string, Shared<MeshAsset>> MeshAssetMap;
         std::vector<Shared<GfxBuffer>> VertexPositionBuffers;
+        std::vector<Shared<GfxBuffer>> DepthOnlyVertexPositionBuffers;  // Aliases VertexPositionBuffers unless positions are quantized.
         std::vector<Shared<GfxBuffer>> VertexAttributeBuffers;
         std::vector<Shared<GfxBuffer>> IndexBuffers;
         std::vector<Shared<GfxBuffer>> MaterialBuffers;
     };
 
+    namespace MeshUtils
+    {
+
+        // NOTE: Loads mesh once out of glTF(cooked mesh is removed beforehand), then iterationCount times out of cooked mesh.
+        void RunLoadBenchmark(const Unique<GfxContext>& gfxContext, const std::filesystem::path& meshFilePath,
+                              const u32 iterationCount) noexcept;
+
+    }  // namespace MeshUtils
+
 }  // namespace Radiant
@@ -17,15 +17,20 @@ namespace Radiant
             m_Meshes.emplace_back(gfxContext, meshPath);
         }
 
+        // NOTE: Geometry range goes back to the pool through deferred deletion, so in-flight frames are fine, but render objects extracted
+        // out of the mesh point into that range, caller has to clear draw context and iterate objects again. False if nothing matched.
+        bool UnloadMesh(const std::string& meshPath) noexcept
+        {
+            const std::filesystem::path meshFilePath{meshPath};
+            return std::erase_if(m_Meshes, [&](const Mesh& mesh) { return mesh.FilePath == meshFilePath; }) != 0;
+        }
+
         void IterateObjects(DrawContext& drawContext) noexcept
         {
             for (const auto& mesh : m_Meshes)
             {
-                for (const auto& rootNode : mesh.RootNodes)
-                {
-                    rootNode->Iterate(drawContext, mesh.VertexPositionBuffers, mesh.VertexAttributeBuffers, mesh.IndexBuffers,
-                                      mesh.MaterialBuffers, rootNode->WorldTransform);
-                }
+                mesh.Hierarchy.ExtractRenderObjects(drawContext, mesh.VertexPositionBuffers, mesh.DepthOnlyVertexPositionBuffers,
+                                                    mesh.VertexAttributeBuffers, mesh.IndexBuffers, mesh.MaterialBuffers);
             }
         }
 
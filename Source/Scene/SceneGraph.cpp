@@ -0,0 +1,251 @@
+#include "SceneGraph.hpp"
+
+#include <Scene/Mesh.hpp>
+
+namespace Radiant
+{
+
+    void SceneGraph::Build(const std::vector<NodeDescription>& nodeDescriptions) noexcept
+    {
+        const auto nodeCount = static_cast<u32>(nodeDescriptions.size());
+
+        std::vector<std::vector<u32>> childrenLUT(nodeCount);
+        std::vector<u32> sortedToSource;
+        sortedToSource.reserve(nodeCount);
+        for (u32 i{}; i < nodeCount; ++i)
+        {
+            const auto parentIndex = nodeDescriptions[i].ParentIndex;
+            if (parentIndex == s_InvalidNodeIndex)
+                sortedToSource.emplace_back(i);
+            else
+                childrenLUT[parentIndex].emplace_back(i);
+        }
+
+        // Breadth first sort, so nodes of the same depth are laid out contiguously.
+        m_LevelOffsets = {0};
+        for (u32 levelBegin{}; levelBegin < sortedToSource.size();)
+        {
+            const auto levelEnd = static_cast<u32>(sortedToSource.size());
+            m_LevelOffsets.emplace_back(levelEnd);
+
+            for (u32 i{levelBegin}; i < levelEnd; ++i)
+                sortedToSource.insert(sortedToSource.end(), childrenLUT[sortedToSource[i]].cbegin(), childrenLUT[sortedToSource[i]].cend());
+
+            levelBegin = levelEnd;
+        }
+        RDNT_ASSERT(sortedToSource.size() == nodeCount, "Scene graph has cycles or dangling parent indices!");
+
+        std::vector<u32> sourceToSorted(nodeCount);
+        for (u32 i{}; i < nodeCount; ++i)
+            sourceToSorted[sortedToSource[i]] = i;
+
+        m_ParentIndices.resize(nodeCount);
+        m_LocalTransforms.resize(nodeCount);
+        m_WorldTransforms.resize(nodeCount);
+        m_DirtyFlags.assign(nodeCount, 1);
+        m_NodeLevels.resize(nodeCount);
+        m_RootIndices.resize(nodeCount);
+        m_MeshAssets.resize(nodeCount);
+        m_Names.resize(nodeCount);
+        m_NodeLUT.clear();
+
+        for (u32 level{}; level < GetLevelCount(); ++level)
+        {
+            for (u32 i{m_LevelOffsets[level]}; i < m_LevelOffsets[level + 1]; ++i)
+            {
+                const auto& nodeDescription = nodeDescriptions[sortedToSource[i]];
+
+                m_ParentIndices[i] = nodeDescription.ParentIndex == s_InvalidNodeIndex
+                                         ? s_InvalidNodeIndex
+                                         : static_cast<i32>(sourceToSorted[nodeDescription.ParentIndex]);
+                m_LocalTransforms[i] = nodeDescription.LocalTransform;
+                m_NodeLevels[i]      = level;
+                m_RootIndices[i]     = m_ParentIndices[i] == s_InvalidNodeIndex ? i : m_RootIndices[m_ParentIndices[i]];
+                m_MeshAssets[i]      = nodeDescription.MeshAsset;
+                m_Names[i]           = nodeDescription.Name;
+
+                m_NodeLUT[m_Names[i]] = i;
+            }
+        }
+
+        m_FirstDirtyLevel = 0;
+        UpdateTransforms();
+    }
+
+    void SceneGraph::SetLocalTransform(const u32 nodeIndex, const glm::mat4& localTransform) noexcept
+    {
+        RDNT_ASSERT(nodeIndex < GetNodeCount(), "Node index out of range!");
+
+        m_LocalTransforms[nodeIndex] = localTransform;
+        m_DirtyFlags[nodeIndex]      = 1;
+        m_FirstDirtyLevel            = glm::min(m_FirstDirtyLevel, m_NodeLevels[nodeIndex]);
+    }
+
+    void SceneGraph::UpdateLevelRange(const u32 firstNode, const u32 lastNode) noexcept
+    {
+        for (u32 i{firstNode}; i < lastNode; ++i)
+        {
+            const auto parentIndex = m_ParentIndices[i];
+            if (parentIndex == s_InvalidNodeIndex)
+            {
+                if (m_DirtyFlags[i]) m_WorldTransforms[i] = m_LocalTransforms[i];
+                continue;
+            }
+
+            // Dirty parent means its whole subtree has to be refreshed.
+            m_DirtyFlags[i] |= m_DirtyFlags[parentIndex];
+            if (m_DirtyFlags[i]) m_WorldTransforms[i] = m_WorldTransforms[parentIndex] * m_LocalTransforms[i];
+        }
+    }
+
+    void SceneGraph::UpdateTransforms() noexcept
+    {
+        if (m_FirstDirtyLevel >= GetLevelCount()) return;
+
+        // NOTE: Levels are processed in order, nodes inside a level depend only on previous levels, so big levels are split into chunks.
+        // Mesh loading itself runs on the thread pool, so waiting on nested pool tasks could starve it, use parallel algorithms instead.
+        std::vector<u32> chunkOffsets;
+        for (u32 level{m_FirstDirtyLevel}; level < GetLevelCount(); ++level)
+        {
+            const u32 levelBegin = m_LevelOffsets[level];
+            const u32 levelEnd   = m_LevelOffsets[level + 1];
+            if (levelEnd - levelBegin < 2 * s_ParallelChunkSize)
+            {
+                UpdateLevelRange(levelBegin, levelEnd);
+                continue;
+            }
+
+            chunkOffsets.clear();
+            for (u32 chunkBegin{levelBegin}; chunkBegin < levelEnd; chunkBegin += s_ParallelChunkSize)
+                chunkOffsets.emplace_back(chunkBegin);
+
+            std::for_each(std::execution::par, chunkOffsets.cbegin(), chunkOffsets.cend(),
+                          [&](const u32 chunkBegin) noexcept
+                          { UpdateLevelRange(chunkBegin, glm::min(chunkBegin + s_ParallelChunkSize, levelEnd)); });
+        }
+
+        std::fill(m_DirtyFlags.begin() + m_LevelOffsets[m_FirstDirtyLevel], m_DirtyFlags.end(), 0);
+        m_FirstDirtyLevel = std::numeric_limits<u32>::max();
+    }
+
+    void SceneGraph::ExtractRenderObjects(DrawContext& drawContext, const std::vector<Shared<GfxBuffer>>& vertexPositionBuffers,
+                                          const std::vector<Shared<GfxBuffer>>& depthOnlyVertexPositionBuffers,
+                                          const std::vector<Shared<GfxBuffer>>& vertexAttributeBuffers,
+                                          const std::vector<Shared<GfxBuffer>>& indexBuffers,
+                                          const std::vector<Shared<GfxBuffer>>& materialBuffers) const noexcept
+    {
+        RDNT_ASSERT(m_FirstDirtyLevel >= GetLevelCount(), "Extracting render objects from scene graph with stale transforms!");
+
+        for (u32 i{}; i < GetNodeCount(); ++i)
+        {
+            const auto& meshAsset = m_MeshAssets[i];
+            if (!meshAsset) continue;
+
+            const auto& indexBuffer        = indexBuffers[meshAsset->IndexBufferID];
+            const auto& vertexPosBuffer          = vertexPositionBuffers[meshAsset->VertexPositionBufferID];
+            const auto& depthOnlyVertexPosBuffer = depthOnlyVertexPositionBuffers[meshAsset->VertexPositionBufferID];
+            const auto& vertexAttribBuffer       = vertexAttributeBuffers[meshAsset->VertexAttributeBufferID];
+
+            // NOTE: Transform part is filled by renderer, dequantization params stay as is.
+            const ObjectInstanceData instance = {.positionDequantScale  = meshAsset->PositionDequantScale,
+                                                 .positionDequantOffset = meshAsset->PositionDequantOffset};
+
+            // NOTE: Root world transform is applied on top of node world transform(roots included), renderers are tuned for that.
+            const auto modelMatrix = m_WorldTransforms[m_RootIndices[i]] * m_WorldTransforms[i];
+
+            for (const auto& surface : meshAsset->Surfaces)
+            {
+                const auto& materialBuffer = materialBuffers[surface.MaterialID];
+                drawContext.RenderObjects.emplace_back(modelMatrix, instance, vertexPosBuffer, depthOnlyVertexPosBuffer, vertexAttribBuffer,
+                                                       indexBuffer, meshAsset->IndexType, meshAsset->VertexOffset,
+                                                       std::span{surface.LODs.data(), surface.LODCount}, surface.Bounds, 0, materialBuffer,
+                                                       surface.PrimitiveTopology, surface.CullMode, surface.AlphaMode);
+            }
+        }
+    }
+
+    std::optional<u32> SceneGraph::FindNode(const std::string& nodeName) const noexcept
+    {
+        const auto it = m_NodeLUT.find(nodeName);
+        if (it == m_NodeLUT.end()) return std::nullopt;
+
+        return it->second;
+    }
+
+    namespace SceneGraphUtils
+    {
+
+        void RunTransformBenchmark(const u32 iterationCount) noexcept
+        {
+            RDNT_ASSERT(iterationCount > 0, "Iteration count should be > 0!");
+
+            const glm::mat4 localTransform =
+                glm::translate(glm::vec3(0.0f, 1.0f, 0.0f)) * glm::rotate(glm::radians(1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+            // Chains are laid out one after another, so every level holds exactly one node of each chain.
+            const auto MakeChainsFunc = [&](const u32 chainCount, const u32 chainLength)
+            {
+                std::vector<SceneGraph::NodeDescription> nodeDescriptions(chainCount * chainLength);
+                for (u32 i{}; i < nodeDescriptions.size(); ++i)
+                {
+                    nodeDescriptions[i].ParentIndex    = i % chainLength == 0 ? SceneGraph::s_InvalidNodeIndex : static_cast<i32>(i) - 1;
+                    nodeDescriptions[i].LocalTransform = localTransform;
+                }
+                return nodeDescriptions;
+            };
+
+            // Complete tree, node i has children [i * branchingFactor + 1, i * branchingFactor + branchingFactor].
+            const auto MakeTreeFunc = [&](const u32 branchingFactor, const u32 nodeCount)
+            {
+                std::vector<SceneGraph::NodeDescription> nodeDescriptions(nodeCount);
+                for (u32 i{}; i < nodeCount; ++i)
+                {
+                    nodeDescriptions[i].ParentIndex    =
+                        i == 0 ? SceneGraph::s_InvalidNodeIndex : static_cast<i32>((i - 1) / branchingFactor);
+                    nodeDescriptions[i].LocalTransform = localTransform;
+                }
+                return nodeDescriptions;
+            };
+
+            const auto BenchmarkHierarchyFunc = [&](const std::string_view hierarchyName,
+                                                    const std::vector<SceneGraph::NodeDescription>& nodeDescriptions)
+            {
+                SceneGraph sceneGraph{};
+                Timer timer{};
+                sceneGraph.Build(nodeDescriptions);
+                const f64 buildTime = timer.GetElapsedMilliseconds();
+
+                // NOTE: Roots form the first level, so they're the first nodes, the last node always lives in the deepest level.
+                const auto rootCount = static_cast<u32>(
+                    std::ranges::count(nodeDescriptions, SceneGraph::s_InvalidNodeIndex, &SceneGraph::NodeDescription::ParentIndex));
+                timer.Reset();
+                for (u32 i{}; i < iterationCount; ++i)
+                {
+                    for (u32 rootIndex{}; rootIndex < rootCount; ++rootIndex)
+                        sceneGraph.SetLocalTransform(rootIndex, localTransform);
+                    sceneGraph.UpdateTransforms();
+                }
+                const f64 fullUpdateTime = timer.GetElapsedMilliseconds() / static_cast<f64>(iterationCount);
+
+                timer.Reset();
+                for (u32 i{}; i < iterationCount; ++i)
+                {
+                    sceneGraph.SetLocalTransform(sceneGraph.GetNodeCount() - 1, localTransform);
+                    sceneGraph.UpdateTransforms();
+                }
+                const f64 leafUpdateTime = timer.GetElapsedMilliseconds() / static_cast<f64>(iterationCount);
+
+                LOG_INFO("Scene graph benchmark [{}: {} nodes, {} levels]:", hierarchyName, sceneGraph.GetNodeCount(),
+                         sceneGraph.GetLevelCount());
+                LOG_INFO("\tbuild: {:.3f} ms, full update: avg {:.3f} ms, single leaf update: avg {:.3f} ms", buildTime, fullUpdateTime,
+                         leafUpdateTime);
+            };
+
+            BenchmarkHierarchyFunc("deep", MakeChainsFunc(64, 4096));
+            BenchmarkHierarchyFunc("wide", MakeTreeFunc(262'143, 262'144));
+            BenchmarkHierarchyFunc("balanced", MakeTreeFunc(8, 299'593));
+        }
+
+    }  // namespace SceneGraphUtils
+
+}  // namespace Radiant
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+
+namespace Radiant
+{
+
+    class GfxBuffer;
+    struct MeshAsset;
+    struct DrawContext;
+
+    // NOTE: Flat node hierarchy in SoA, nodes are sorted by depth(breadth first), so parents always come before their children and
+    // every depth level is a contiguous range of independent nodes. Transform update is a single forward pass starting at the first
+    // dirty level, big levels are split into chunks and processed in parallel.
+    class SceneGraph final
+    {
+      public:
+        static constexpr i32 s_InvalidNodeIndex = -1;
+
+        struct NodeDescription final
+        {
+            std::string Name{s_DEFAULT_STRING};
+            i32 ParentIndex{s_InvalidNodeIndex};  // Index into the same description array.
+            glm::mat4 LocalTransform{1.0f};
+            Shared<MeshAsset> MeshAsset{nullptr};
+        };
+
+        SceneGraph() noexcept  = default;
+        ~SceneGraph() noexcept = default;
+
+        void Build(const std::vector<NodeDescription>& nodeDescriptions) noexcept;
+
+        // NOTE: Only marks node dirty, world transforms are refreshed on the next UpdateTransforms().
+        void SetLocalTransform(const u32 nodeIndex, const glm::mat4& localTransform) noexcept;
+        void UpdateTransforms() noexcept;
+
+        void ExtractRenderObjects(DrawContext& drawContext, const std::vector<Shared<GfxBuffer>>& vertexPositionBuffers,
+                                  const std::vector<Shared<GfxBuffer>>& depthOnlyVertexPositionBuffers,
+                                  const std::vector<Shared<GfxBuffer>>& vertexAttributeBuffers,
+                                  const std::vector<Shared<GfxBuffer>>& indexBuffers,
+                                  const std::vector<Shared<GfxBuffer>>& materialBuffers) const noexcept;
+
+        NODISCARD std::optional<u32> FindNode(const std::string& nodeName) const noexcept;
+
+        NODISCARD FORCEINLINE u32 GetNodeCount() const noexcept { return static_cast<u32>(m_ParentIndices.size()); }
+        NODISCARD FORCEINLINE u32 GetLevelCount() const noexcept { return static_cast<u32>(m_LevelOffsets.size()) - 1; }
+        NODISCARD FORCEINLINE const auto& GetWorldTransform(const u32 nodeIndex) const noexcept { return m_WorldTransforms[nodeIndex]; }
+        NODISCARD FORCEINLINE const auto& GetNodeName(const u32 nodeIndex) const noexcept { return m_Names[nodeIndex]; }
+
+      private:
+        static constexpr u32 s_ParallelChunkSize = 1024;
+
+        // Hot data, touched by transform update.
+        std::vector<i32> m_ParentIndices;
+        std::vector<glm::mat4> m_LocalTransforms;
+        std::vector<glm::mat4> m_WorldTransforms;
+        std::vector<u8> m_DirtyFlags;
+        std::vector<u32> m_LevelOffsets{0};  // Level L covers [m_LevelOffsets[L], m_LevelOffsets[L + 1]).
+        std::vector<u32> m_NodeLevels;
+        u32 m_FirstDirtyLevel{std::numeric_limits<u32>::max()};
+
+        // Touched by draw list extraction.
+        std::vector<u32> m_RootIndices;
+        std::vector<Shared<MeshAsset>> m_MeshAssets;
+
+        // Cold data.
+        std::vector<std::string> m_Names;
+        UnorderedMap<std::string, u32> m_NodeLUT;
+
+        void UpdateLevelRange(const u32 firstNode, const u32 lastNode) noexcept;
+    };
+
+    namespace SceneGraphUtils
+    {
+
+        // NOTE: Headless, builds deep(long chains), wide(single root) and balanced synthetic hierarchies, then reports build time and
+        // average update time when every root is moved(whole graph is refreshed) and when a single leaf is moved.
+        void RunTransformBenchmark(const u32 iterationCount) noexcept;
+
+    }  // namespace SceneGraphUtils
+
+}  // namespace Radiant
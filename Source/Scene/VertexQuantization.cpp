@@ -0,0 +1,46 @@
+#include "VertexQuantization.hpp"
+
+namespace Radiant
+{
+
+    namespace VertexQuantizationUtils
+    {
+
+        QuantizedPositionsInfo QuantizePositions(std::span<const VertexPosition> positions,
+                                                 std::span<VertexPositionQuantized> quantizedPositions) noexcept
+        {
+            RDNT_ASSERT(quantizedPositions.size() >= positions.size(), "Not enough space for quantized positions!");
+
+            QuantizedPositionsInfo quantizedPositionsInfo = {};
+            if (positions.empty()) return quantizedPositionsInfo;
+
+            glm::vec3 positionMin{std::numeric_limits<f32>::max()}, positionMax{std::numeric_limits<f32>::lowest()};
+            for (const auto& vertex : positions)
+            {
+                positionMin = glm::min(positionMin, vertex.Position);
+                positionMax = glm::max(positionMax, vertex.Position);
+            }
+
+            // Flat axes(planes, quads) would divide by zero.
+            const auto extent                    = glm::max(positionMax - positionMin, glm::vec3(std::numeric_limits<f32>::min()));
+            quantizedPositionsInfo.DequantScale  = extent / 65535.0f;
+            quantizedPositionsInfo.DequantOffset = positionMin;
+
+            glm::vec3 maxError{0.0f};
+            for (u64 i{}; i < positions.size(); ++i)
+            {
+                const auto normalizedPosition  = glm::clamp((positions[i].Position - positionMin) / extent, 0.0f, 1.0f);
+                quantizedPositions[i].Position = glm::u16vec3(glm::round(normalizedPosition * 65535.0f));
+
+                const auto dequantizedPosition =
+                    DequantizePosition(quantizedPositions[i], quantizedPositionsInfo.DequantScale, quantizedPositionsInfo.DequantOffset);
+                maxError = glm::max(maxError, glm::abs(dequantizedPosition - positions[i].Position));
+            }
+            quantizedPositionsInfo.MaxError = glm::max(glm::max(maxError.x, maxError.y), maxError.z);
+
+            return quantizedPositionsInfo;
+        }
+
+    }  // namespace VertexQuantizationUtils
+
+}  // namespace Radiant
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Render/CoreDefines.hpp>
+
+namespace Radiant
+{
+
+    namespace VertexQuantizationUtils
+    {
+
+        struct QuantizedPositionsInfo final
+        {
+            glm::vec3 DequantScale{1.0f};
+            glm::vec3 DequantOffset{0.0f};
+            f32 MaxError{0.0f};  // Max absolute per axis error of decoded positions.
+        };
+
+        // NOTE: 16 bit unorm per axis over positions AABB, see Shaders::DecodeDepthOnlyPosition(). Error can't exceed half a quantization
+        // step(plus float rounding of decode itself), so it's bounded by DequantScale * 0.5.
+        NODISCARD QuantizedPositionsInfo QuantizePositions(std::span<const VertexPosition> positions,
+                                                           std::span<VertexPositionQuantized> quantizedPositions) noexcept;
+
+        NODISCARD FORCEINLINE glm::vec3 DequantizePosition(const VertexPositionQuantized& quantizedPosition, const glm::vec3& dequantScale,
+                                                           const glm::vec3& dequantOffset) noexcept
+        {
+            return glm::vec3(quantizedPosition.Position) * dequantScale + dequantOffset;
+        }
+
+    }  // namespace VertexQuantizationUtils
+
+}  // namespace Radiant
@@ -10,6 +10,7 @@ namespace Radiant
     using float4   = glm::float4;
 
     using u16vec2 = glm::u16vec2;
+    using u16vec3 = glm::u16vec3;
     using u16vec4 = glm::u16vec4;
 
     using uint2 = glm::uvec2;
@@ -21,11 +22,31 @@ namespace Radiant
     // TODO: Implement spot lights
 #define MAX_SPOT_LIGHT_COUNT 256
 
+// NOTE: Opt-in, depth prepass, CSM and main passes read 16 bit normalized positions(6 bytes instead of 12) over mesh asset bounds,
+// main passes decode the same ones, so equal depth test against depth prepass holds.
+#define QUANTIZE_VERTEX_POSITIONS 0
+
     struct VertexPosition
     {
         float3 Position;
     };
 
+    // Dequantized as Position * PositionDequantScale + PositionDequantOffset, see MeshAsset.
+    struct VertexPositionQuantized
+    {
+#ifdef __cplusplus
+        u16vec3 Position;
+#else
+    uint16_t3 Position;
+#endif
+    };
+
+#if QUANTIZE_VERTEX_POSITIONS
+    typedef VertexPositionQuantized DepthOnlyVertexPosition;
+#else
+    typedef VertexPosition DepthOnlyVertexPosition;
+#endif
+
     // https://knarkowicz.wordpress.com/2014/04/16/octahedron-normal-floattor-encoding/
     // https://www.jeremyong.com/graphics/2023/01/09/tangent-spaces-and-diamond-encoding/
     struct VertexAttribute
@@ -43,6 +64,7 @@ namespace Radiant
         int16_t TSign;  // NOTE: Maybe put in the last tangent's bit?
     };
 
+    // NOTE: Decomposed object transform, CPU draws fetch it by first instance.
     struct ObjectInstanceData
     {
         float3 translation;
@@ -50,11 +72,9 @@ namespace Radiant
         // x - real part, yzw - imaginary part.
         // TODO: on c++ side convert from range[-1. 1] to [0,1] (*0.5 + 0.5) and then halfPackUnorm
         // unpacking *2-1
-#ifdef __cplusplus
-        u16vec4 orientation;
-#else
-    half4 orientation;
-#endif
+        float4 orientation;
+        float3 positionDequantScale;  // DepthOnlyVertexPosition decoding, identity unless positions are quantized.
+        float3 positionDequantOffset;
     };
 
     struct Sphere
@@ -242,6 +262,35 @@ namespace Radiant
 
         [vk::binding(s_BINDLESS_SAMPLER_BINDING, 0)] SamplerState Sampler_Heap[s_MAX_BINDLESS_SAMPLERS];
 
+        // NOTE: Texture streaming feedback is indexed by combined image sampler ID, each entry holds log2 of the largest mip dimension
+        // requested plus one(0 - texture wasn't sampled). Footprint is measured against resident image, but since resident mips are
+        // the tail of full chain, requested log2 size doesn't depend on how many mips are resident. Texture ID can differ across the
+        // wave(GPU-driven draws fetch material per instance), UV derivatives are taken before anything diverges.
+        void RecordTextureStreamingFeedback(uint32_t *feedback, const uint32_t textureID, const float2 uv)
+        {
+            const float2 uvDx = ddx(uv);
+            const float2 uvDy = ddy(uv);
+            if (textureID == 0) return;
+
+            float2 textureSize;
+            Texture_Heap[textureID].GetDimensions(textureSize.x, textureSize.y);
+
+            const float2 dx                = uvDx * textureSize;
+            const float2 dy                = uvDy * textureSize;
+            const float lod                = 0.5f * log2(max(max(dot(dx, dx), dot(dy, dy)), s_KINDA_SMALL_NUMBER));
+            const float requestedLog2      = log2(max(textureSize.x, textureSize.y)) - lod;
+            const uint32_t laneRequestLog2 = uint32_t(clamp(ceil(requestedLog2), 0.0f, 31.0f)) + 1;
+
+            // Common case is the whole wave sampling the same texture, one atomic is enough then.
+            if (WaveActiveAllEqual(textureID))
+            {
+                const uint32_t waveRequestedLog2 = WaveActiveMax(laneRequestLog2);
+                if (WaveIsFirstLane()) InterlockedMax(feedback[textureID], waveRequestedLog2);
+            }
+            else
+                InterlockedMax(feedback[textureID], laneRequestLog2);
+        }
+
         float2 VogelDiskSample(const uint sampleIndex, const uint samplesCount, const float phi)
         {
             static const float GoldenAngle = 2.4f;
@@ -293,6 +342,15 @@ namespace Radiant
             return v + quat.x * t + cross(quat.yzw, t);
         }
 
+        float3 DecodeDepthOnlyPosition(const DepthOnlyVertexPosition vertex, const float3 dequantScale, const float3 dequantOffset)
+        {
+#if QUANTIZE_VERTEX_POSITIONS
+            return float3(vertex.Position) * dequantScale + dequantOffset;
+#else
+            return vertex.Position;
+#endif
+        }
+
         float3x3 QuatToRotMat3(const float4 q)
         {
             const float3 q2  = q.yzw * q.yzw;
@@ -0,0 +1,112 @@
+#include "TestFramework.hpp"
+
+#include <Render/BindlessUpdateQueue.hpp>
+
+namespace Radiant
+{
+
+    namespace BindlessUpdateQueueTestUtils
+    {
+
+        static constexpr u8 s_FrameCount = 2;
+        static constexpr u32 s_Binding   = 2;
+
+        // View is a stand-in for vk::DescriptorImageInfo, 0 means nothing was written.
+        struct TestBindlessUpdate
+        {
+            u32 View{0};
+            u32 BindlessID{0};
+            u32 Binding{0};
+        };
+
+        // Mirrors how GfxDevice uses the queue: registrations go into every frame's descriptors, in-place updates only into current one.
+        struct TestBindlessDevice
+        {
+            std::array<std::vector<u32>, s_FrameCount> ViewsPerFrame{};
+            BindlessUpdateQueue<TestBindlessUpdate, s_FrameCount> PendingUpdates{};
+            Pool<u32> BindlessIDs{};
+            u8 CurrentFrameIndex{0};
+
+            NODISCARD u32 Push(const u32 view) noexcept
+            {
+                const auto bindlessID = static_cast<u32>(BindlessIDs.Emplace(BindlessIDs.GetSize()));
+                for (auto& views : ViewsPerFrame)
+                {
+                    views.resize(std::max<u64>(views.size(), bindlessID + 1));
+                    views[bindlessID] = view;
+                }
+                return bindlessID;
+            }
+
+            void Update(const u32 view, const u32 bindlessID) noexcept
+            {
+                ViewsPerFrame[CurrentFrameIndex][bindlessID] = view;
+                PendingUpdates.Push({.View = view, .BindlessID = bindlessID, .Binding = s_Binding}, CurrentFrameIndex);
+            }
+
+            void Pop(const u32 bindlessID) noexcept
+            {
+                PendingUpdates.Remove(bindlessID, s_Binding);
+                BindlessIDs.Release(bindlessID);
+            }
+
+            void BeginFrame() noexcept
+            {
+                CurrentFrameIndex = (CurrentFrameIndex + 1) % s_FrameCount;
+                for (const auto& update : PendingUpdates.Get(CurrentFrameIndex))
+                    ViewsPerFrame[CurrentFrameIndex][update.BindlessID] = update.View;
+                PendingUpdates.Clear(CurrentFrameIndex);
+            }
+        };
+
+    }  // namespace BindlessUpdateQueueTestUtils
+
+    using namespace BindlessUpdateQueueTestUtils;
+
+    RDNT_TEST(BindlessUpdateQueue, UpdateReachesEveryFrame)
+    {
+        TestBindlessDevice device{};
+        const u32 bindlessID = device.Push(1);
+        device.Update(2, bindlessID);
+        RDNT_CHECK(device.ViewsPerFrame[0][bindlessID] == 2);
+        RDNT_CHECK(device.ViewsPerFrame[1][bindlessID] == 1);  // Frame in flight still reads the old view.
+
+        device.BeginFrame();
+        RDNT_CHECK(device.ViewsPerFrame[1][bindlessID] == 2);
+        RDNT_CHECK(device.PendingUpdates.Get(0).empty() && device.PendingUpdates.Get(1).empty());
+    }
+
+    RDNT_TEST(BindlessUpdateQueue, PopDropsQueuedUpdatesOfReusedID)
+    {
+        TestBindlessDevice device{};
+        const u32 streamedID = device.Push(1);
+        const u32 otherID    = device.Push(10);
+        device.Update(2, streamedID);
+        device.Update(11, otherID);
+
+        // Texture goes away while its update is still queued for the other frame, new texture gets the same ID.
+        device.Pop(streamedID);
+        const u32 reusedID = device.Push(3);
+        RDNT_CHECK(reusedID == streamedID);
+
+        device.BeginFrame();
+        RDNT_CHECK(device.ViewsPerFrame[0][reusedID] == 3 && device.ViewsPerFrame[1][reusedID] == 3);
+
+        // Updates of other IDs are left alone.
+        RDNT_CHECK(device.ViewsPerFrame[0][otherID] == 11 && device.ViewsPerFrame[1][otherID] == 11);
+    }
+
+    RDNT_TEST(BindlessUpdateQueue, PopMatchesBindingToo)
+    {
+        BindlessUpdateQueue<TestBindlessUpdate, 3> pendingUpdates{};
+        pendingUpdates.Push({.View = 1, .BindlessID = 0, .Binding = s_Binding}, 0);
+        pendingUpdates.Push({.View = 2, .BindlessID = 0, .Binding = s_Binding + 1}, 0);
+        RDNT_CHECK(pendingUpdates.Get(0).empty() && pendingUpdates.Get(1).size() == 2 && pendingUpdates.Get(2).size() == 2);
+
+        // Same ID in another binding is a different descriptor.
+        pendingUpdates.Remove(0, s_Binding);
+        for (u8 frame{1}; frame < 3; ++frame)
+            RDNT_CHECK(pendingUpdates.Get(frame).size() == 1 && pendingUpdates.Get(frame).front().View == 2);
+    }
+
+}  // namespace Radiant
@@ -0,0 +1,111 @@
+#include "TestFramework.hpp"
+
+#include <Render/DownsamplePlanner.hpp>
+
+namespace Radiant
+{
+
+    namespace DownsamplePlannerTestUtils
+    {
+
+        NODISCARD static u32 GetMipLevelCount(const glm::uvec2& dimensions) noexcept
+        {
+            return static_cast<u32>(std::floor(std::log2(std::max(dimensions.x, dimensions.y)))) + 1;
+        }
+
+        // CPU reference of what mip_building.slang can do in a single dispatch, returns number of broken rules.
+        NODISCARD static u32 CountPlanViolations(const glm::uvec2& srcDimensions, const u32 mipCount,
+                                                 const std::vector<DownsamplePlanner::DownsampleDispatch>& dispatches) noexcept
+        {
+            u32 violationCount{0}, nextSrcMip{0};
+            for (const auto& dispatch : dispatches)
+            {
+                // Chain is covered in order, every mip is written exactly once.
+                if (dispatch.SrcMip != nextSrcMip || dispatch.MipCount == 0 || dispatch.MipCount > SPD_MAX_MIP_COUNT) ++violationCount;
+                nextSrcMip = dispatch.SrcMip + dispatch.MipCount;
+
+                const auto dispatchSrcDimensions = DownsamplePlanner::GetMipDimensions(srcDimensions, dispatch.SrcMip);
+                if (dispatch.SrcDimensions != dispatchSrcDimensions) ++violationCount;
+
+                // Every source texel belongs to some workgroup's tile.
+                const glm::uvec2 tileSize{SPD_TILE_SIZE};
+                if (glm::any(glm::lessThan(dispatch.WorkGroupCount * tileSize, dispatchSrcDimensions)) ||
+                    glm::any(glm::greaterThanEqual((dispatch.WorkGroupCount - glm::uvec2(1)) * tileSize, dispatchSrcDimensions)))
+                    ++violationCount;
+
+                // Past shared mips the last workgroup reduces whole mip 6 alone, one tile is all it can read.
+                if (dispatch.MipCount > DownsamplePlanner::s_SharedMipCount)
+                {
+                    const auto mip6Dimensions =
+                        DownsamplePlanner::GetMipDimensions(dispatchSrcDimensions, DownsamplePlanner::s_SharedMipCount);
+                    if (glm::max(mip6Dimensions.x, mip6Dimensions.y) > SPD_TILE_SIZE) ++violationCount;
+                }
+
+                // Groupshared levels are reduced by 2x2 footprints, only levels read from memory may be odd.
+                for (u32 level{1}; level < dispatch.MipCount; ++level)
+                {
+                    if (level == DownsamplePlanner::s_SharedMipCount) continue;
+
+                    const auto dimensions = DownsamplePlanner::GetMipDimensions(dispatchSrcDimensions, level);
+                    if ((dimensions.x & 1) != 0 || (dimensions.y & 1) != 0) ++violationCount;
+                }
+            }
+
+            if (nextSrcMip != mipCount) ++violationCount;
+            return violationCount;
+        }
+
+    }  // namespace DownsamplePlannerTestUtils
+
+    using namespace DownsamplePlannerTestUtils;
+
+    RDNT_TEST(DownsamplePlanner, PowerOfTwoChainFitsSingleDispatch)
+    {
+        const glm::uvec2 srcDimensions{4096, 4096};
+        const auto dispatches = DownsamplePlanner::PlanDispatches(srcDimensions, 12);
+        RDNT_CHECK(dispatches.size() == 1 && dispatches[0].MipCount == 12);
+        RDNT_CHECK(dispatches[0].WorkGroupCount == glm::uvec2(64, 64));
+        RDNT_CHECK(CountPlanViolations(srcDimensions, 12, dispatches) == 0);
+    }
+
+    RDNT_TEST(DownsamplePlanner, LargeSourceIsSplit)
+    {
+        // Mip 6 of 8192 source doesn't fit last workgroup, so the first dispatch stops at shared mips, the second one goes on from mip 6.
+        const glm::uvec2 srcDimensions{8192, 8192};
+        const auto dispatches = DownsamplePlanner::PlanDispatches(srcDimensions, 13);
+        RDNT_CHECK(dispatches.size() == 2);
+        RDNT_CHECK(dispatches[0].MipCount == DownsamplePlanner::s_SharedMipCount);
+        RDNT_CHECK(dispatches[1].SrcMip == 6 && dispatches[1].SrcDimensions == glm::uvec2(128) && dispatches[1].MipCount == 7);
+        RDNT_CHECK(CountPlanViolations(srcDimensions, 13, dispatches) == 0);
+    }
+
+    RDNT_TEST(DownsamplePlanner, OddMipEndsDispatch)
+    {
+        // 1000x600 -> 500x300 -> 250x150 -> 125x75, so mip 3 is the first one read from memory by the next dispatch.
+        const glm::uvec2 srcDimensions{1000, 600};
+        const u32 mipCount    = GetMipLevelCount(srcDimensions) - 1;
+        const auto dispatches = DownsamplePlanner::PlanDispatches(srcDimensions, mipCount);
+        RDNT_CHECK(!dispatches.empty() && dispatches[0].MipCount == 3);
+        RDNT_CHECK(dispatches.size() > 1 && dispatches[1].SrcMip == 3 && dispatches[1].SrcDimensions == glm::uvec2(125, 75));
+        RDNT_CHECK(CountPlanViolations(srcDimensions, mipCount, dispatches) == 0);
+    }
+
+    RDNT_TEST(DownsamplePlanner, AnyChainIsCovered)
+    {
+        u32 violationCount{0};
+        std::mt19937 randomEngine{28};
+        std::uniform_int_distribution<u32> dimensionDistribution(1, 16384);
+        for (u32 i{}; i < 2000; ++i)
+        {
+            const glm::uvec2 srcDimensions{dimensionDistribution(randomEngine), dimensionDistribution(randomEngine)};
+            const u32 maxMipCount = GetMipLevelCount(srcDimensions) - 1;
+            if (maxMipCount == 0) continue;
+
+            // Full chains(texture uploads) and partial ones.
+            for (const u32 mipCount : {maxMipCount, std::max(1u, maxMipCount / 2)})
+                violationCount += CountPlanViolations(srcDimensions, mipCount, DownsamplePlanner::PlanDispatches(srcDimensions, mipCount));
+        }
+        RDNT_CHECK(violationCount == 0);
+    }
+
+}  // namespace Radiant
@@ -0,0 +1,105 @@
+#include "TestFramework.hpp"
+
+#include <Render/Renderers/AW2/AlanWake2HZB.hpp>
+
+namespace Radiant
+{
+
+    namespace HZBTestUtils
+    {
+
+        // Odd sized on purpose, so every mip of the chain is reduced out of odd sized one at least along one axis.
+        static const glm::uvec2 s_DepthDimensions{161, 91};
+        static constexpr f32 s_WallDistance = 5.0f;
+
+        // Reversed z, same as Camera: near plane lands at 1, far plane at 0.
+        NODISCARD static glm::mat4 MakeViewProjectionMatrix() noexcept
+        {
+            const f32 aspectRatio = static_cast<f32>(s_DepthDimensions.x) / static_cast<f32>(s_DepthDimensions.y);
+            return glm::perspective(glm::radians(60.0f), aspectRatio, 1000.0f, 0.1f);
+        }
+
+        // Depth readback of a frame where camera faces a wall covering the whole view, optionally the last(odd) column isn't covered
+        // and keeps cleared(far plane) depth.
+        NODISCARD static std::vector<f32> MakeRecordedDepth(const bool bOpenLastColumn) noexcept
+        {
+            const glm::vec4 wallClipPos = MakeViewProjectionMatrix() * glm::vec4(0.0f, 0.0f, -s_WallDistance, 1.0f);
+            std::vector<f32> depth(static_cast<u64>(s_DepthDimensions.x) * s_DepthDimensions.y, wallClipPos.z / wallClipPos.w);
+            if (bOpenLastColumn)
+            {
+                for (u32 y{}; y < s_DepthDimensions.y; ++y)
+                    depth[y * s_DepthDimensions.x + s_DepthDimensions.x - 1] = 0.0f;
+            }
+
+            return depth;
+        }
+
+    }  // namespace HZBTestUtils
+
+    using namespace HZBTestUtils;
+
+    RDNT_TEST(HZB, OddMipKeepsLastRowAndColumn)
+    {
+        // Farthest depth sits in the last column and row of 5x3, 2x2 footprints alone never reach it.
+        std::vector<f32> depth(5 * 3, 1.0f);
+        depth[2 * 5 + 4] = 0.25f;
+
+        const AW2::HZBReference hzb(depth, {5, 3});
+        RDNT_CHECK(hzb.GetMipCount() == 3);
+        RDNT_CHECK(hzb.GetMipDimensions(1) == glm::uvec2(2, 1));
+        RDNT_CHECK(hzb.Load({0, 0}, 1) == 1.0f);
+        RDNT_CHECK(hzb.Load({1, 0}, 1) == 0.25f);
+        RDNT_CHECK(hzb.Load({0, 0}, 2) == 0.25f);
+    }
+
+    RDNT_TEST(HZB, EveryMipIsConservative)
+    {
+        std::mt19937 randomEngine{7};
+        std::uniform_real_distribution<f32> depthDistribution(0.0f, 1.0f);
+        std::vector<f32> depth(static_cast<u64>(s_DepthDimensions.x) * s_DepthDimensions.y);
+        std::ranges::generate(depth, [&]() { return depthDistribution(randomEngine); });
+
+        // NOTE: Texel covering mip 0 texel is found by halving its coordinates per mip, odd last row/column folds into the previous one.
+        const AW2::HZBReference hzb(depth, s_DepthDimensions);
+        for (u32 mipLevel{1}; mipLevel < hzb.GetMipCount(); ++mipLevel)
+        {
+            u32 fartherTexelCount{0};
+            for (u32 y{}; y < s_DepthDimensions.y; ++y)
+            {
+                for (u32 x{}; x < s_DepthDimensions.x; ++x)
+                {
+                    glm::uvec2 texel{x, y};
+                    for (u32 level{1}; level <= mipLevel; ++level)
+                        texel = glm::min(texel / 2u, hzb.GetMipDimensions(level) - 1u);
+
+                    if (hzb.Load(texel, mipLevel) > depth[y * s_DepthDimensions.x + x]) ++fartherTexelCount;
+                }
+            }
+            RDNT_CHECK(fartherTexelCount == 0);
+        }
+
+        RDNT_CHECK(hzb.GetMipDimensions(hzb.GetMipCount() - 1) == glm::uvec2(1));
+        RDNT_CHECK(hzb.Load({0, 0}, hzb.GetMipCount() - 1) == *std::ranges::min_element(depth));
+    }
+
+    RDNT_TEST(HZB, SphereBehindWallIsOccluded)
+    {
+        const AW2::HZBReference hzb(MakeRecordedDepth(false), s_DepthDimensions);
+        const auto viewProjectionMatrix = MakeViewProjectionMatrix();
+
+        RDNT_CHECK(hzb.IsSphereOccluded({.Origin = glm::vec3(0.0f, 0.0f, -20.0f), .Radius = 1.0f}, viewProjectionMatrix));
+        RDNT_CHECK(!hzb.IsSphereOccluded({.Origin = glm::vec3(0.0f, 0.0f, -3.0f), .Radius = 1.0f}, viewProjectionMatrix));
+        RDNT_CHECK(!hzb.IsSphereOccluded({.Origin = glm::vec3(0.0f, 0.0f, -s_WallDistance), .Radius = 1.0f}, viewProjectionMatrix));
+    }
+
+    RDNT_TEST(HZB, SphereSeenThroughOddLastColumnIsVisible)
+    {
+        // Sphere is behind the wall, but its bounds reach past the right edge of the view, where the last column is left open.
+        const Sphere sphere             = {.Origin = glm::vec3(19.5f, 0.0f, -20.0f), .Radius = 1.0f};
+        const auto viewProjectionMatrix = MakeViewProjectionMatrix();
+
+        RDNT_CHECK(AW2::HZBReference(MakeRecordedDepth(false), s_DepthDimensions).IsSphereOccluded(sphere, viewProjectionMatrix));
+        RDNT_CHECK(!AW2::HZBReference(MakeRecordedDepth(true), s_DepthDimensions).IsSphereOccluded(sphere, viewProjectionMatrix));
+    }
+
+}  // namespace Radiant
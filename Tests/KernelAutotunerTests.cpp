@@ -0,0 +1,120 @@
+#include "TestFramework.hpp"
+
+#include <Render/GfxKernelAutotuner.hpp>
+
+namespace Radiant
+{
+
+    namespace KernelAutotunerTestUtils
+    {
+
+        static const std::string s_PassName{"TestKernelPass"};
+        static const std::vector<GfxKernelVariant> s_Variants = {{.Name = "16x16"}, {.Name = "8x8"}, {.Name = "32x8"}};
+        static constexpr std::array<f64, 3> s_VariantTimes    = {0.003, 0.001, 0.002};  // Seconds, second variant is the fastest.
+
+        // Unique per test, left over data from previous runs is removed.
+        NODISCARD static std::string MakeTuningFileName(const std::string_view testName) noexcept
+        {
+            const auto fileName = (std::filesystem::temp_directory_path() / std::format("radiant_{}_autotune.txt", testName)).string();
+            std::filesystem::remove(fileName);
+            return fileName;
+        }
+
+        // Feeds frames timed as if currently selected variant was dispatched, until every variant got its samples.
+        static void RunTuningFrames(GfxKernelAutotuner& kernelAutotuner) noexcept
+        {
+            const u32 frameCount = (GfxKernelAutotuner::s_WarmUpFrameCount + GfxKernelAutotuner::s_SampleFrameCount) * s_Variants.size();
+            for (u32 frameIndex{}; frameIndex < frameCount; ++frameIndex)
+            {
+                ProfilerTask profilerTask{};
+                profilerTask.Name    = s_PassName;
+                profilerTask.EndTime = s_VariantTimes[kernelAutotuner.GetVariantIndex(s_PassName)];
+                kernelAutotuner.Update({profilerTask});
+            }
+        }
+
+    }  // namespace KernelAutotunerTestUtils
+
+    using namespace KernelAutotunerTestUtils;
+
+    RDNT_TEST(KernelAutotuner, TuningPicksFastestVariant)
+    {
+        const auto fileName = MakeTuningFileName("picks_fastest");
+        {
+            GfxKernelAutotuner kernelAutotuner(fileName, true);
+            RDNT_CHECK(kernelAutotuner.RegisterKernel(s_PassName, s_Variants) == std::vector<u32>({0, 1, 2}));
+
+            // Pass that's never recorded(disabled) doesn't hold others back.
+            RDNT_CHECK(kernelAutotuner.RegisterKernel("DisabledPass", s_Variants).size() == s_Variants.size());
+
+            RunTuningFrames(kernelAutotuner);
+            RDNT_CHECK(kernelAutotuner.GetVariantIndex(s_PassName) == 1);
+            RDNT_CHECK(kernelAutotuner.GetVariantIndex("DisabledPass") == 0);
+
+            // Tuned kernels stay put.
+            RunTuningFrames(kernelAutotuner);
+            RDNT_CHECK(kernelAutotuner.GetVariantIndex(s_PassName) == 1);
+        }
+
+        RDNT_CHECK(std::filesystem::exists(fileName));
+        std::filesystem::remove(fileName);
+    }
+
+    RDNT_TEST(KernelAutotuner, TuningDataSurvivesRestart)
+    {
+        const auto fileName = MakeTuningFileName("round_trip");
+        {
+            GfxKernelAutotuner kernelAutotuner(fileName, true);
+            (void)kernelAutotuner.RegisterKernel(s_PassName, s_Variants);
+            RunTuningFrames(kernelAutotuner);
+        }
+
+        // Only the selected variant gets built on next startup, unknown kernels go with default one.
+        {
+            GfxKernelAutotuner kernelAutotuner(fileName, false);
+            RDNT_CHECK(kernelAutotuner.RegisterKernel(s_PassName, s_Variants) == std::vector<u32>({1}));
+            RDNT_CHECK(kernelAutotuner.GetVariantIndex(s_PassName) == 1);
+            RDNT_CHECK(kernelAutotuner.RegisterKernel("UntunedPass", s_Variants) == std::vector<u32>({0}));
+        }
+
+        // Variant picked earlier was renamed(or removed) since then.
+        {
+            GfxKernelAutotuner kernelAutotuner(fileName, false);
+            const std::vector<GfxKernelVariant> renamedVariants = {{.Name = "16x16"}, {.Name = "4x4"}};
+            RDNT_CHECK(kernelAutotuner.RegisterKernel(s_PassName, renamedVariants) == std::vector<u32>({0}));
+        }
+
+        std::filesystem::remove(fileName);
+    }
+
+    RDNT_TEST(KernelAutotuner, BadTuningDataFallsBackToDefault)
+    {
+        const auto fileName = MakeTuningFileName("bad_data");
+        // Outdated version, truncated entry list and plain garbage.
+        for (const std::string_view fileContents :
+             {"0 1\n\"TestKernelPass\" \"8x8\"\n", "1 2\n\"TestKernelPass\" \"8x8\"\n\"Truncated", "garbage"})
+        {
+            std::ofstream(fileName, std::ios::out | std::ios::trunc) << fileContents;
+
+            GfxKernelAutotuner kernelAutotuner(fileName, false);
+            RDNT_CHECK(kernelAutotuner.RegisterKernel(s_PassName, s_Variants) == std::vector<u32>({0}));
+        }
+
+        std::filesystem::remove(fileName);
+    }
+
+    RDNT_TEST(KernelAutotuner, NotTuningLeavesDataAlone)
+    {
+        const auto fileName = MakeTuningFileName("not_tuning");
+        {
+            GfxKernelAutotuner kernelAutotuner(fileName, false);
+            RDNT_CHECK(kernelAutotuner.RegisterKernel(s_PassName, s_Variants) == std::vector<u32>({0}));
+
+            RunTuningFrames(kernelAutotuner);
+            RDNT_CHECK(kernelAutotuner.GetVariantIndex(s_PassName) == 0);
+        }
+
+        RDNT_CHECK(!std::filesystem::exists(fileName));
+    }
+
+}  // namespace Radiant
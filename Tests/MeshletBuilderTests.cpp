@@ -0,0 +1,179 @@
+#include "TestFramework.hpp"
+
+#include <Render/Renderers/AW2/AlanWake2MeshletBuilder.hpp>
+
+namespace Radiant
+{
+
+    namespace MeshletBuilderTestUtils
+    {
+
+        using Triangle = std::array<u32, 3>;
+
+        // Wavy grid of quads, big enough to span lots of meshlets, vertices are shared between neighbouring triangles.
+        static void MakeGrid(const u32 quadCount, std::vector<VertexPosition>& outVertexPositions, std::vector<u32>& outIndices) noexcept
+        {
+            const u32 vertexCount = quadCount + 1;
+            for (u32 y{}; y < vertexCount; ++y)
+                for (u32 x{}; x < vertexCount; ++x)
+                    outVertexPositions.emplace_back(glm::vec3(x, 0.25f * std::sin(0.5f * x) * std::cos(0.3f * y), y));
+
+            for (u32 y{}; y < quadCount; ++y)
+            {
+                for (u32 x{}; x < quadCount; ++x)
+                {
+                    const u32 i = y * vertexCount + x;
+                    outIndices.insert(outIndices.end(), {i, i + vertexCount, i + 1, i + 1, i + vertexCount, i + vertexCount + 1});
+                }
+            }
+        }
+
+        // NOTE: Meshlet optimization may rotate triangle's vertices, winding is kept though, so smallest index goes first.
+        NODISCARD static Triangle MakeCanonicalTriangle(const u32 a, const u32 b, const u32 c) noexcept
+        {
+            if (a <= b && a <= c) return {a, b, c};
+            if (b <= a && b <= c) return {b, c, a};
+            return {c, a, b};
+        }
+
+        NODISCARD static std::string MakeCachePath(const std::string_view testName) noexcept
+        {
+            const auto cachePath = (std::filesystem::temp_directory_path() / std::format("radiant_{}_meshlets.bin", testName)).string();
+            std::filesystem::remove(cachePath);
+            return cachePath;
+        }
+
+        template <typename T> NODISCARD static bool AreBytesEqual(const std::vector<T>& lhs, const std::vector<T>& rhs) noexcept
+        {
+            return lhs.size() == rhs.size() && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0);
+        }
+
+        NODISCARD static bool AreMeshletsEqual(const AW2::MeshletGeometry& lhs, const AW2::MeshletGeometry& rhs) noexcept
+        {
+            return AreBytesEqual(lhs.Meshlets, rhs.Meshlets) && AreBytesEqual(lhs.MeshletCullData, rhs.MeshletCullData) &&
+                   AreBytesEqual(lhs.MeshletVertexIndices, rhs.MeshletVertexIndices) &&
+                   AreBytesEqual(lhs.MeshletTriangleIndices, rhs.MeshletTriangleIndices);
+        }
+
+    }  // namespace MeshletBuilderTestUtils
+
+    using namespace MeshletBuilderTestUtils;
+
+    RDNT_TEST(MeshletBuilder, EveryTriangleCoveredOnce)
+    {
+        std::vector<VertexPosition> vertexPositions{};
+        std::vector<u32> indices{};
+        MakeGrid(64, vertexPositions, indices);
+
+        const auto meshletGeometry = AW2::MeshletBuilder::BuildMeshlets(vertexPositions, indices);
+        RDNT_CHECK(meshletGeometry.Meshlets.size() > 1);
+        RDNT_CHECK(meshletGeometry.Meshlets.size() == meshletGeometry.MeshletCullData.size());
+
+        std::vector<Triangle> expectedTriangles{};
+        for (u64 i{}; i < indices.size(); i += 3)
+            expectedTriangles.emplace_back(MakeCanonicalTriangle(indices[i], indices[i + 1], indices[i + 2]));
+
+        u32 brokenLimitCount{0}, badLocalIndexCount{0};
+        std::vector<Triangle> meshletTriangles{};
+        for (const auto& meshlet : meshletGeometry.Meshlets)
+        {
+            if (meshlet.VertexCount > Shaders::s_MaxMeshletVertexCount || meshlet.TriangleCount > Shaders::s_MaxMeshletTriangleCount ||
+                meshlet.VertexOffset + meshlet.VertexCount > meshletGeometry.MeshletVertexIndices.size() ||
+                meshlet.TriangleOffset + meshlet.TriangleCount > meshletGeometry.MeshletTriangleIndices.size())
+            {
+                ++brokenLimitCount;
+                continue;
+            }
+
+            for (u32 triangleIndex{}; triangleIndex < meshlet.TriangleCount; ++triangleIndex)
+            {
+                const u32 packedTriangle = meshletGeometry.MeshletTriangleIndices[meshlet.TriangleOffset + triangleIndex];
+
+                std::array<u32, 3> vertexIndices{};
+                for (u32 corner{}; corner < 3; ++corner)
+                {
+                    const u32 localVertexIndex = (packedTriangle >> (corner * 8)) & 0xFF;
+                    if (localVertexIndex >= meshlet.VertexCount) ++badLocalIndexCount;
+
+                    vertexIndices[corner] = meshletGeometry.MeshletVertexIndices[meshlet.VertexOffset + localVertexIndex];
+                }
+                meshletTriangles.emplace_back(MakeCanonicalTriangle(vertexIndices[0], vertexIndices[1], vertexIndices[2]));
+            }
+        }
+        RDNT_CHECK(brokenLimitCount == 0);
+        RDNT_CHECK(badLocalIndexCount == 0);
+
+        // Same multiset means nothing got lost or duplicated.
+        std::ranges::sort(expectedTriangles);
+        std::ranges::sort(meshletTriangles);
+        RDNT_CHECK(meshletTriangles == expectedTriangles);
+    }
+
+    RDNT_TEST(MeshletBuilder, BoundsContainMeshletVertices)
+    {
+        std::vector<VertexPosition> vertexPositions{};
+        std::vector<u32> indices{};
+        MakeGrid(32, vertexPositions, indices);
+
+        const auto meshletGeometry = AW2::MeshletBuilder::BuildMeshlets(vertexPositions, indices);
+
+        u32 outsideVertexCount{0};
+        for (u64 meshletIndex{}; meshletIndex < meshletGeometry.Meshlets.size(); ++meshletIndex)
+        {
+            const auto& meshlet = meshletGeometry.Meshlets[meshletIndex];
+            const auto& sphere  = meshletGeometry.MeshletCullData[meshletIndex].sphere;
+            for (u32 i{}; i < meshlet.VertexCount; ++i)
+            {
+                const auto& position = vertexPositions[meshletGeometry.MeshletVertexIndices[meshlet.VertexOffset + i]].Position;
+                if (glm::distance(position, sphere.Origin) > sphere.Radius * (1.0f + 1e-4f) + 1e-5f) ++outsideVertexCount;
+            }
+        }
+        RDNT_CHECK(outsideVertexCount == 0);
+    }
+
+    RDNT_TEST(MeshletBuilder, CacheRoundTrip)
+    {
+        std::vector<VertexPosition> vertexPositions{};
+        std::vector<u32> indices{};
+        MakeGrid(16, vertexPositions, indices);
+
+        const auto meshletGeometry = AW2::MeshletBuilder::BuildMeshlets(vertexPositions, indices);
+        const u64 cacheKey         = AW2::MeshletBuilder::MakeMeshletCacheKey(vertexPositions, indices);
+        const auto cachePath       = MakeCachePath("round_trip");
+        RDNT_CHECK(!AW2::MeshletBuilder::LoadMeshletCache(cachePath, cacheKey).has_value());
+
+        AW2::MeshletBuilder::SaveMeshletCache(cachePath, cacheKey, meshletGeometry);
+        const auto loadedMeshletGeometry = AW2::MeshletBuilder::LoadMeshletCache(cachePath, cacheKey);
+        RDNT_CHECK(loadedMeshletGeometry.has_value() && AreMeshletsEqual(*loadedMeshletGeometry, meshletGeometry));
+
+        // Changed geometry means changed key.
+        vertexPositions[0].Position.y += 1.0f;
+        RDNT_CHECK(AW2::MeshletBuilder::MakeMeshletCacheKey(vertexPositions, indices) != cacheKey);
+
+        std::filesystem::remove(cachePath);
+    }
+
+    RDNT_TEST(MeshletBuilder, StaleOrBrokenCacheIsRejected)
+    {
+        std::vector<VertexPosition> vertexPositions{};
+        std::vector<u32> indices{};
+        MakeGrid(16, vertexPositions, indices);
+
+        const auto meshletGeometry = AW2::MeshletBuilder::BuildMeshlets(vertexPositions, indices);
+        const u64 cacheKey         = AW2::MeshletBuilder::MakeMeshletCacheKey(vertexPositions, indices);
+        const auto cachePath       = MakeCachePath("broken");
+        AW2::MeshletBuilder::SaveMeshletCache(cachePath, cacheKey, meshletGeometry);
+        RDNT_CHECK(!AW2::MeshletBuilder::LoadMeshletCache(cachePath, cacheKey + 1).has_value());
+
+        // Cut off in the middle of data and in the middle of header.
+        const u64 fileSize = std::filesystem::file_size(cachePath);
+        for (const u64 truncatedSize : {fileSize - 1, fileSize / 2, u64{8}, u64{0}})
+        {
+            std::filesystem::resize_file(cachePath, truncatedSize);
+            RDNT_CHECK(!AW2::MeshletBuilder::LoadMeshletCache(cachePath, cacheKey).has_value());
+        }
+
+        std::filesystem::remove(cachePath);
+    }
+
+}  // namespace Radiant
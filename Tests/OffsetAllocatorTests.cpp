@@ -0,0 +1,144 @@
+#include "TestFramework.hpp"
+
+#include <Render/OffsetAllocator.hpp>
+
+namespace Radiant
+{
+
+    namespace OffsetAllocatorTestUtils
+    {
+
+        // Live allocations sorted by offset must never overlap and must stay inside capacity.
+        NODISCARD static bool AreAllocationsDisjoint(std::vector<OffsetAllocator::Allocation> allocations, const u64 capacity) noexcept
+        {
+            std::ranges::sort(allocations, {}, &OffsetAllocator::Allocation::Offset);
+            for (u64 i{}; i < allocations.size(); ++i)
+            {
+                if (allocations[i].Offset + allocations[i].Size > capacity) return false;
+                if (i > 0 && allocations[i - 1].Offset + allocations[i - 1].Size > allocations[i].Offset) return false;
+            }
+
+            return true;
+        }
+
+    }  // namespace OffsetAllocatorTestUtils
+
+    using namespace OffsetAllocatorTestUtils;
+
+    RDNT_TEST(OffsetAllocator, FreeCoalescesNeighbours)
+    {
+        OffsetAllocator allocator(1024);
+        const auto a = allocator.Allocate(256);
+        const auto b = allocator.Allocate(256);
+        const auto c = allocator.Allocate(256);
+        RDNT_CHECK(a.has_value() && b.has_value() && c.has_value());
+        RDNT_CHECK(allocator.GetUsedSize() == 768);
+        RDNT_CHECK(allocator.GetFreeBlockCount() == 1);
+
+        // Hole in the middle can't merge with anything yet.
+        allocator.Free(*b);
+        RDNT_CHECK(allocator.GetFreeBlockCount() == 2);
+        RDNT_CHECK(allocator.GetLargestFreeBlockSize() == 256);
+
+        // Left neighbour merges with the hole, right one merges with both hole and the tail.
+        allocator.Free(*a);
+        RDNT_CHECK(allocator.GetFreeBlockCount() == 2);
+        RDNT_CHECK(allocator.GetLargestFreeBlockSize() == 512);
+
+        allocator.Free(*c);
+        RDNT_CHECK(allocator.GetFreeBlockCount() == 1);
+        RDNT_CHECK(allocator.GetLargestFreeBlockSize() == allocator.GetCapacity());
+        RDNT_CHECK(allocator.GetUsedSize() == 0);
+    }
+
+    RDNT_TEST(OffsetAllocator, PicksBestFit)
+    {
+        OffsetAllocator allocator(1000);
+        std::vector<OffsetAllocator::Allocation> allocations;
+        for (const u64 size : {100, 10, 300, 10, 50, 10})
+            allocations.emplace_back(*allocator.Allocate(size));
+
+        // Free blocks of 100, 300 and 50 separated by live 10 element allocations, plus 520 element tail.
+        allocator.Free(allocations[0]);
+        allocator.Free(allocations[2]);
+        allocator.Free(allocations[4]);
+        RDNT_CHECK(allocator.GetFreeBlockCount() == 4);
+
+        const auto fit = allocator.Allocate(40);
+        RDNT_CHECK(fit.has_value() && fit->Offset == allocations[4].Offset);
+
+        const auto exactFit = allocator.Allocate(100);
+        RDNT_CHECK(exactFit.has_value() && exactFit->Offset == allocations[0].Offset);
+        RDNT_CHECK(allocator.GetFreeBlockCount() == 3);
+    }
+
+    RDNT_TEST(OffsetAllocator, FailsWhenNothingFits)
+    {
+        OffsetAllocator allocator(64);
+        const auto a = allocator.Allocate(32);
+        const auto b = allocator.Allocate(16);
+        const auto c = allocator.Allocate(16);
+        RDNT_CHECK(a.has_value() && b.has_value() && c.has_value());
+
+        // 48 elements are free in total, but split into two blocks, so neither fits.
+        allocator.Free(*a);
+        allocator.Free(*c);
+        RDNT_CHECK(allocator.GetUsedSize() == 16);
+        RDNT_CHECK(!allocator.Allocate(40).has_value());
+        RDNT_CHECK(!allocator.Allocate(65).has_value());
+        RDNT_CHECK(allocator.GetUsedSize() == 16);
+
+        const auto zeroSized = allocator.Allocate(0);
+        RDNT_CHECK(zeroSized.has_value() && zeroSized->Size == 0);
+        allocator.Free(*zeroSized);
+        RDNT_CHECK(allocator.GetUsedSize() == 16);
+    }
+
+    RDNT_TEST(OffsetAllocator, FragmentationStaysBoundedUnderChurn)
+    {
+        // Simulated streaming: meshes of random sizes get loaded and unloaded in random order, roughly at half occupancy.
+        constexpr u64 capacity = 1ull << 20;
+        OffsetAllocator allocator(capacity);
+
+        std::mt19937 randomEngine{19};
+        std::uniform_int_distribution<u64> sizeDistribution(1, capacity / 256);
+        std::bernoulli_distribution freeDistribution(0.5);
+
+        std::vector<OffsetAllocator::Allocation> allocations;
+        u32 failedAllocationCount{0}, brokenInvariantCount{0};
+        for (u32 iteration{}; iteration < 20'000; ++iteration)
+        {
+            const bool bShouldFree = !allocations.empty() && (allocator.GetUsedSize() > capacity / 2 || freeDistribution(randomEngine));
+            if (bShouldFree)
+            {
+                const u64 victimIndex = std::uniform_int_distribution<u64>(0, allocations.size() - 1)(randomEngine);
+                allocator.Free(allocations[victimIndex]);
+                allocations[victimIndex] = allocations.back();
+                allocations.pop_back();
+            }
+            else if (const auto allocation = allocator.Allocate(sizeDistribution(randomEngine)); allocation.has_value())
+                allocations.emplace_back(*allocation);
+            else
+                ++failedAllocationCount;
+
+            // NOTE: Since neighbouring free blocks are always merged, every free block is bounded by live allocations(or pool ends).
+            const u64 liveSize = std::accumulate(allocations.cbegin(), allocations.cend(), u64{0},
+                                                 [](const u64 sum, const OffsetAllocator::Allocation& a) { return sum + a.Size; });
+            if (allocator.GetUsedSize() != liveSize || allocator.GetFreeBlockCount() > allocations.size() + 1) ++brokenInvariantCount;
+        }
+
+        RDNT_CHECK(brokenInvariantCount == 0);
+        RDNT_CHECK(AreAllocationsDisjoint(allocations, capacity));
+
+        // At most half occupied with allocations no bigger than 1/256 of the pool, fragmentation alone should never fail one.
+        RDNT_CHECK(failedAllocationCount == 0);
+
+        for (const auto& allocation : allocations)
+            allocator.Free(allocation);
+
+        RDNT_CHECK(allocator.GetUsedSize() == 0);
+        RDNT_CHECK(allocator.GetFreeBlockCount() == 1);
+        RDNT_CHECK(allocator.GetLargestFreeBlockSize() == capacity);
+    }
+
+}  // namespace Radiant
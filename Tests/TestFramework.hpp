@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Core/Core.hpp>
+
+namespace Radiant::Tests
+{
+
+    // NOTE: Minimal self-registering test harness, engine has no third party test framework and doesn't need one for CPU-only checks.
+    struct TestCase final
+    {
+        std::string_view Suite{};
+        std::string_view Name{};
+        void (*Func)(u32& failedCheckCount) noexcept {nullptr};
+    };
+
+    NODISCARD inline std::vector<TestCase>& GetTestRegistry() noexcept
+    {
+        static std::vector<TestCase> s_TestRegistry{};
+        return s_TestRegistry;
+    }
+
+    struct TestRegistrar final
+    {
+        TestRegistrar(const std::string_view suite, const std::string_view name, void (*func)(u32&) noexcept) noexcept
+        {
+            GetTestRegistry().emplace_back(suite, name, func);
+        }
+    };
+
+}  // namespace Radiant::Tests
+
+#define RDNT_TEST(suite, name)                                                                                                             \
+    static void suite##_##name(::Radiant::u32& failedCheckCount) noexcept;                                                                \
+    static const ::Radiant::Tests::TestRegistrar s_##suite##_##name##_Registrar{#suite, #name, &suite##_##name};                          \
+    static void suite##_##name(::Radiant::u32& failedCheckCount) noexcept
+
+// NOTE: Doesn't abort the test, so every failed check of it gets reported.
+#define RDNT_CHECK(cond)                                                                                                                   \
+    if (!(cond))                                                                                                                           \
+    {                                                                                                                                      \
+        LOG_ERROR("{}:{}: check failed: {}", __FILE__, __LINE__, #cond);                                                                   \
+        ++failedCheckCount;                                                                                                                \
+    }
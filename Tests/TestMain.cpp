@@ -0,0 +1,33 @@
+#include "TestFramework.hpp"
+
+// Usage: RadiantTests [Suite], runs every registered test when suite isn't specified.
+int main(int argc, char** argv)
+{
+    using namespace Radiant;
+    Log::Init();
+
+    const std::string_view suiteFilter = argc > 1 ? argv[1] : std::string_view{};
+    u32 runTestCount{0}, failedTestCount{0};
+    for (const auto& testCase : Tests::GetTestRegistry())
+    {
+        if (!suiteFilter.empty() && testCase.Suite != suiteFilter) continue;
+
+        u32 failedCheckCount{0};
+        testCase.Func(failedCheckCount);
+        ++runTestCount;
+
+        if (failedCheckCount == 0)
+            LOG_INFO("[PASSED] {}.{}", testCase.Suite, testCase.Name);
+        else
+        {
+            LOG_ERROR("[FAILED] {}.{}, {} failed checks.", testCase.Suite, testCase.Name, failedCheckCount);
+            ++failedTestCount;
+        }
+    }
+
+    if (runTestCount == 0) LOG_ERROR("No tests matched \"{}\"!", suiteFilter);
+    LOG_INFO("{} of {} tests passed.", runTestCount - failedTestCount, runTestCount);
+
+    Log::Shutdown();
+    return runTestCount == 0 || failedTestCount > 0 ? 1 : 0;
+}
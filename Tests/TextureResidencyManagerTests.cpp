@@ -0,0 +1,157 @@
+#include "TestFramework.hpp"
+
+#include <Render/TextureResidencyManager.hpp>
+
+namespace Radiant
+{
+
+    namespace ResidencyTestUtils
+    {
+
+        // 2048x2048 single byte texels, 12 mips, 128x128 tail is always resident.
+        static constexpr u32 s_TopMipDimension = 2048;
+        static constexpr u8 s_TailBaseMip      = 4;
+        static constexpr u32 s_FullResFeedback = 12;  // log2(2048) + 1
+
+        NODISCARD static std::vector<u64> MakeMipSizes() noexcept
+        {
+            std::vector<u64> mipSizesBytes{};
+            for (u64 dimension{s_TopMipDimension}; dimension > 0; dimension >>= 1)
+                mipSizesBytes.emplace_back(dimension * dimension);
+
+            return mipSizesBytes;
+        }
+
+        NODISCARD static u64 GetSizeBytes(const u8 baseMip) noexcept
+        {
+            const auto mipSizesBytes = MakeMipSizes();
+            return std::accumulate(mipSizesBytes.begin() + baseMip, mipSizesBytes.end(), u64{0});
+        }
+
+    }  // namespace ResidencyTestUtils
+
+    using namespace ResidencyTestUtils;
+
+    RDNT_TEST(TextureResidency, FullResolutionRequestStreamsToBaseMip)
+    {
+        TextureResidencyManager residencyManager(~0ull);
+        residencyManager.RegisterTexture(1, MakeMipSizes(), s_TailBaseMip);
+        RDNT_CHECK(residencyManager.GetResidentSizeBytes() == GetSizeBytes(s_TailBaseMip));
+
+        std::vector<u32> feedback(4, 0);
+        feedback[1] = s_FullResFeedback;
+        residencyManager.ProcessFeedback(feedback, 1);
+
+        const auto requests = residencyManager.Update(~0ull);
+        RDNT_CHECK(requests.size() == 1 && requests[0].TextureID == 1 && requests[0].NewBaseMip == 0);
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(1) == 0);
+        RDNT_CHECK(residencyManager.GetResidentSizeBytes() == GetSizeBytes(0));
+
+        // Half resolution request of an already resident texture changes nothing, textures shrink only by eviction.
+        feedback[1] = s_FullResFeedback - 1;
+        residencyManager.ProcessFeedback(feedback, 2);
+        RDNT_CHECK(residencyManager.Update(~0ull).empty());
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(1) == 0);
+    }
+
+    RDNT_TEST(TextureResidency, ZeroAndOutOfRangeFeedbackIsIgnored)
+    {
+        TextureResidencyManager residencyManager(~0ull);
+        residencyManager.RegisterTexture(1, MakeMipSizes(), s_TailBaseMip);
+        residencyManager.RegisterTexture(7, MakeMipSizes(), s_TailBaseMip);
+
+        std::vector<u32> feedback(4, 0);
+        residencyManager.ProcessFeedback(feedback, 1);
+        RDNT_CHECK(residencyManager.Update(~0ull).empty());
+
+        // NOTE: Texture 7 doesn't fit into feedback buffer.
+        feedback[1] = 0;
+        feedback[3] = s_FullResFeedback;
+        residencyManager.ProcessFeedback(feedback, 2);
+        RDNT_CHECK(residencyManager.Update(~0ull).empty());
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(1) == s_TailBaseMip);
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(7) == s_TailBaseMip);
+    }
+
+    RDNT_TEST(TextureResidency, RequestBelowTailIsClamped)
+    {
+        TextureResidencyManager residencyManager(~0ull);
+        residencyManager.RegisterTexture(1, MakeMipSizes(), s_TailBaseMip);
+
+        std::vector<u32> feedback(2, 0);
+        feedback[1] = 3;  // 4x4 is enough, yet tail never goes away.
+        residencyManager.ProcessFeedback(feedback, 1);
+        RDNT_CHECK(residencyManager.Update(~0ull).empty());
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(1) == s_TailBaseMip);
+        RDNT_CHECK(residencyManager.GetResidentSizeBytes() == GetSizeBytes(s_TailBaseMip));
+    }
+
+    RDNT_TEST(TextureResidency, StreamInSizeIsCappedPerUpdate)
+    {
+        TextureResidencyManager residencyManager(~0ull);
+        residencyManager.RegisterTexture(1, MakeMipSizes(), s_TailBaseMip);
+        residencyManager.RegisterTexture(2, MakeMipSizes(), s_TailBaseMip);
+
+        std::vector<u32> feedback(3, 0);
+        feedback[1] = feedback[2] = s_FullResFeedback;
+        residencyManager.ProcessFeedback(feedback, 1);
+
+        const u64 maxStreamInSizeBytes = GetSizeBytes(0) - GetSizeBytes(s_TailBaseMip);
+        const auto firstRequests       = residencyManager.Update(maxStreamInSizeBytes);
+        RDNT_CHECK(firstRequests.size() == 1 && firstRequests[0].NewBaseMip == 0);
+
+        const auto secondRequests = residencyManager.Update(maxStreamInSizeBytes);
+        RDNT_CHECK(secondRequests.size() == 1 && secondRequests[0].NewBaseMip == 0);
+        RDNT_CHECK(!firstRequests.empty() && !secondRequests.empty() && firstRequests[0].TextureID != secondRequests[0].TextureID);
+
+        RDNT_CHECK(residencyManager.Update(maxStreamInSizeBytes).empty());
+        RDNT_CHECK(residencyManager.GetResidentSizeBytes() == 2 * GetSizeBytes(0));
+    }
+
+    RDNT_TEST(TextureResidency, LeastRecentlyRequestedIsEvicted)
+    {
+        // Both tails and a single full resolution texture fit.
+        const u64 budgetSizeBytes = GetSizeBytes(0) + GetSizeBytes(s_TailBaseMip);
+        TextureResidencyManager residencyManager(budgetSizeBytes);
+        residencyManager.RegisterTexture(1, MakeMipSizes(), s_TailBaseMip);
+        residencyManager.RegisterTexture(2, MakeMipSizes(), s_TailBaseMip);
+
+        std::vector<u32> feedback(3, 0);
+        feedback[1] = s_FullResFeedback;
+        residencyManager.ProcessFeedback(feedback, 1);
+        RDNT_CHECK(residencyManager.Update(~0ull).size() == 1);
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(1) == 0);
+
+        feedback[1] = 0;
+        feedback[2] = s_FullResFeedback;
+        residencyManager.ProcessFeedback(feedback, 2);
+
+        const auto requests = residencyManager.Update(~0ull);
+        RDNT_CHECK(requests.size() == 2);
+        RDNT_CHECK(requests.size() == 2 && requests[0].TextureID == 1 && requests[0].NewBaseMip == s_TailBaseMip);
+        RDNT_CHECK(requests.size() == 2 && requests[1].TextureID == 2 && requests[1].NewBaseMip == 0);
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(1) == s_TailBaseMip);
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(2) == 0);
+        RDNT_CHECK(residencyManager.GetResidentSizeBytes() <= residencyManager.GetBudgetSizeBytes());
+    }
+
+    RDNT_TEST(TextureResidency, SameFrameRequestsAreNotEvicted)
+    {
+        const u64 budgetSizeBytes = GetSizeBytes(0) + GetSizeBytes(s_TailBaseMip);
+        TextureResidencyManager residencyManager(budgetSizeBytes);
+        residencyManager.RegisterTexture(1, MakeMipSizes(), s_TailBaseMip);
+        residencyManager.RegisterTexture(2, MakeMipSizes(), s_TailBaseMip);
+
+        std::vector<u32> feedback(3, 0);
+        feedback[1] = feedback[2] = s_FullResFeedback;
+        residencyManager.ProcessFeedback(feedback, 1);
+        RDNT_CHECK(residencyManager.Update(~0ull).size() == 1);
+
+        // Both are still wanted, the one that didn't fit has to wait instead of thrashing the other one out.
+        residencyManager.ProcessFeedback(feedback, 2);
+        RDNT_CHECK(residencyManager.Update(~0ull).empty());
+        RDNT_CHECK(residencyManager.GetResidentBaseMip(1) + residencyManager.GetResidentBaseMip(2) == s_TailBaseMip);
+        RDNT_CHECK(residencyManager.GetResidentSizeBytes() == budgetSizeBytes);
+    }
+
+}  // namespace Radiant
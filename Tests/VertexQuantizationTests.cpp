@@ -0,0 +1,116 @@
+#include "TestFramework.hpp"
+
+#include <Scene/VertexQuantization.hpp>
+
+namespace Radiant
+{
+
+    namespace VertexQuantizationTestUtils
+    {
+
+        NODISCARD static std::vector<VertexPosition> MakeRandomPositions(const u32 count, const glm::vec3& boundsMin,
+                                                                         const glm::vec3& boundsMax) noexcept
+        {
+            std::mt19937 randomEngine{11};
+            std::uniform_real_distribution<f32> distribution(0.0f, 1.0f);
+
+            std::vector<VertexPosition> positions(count);
+            for (auto& vertex : positions)
+            {
+                const glm::vec3 t{distribution(randomEngine), distribution(randomEngine), distribution(randomEngine)};
+                vertex.Position = glm::mix(boundsMin, boundsMax, t);
+            }
+
+            return positions;
+        }
+
+        // Half a step plus float rounding of the decode itself.
+        NODISCARD static glm::vec3 GetErrorBound(const VertexQuantizationUtils::QuantizedPositionsInfo& quantizedPositionsInfo) noexcept
+        {
+            const glm::vec3 extent = quantizedPositionsInfo.DequantScale * 65535.0f;
+            return quantizedPositionsInfo.DequantScale * 0.5f +
+                   (glm::abs(quantizedPositionsInfo.DequantOffset) + extent) * (4.0f * std::numeric_limits<f32>::epsilon());
+        }
+
+    }  // namespace VertexQuantizationTestUtils
+
+    using namespace VertexQuantizationTestUtils;
+
+    RDNT_TEST(VertexQuantization, ErrorStaysUnderHalfStep)
+    {
+        // Far from origin on purpose, so float rounding of the decode is part of the error.
+        const auto positions = MakeRandomPositions(4096, glm::vec3(-1000.0f, 250.0f, 4000.0f), glm::vec3(-940.0f, 262.0f, 4300.0f));
+        std::vector<VertexPositionQuantized> quantizedPositions(positions.size());
+
+        const auto quantizedPositionsInfo = VertexQuantizationUtils::QuantizePositions(positions, quantizedPositions);
+        const auto errorBound             = GetErrorBound(quantizedPositionsInfo);
+
+        u32 outOfBoundCount{0};
+        f32 maxError{0.0f};
+        for (u64 i{}; i < positions.size(); ++i)
+        {
+            const auto position = VertexQuantizationUtils::DequantizePosition(quantizedPositions[i], quantizedPositionsInfo.DequantScale,
+                                                                              quantizedPositionsInfo.DequantOffset);
+            const auto error    = glm::abs(position - positions[i].Position);
+            if (!glm::all(glm::lessThanEqual(error, errorBound))) ++outOfBoundCount;
+            maxError = glm::max(maxError, glm::max(glm::max(error.x, error.y), error.z));
+        }
+
+        RDNT_CHECK(outOfBoundCount == 0);
+        RDNT_CHECK(glm::abs(quantizedPositionsInfo.MaxError - maxError) <= maxError * std::numeric_limits<f32>::epsilon());
+    }
+
+    RDNT_TEST(VertexQuantization, BoundsMinDecodesExactly)
+    {
+        const auto positions = MakeRandomPositions(256, glm::vec3(-3.0f), glm::vec3(5.0f));
+        std::vector<VertexPositionQuantized> quantizedPositions(positions.size());
+
+        const auto quantizedPositionsInfo = VertexQuantizationUtils::QuantizePositions(positions, quantizedPositions);
+
+        glm::vec3 positionMin{std::numeric_limits<f32>::max()};
+        for (const auto& vertex : positions)
+            positionMin = glm::min(positionMin, vertex.Position);
+
+        // NOTE: Smallest coordinate of every axis is encoded as 0, so decode is just the offset.
+        RDNT_CHECK(quantizedPositionsInfo.DequantOffset == positionMin);
+        for (u64 i{}; i < positions.size(); ++i)
+        {
+            for (u32 axis{}; axis < 3; ++axis)
+            {
+                if (positions[i].Position[axis] != positionMin[axis]) continue;
+
+                RDNT_CHECK(quantizedPositions[i].Position[axis] == 0);
+            }
+        }
+    }
+
+    RDNT_TEST(VertexQuantization, FlatAxisStaysFinite)
+    {
+        // Quad lying in y = 2 plane, zero extent along y.
+        const std::vector<VertexPosition> positions = {{glm::vec3(0.0f, 2.0f, 0.0f)},
+                                                       {glm::vec3(1.0f, 2.0f, 0.0f)},
+                                                       {glm::vec3(0.0f, 2.0f, 1.0f)},
+                                                       {glm::vec3(1.0f, 2.0f, 1.0f)}};
+        std::vector<VertexPositionQuantized> quantizedPositions(positions.size());
+
+        const auto quantizedPositionsInfo = VertexQuantizationUtils::QuantizePositions(positions, quantizedPositions);
+        RDNT_CHECK(std::isfinite(quantizedPositionsInfo.MaxError));
+        RDNT_CHECK(quantizedPositionsInfo.MaxError <= quantizedPositionsInfo.DequantScale.x * 0.5f);
+
+        for (u64 i{}; i < positions.size(); ++i)
+        {
+            const auto position = VertexQuantizationUtils::DequantizePosition(quantizedPositions[i], quantizedPositionsInfo.DequantScale,
+                                                                              quantizedPositionsInfo.DequantOffset);
+            RDNT_CHECK(position.y == 2.0f);
+        }
+    }
+
+    RDNT_TEST(VertexQuantization, EmptyInputIsIdentity)
+    {
+        const auto quantizedPositionsInfo = VertexQuantizationUtils::QuantizePositions({}, {});
+        RDNT_CHECK(quantizedPositionsInfo.DequantScale == glm::vec3(1.0f));
+        RDNT_CHECK(quantizedPositionsInfo.DequantOffset == glm::vec3(0.0f));
+        RDNT_CHECK(quantizedPositionsInfo.MaxError == 0.0f);
+    }
+
+}  // namespace Radiant